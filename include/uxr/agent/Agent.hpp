@@ -17,6 +17,7 @@
 
 #include <uxr/agent/visibility.hpp>
 #include <uxr/agent/middleware/Middleware.hpp>
+#include <uxr/agent/utils/OverloadControl.hpp>
 
 #include <cstdint>
 #include <string>
@@ -33,6 +34,7 @@ class CallbackFactory;
 } //  namespace middleware
 
 class Root;
+class DataWriter;
 
 class Agent
 {
@@ -108,6 +110,26 @@ public:
         REPLIER_OBJK        = 0x08
     };
 
+    /**
+     * @brief Reference to a DataWriter resolved once by get_datawriter_handle, so that the writes
+     *        through it skip the client and object lookups. The handle does not keep the DataWriter
+     *        alive: once it is deleted, writes through the handle fail with UNKNOWN_REFERENCE_ERROR.
+     */
+    class DataWriterHandle
+    {
+        friend class Agent;
+    public:
+        bool valid() const { return !datawriter_.expired(); }
+
+    private:
+        std::weak_ptr<DataWriter> datawriter_;
+    };
+
+    /**
+     * @brief View of a serialized sample owned by the caller, used by the batched write.
+     */
+    using Sample = Middleware::Sample;
+
     UXR_AGENT_EXPORT Agent();
     UXR_AGENT_EXPORT ~Agent();
 
@@ -539,6 +561,50 @@ public:
             size_t len,
             OpResult& op_result);
 
+    /**
+     * @brief Resolves the DataWriter identified by the datawriter_id into a handle.
+     * @param client_key        The identifier of the ProxyClient.
+     * @param datawriter_id     The identifier of the DataWriter.
+     * @param handle            The handle to fill.
+     * @param op_result         The result status of the operation.
+     * @return true in case of success and false in other case.
+     */
+    UXR_AGENT_EXPORT bool get_datawriter_handle(
+            uint32_t client_key,
+            uint16_t datawriter_id,
+            DataWriterHandle& handle,
+            OpResult& op_result);
+
+    /**
+     * @brief Writes data into the middleware using a DataWriter handle.
+     *        The buffer is handed to the middleware as is, without an intermediate copy.
+     * @param handle            The handle of the DataWriter.
+     * @param buf               The pointer to the buffer to write.
+     * @param len               The length of the buffer to write.
+     * @param op_result         The result status of the operation.
+     * @return true in case of success and false in other case.
+     */
+    UXR_AGENT_EXPORT bool write(
+            const DataWriterHandle& handle,
+            const uint8_t* buf,
+            size_t len,
+            OpResult& op_result);
+
+    /**
+     * @brief Writes several samples into the middleware using a DataWriter handle, in a single call.
+     *        The writing stops at the first failure, and the samples written before it are kept.
+     * @param handle            The handle of the DataWriter.
+     * @param samples           The samples to write.
+     * @param count             The number of samples.
+     * @param op_result         The result status of the operation.
+     * @return true in case all the samples are written and false in other case.
+     */
+    UXR_AGENT_EXPORT bool write(
+            const DataWriterHandle& handle,
+            const Sample* samples,
+            size_t count,
+            OpResult& op_result);
+
     /**
      * @brief Sets the verbose level of the logger.
      * @param verbose_level The verbose level of the logger.
@@ -553,6 +619,39 @@ public:
      */
     UXR_AGENT_EXPORT void set_verbose_level(uint8_t verbose_level);
 
+    /**
+     * @brief Enables or disables the asynchronous logging of messages.
+     *        When enabled, the message dumps of the transport threads are queued in a bounded
+     *        ring buffer and formatted by a background thread; records are dropped if it fills up.
+     * @param enable Whether the asynchronous logging is enabled.
+     */
+    UXR_AGENT_EXPORT void set_async_logging(bool enable);
+
+    /**
+     * @brief Sets the limits of the overload mode, they may be changed while the agent runs.
+     *        Over max_clients or max_entities_per_client, new CREATE_CLIENT and CREATE requests are
+     *        refused with STATUS_ERR_RESOURCES, while the existing clients and objects are kept.
+     *        Over max_queued_bytes or max_ingress_rate, best-effort messages are shed before reliable ones.
+     * @param limits    The limits, 0 disables each one of them.
+     */
+    UXR_AGENT_EXPORT void set_overload_limits(const utils::OverloadLimits& limits);
+
+    /**
+     * @brief Gets the number of times each shed decision was taken since the agent was created.
+     */
+    UXR_AGENT_EXPORT utils::OverloadStats get_overload_stats() const;
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    /**
+     * @brief Persists the object tree of each client in a memory-mapped snapshot, and restores the
+     *        trees already stored in it. A restored client resumes its session as soon as it is heard
+     *        from, and its creation requests are answered with the pre-instantiated entities.
+     * @param file_path The snapshot file path.
+     * @return true in case of success, false in other case.
+     */
+    UXR_AGENT_EXPORT bool enable_snapshot(const std::string& file_path);
+#endif
+
     /**
      * @brief Sets a callback function for an specific create/delete middleware entity operation.
      *        Note that not some middlewares might not implement every defined operation, or even
@@ -16,6 +16,7 @@
 #define UXR_AGENT_ROOT_HPP_
 
 #include <uxr/agent/client/ProxyClient.hpp>
+#include <uxr/agent/utils/OverloadControl.hpp>
 
 #include <thread>
 #include <memory>
@@ -53,12 +54,24 @@ public:
 
     void set_verbose_level(uint8_t verbose_level);
 
+    void set_async_logging(bool enable);
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    bool enable_snapshot(const std::string& path);
+#endif
+
     void reset();
 
+    utils::OverloadControl& get_overload_control() { return *overload_control_; }
+
 private:
     std::mutex mtx_;
     std::map<dds::xrce::ClientKey, std::shared_ptr<ProxyClient>> clients_;
     std::map<dds::xrce::ClientKey, std::shared_ptr<ProxyClient>>::iterator current_client_;
+    std::shared_ptr<utils::OverloadControl> overload_control_;
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    std::shared_ptr<ClientSnapshot> snapshot_;
+#endif
 };
 
 } // uxr
@@ -0,0 +1,115 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_CLIENT_CLIENTSNAPSHOT_HPP_
+#define UXR_AGENT_CLIENT_CLIENTSNAPSHOT_HPP_
+
+#include <uxr/agent/types/XRCETypes.hpp>
+#include <uxr/agent/middleware/Middleware.hpp>
+#include <uxr/agent/config.hpp>
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief Memory-mapped store of the clients' object trees, used to pre-instantiate them after a restart.
+ *        The file is split into fixed-size slots, one per client, so that each update only rewrites
+ *        the slot of that client. A slot is invalidated before being rewritten and carries a checksum,
+ *        so a torn write is discarded on load instead of restoring a partial tree.
+ */
+class ClientSnapshot
+{
+public:
+    struct Entry
+    {
+        dds::xrce::CLIENT_Representation representation;
+        Middleware::Kind middleware_kind;
+        std::vector<std::pair<dds::xrce::ObjectId, dds::xrce::ObjectVariant>> objects;
+    };
+
+    ClientSnapshot();
+
+    ~ClientSnapshot();
+
+    ClientSnapshot(ClientSnapshot&&) = delete;
+    ClientSnapshot(const ClientSnapshot&) = delete;
+    ClientSnapshot& operator=(ClientSnapshot&&) = delete;
+    ClientSnapshot& operator=(const ClientSnapshot&) = delete;
+
+    /**
+     * @brief Maps the snapshot file, creating it or discarding it if its layout does not match.
+     * @param path Path of the snapshot file.
+     * @param max_clients Number of slots.
+     * @param slot_size Size of each slot.
+     */
+    bool open(
+            const std::string& path,
+            size_t max_clients = SNAPSHOT_MAX_CLIENTS,
+            size_t slot_size = SNAPSHOT_SLOT_SIZE);
+
+    bool close();
+
+    /**
+     * @brief Reads the valid entries of the snapshot.
+     */
+    std::vector<Entry> load();
+
+    /**
+     * @brief Writes the entry of a client, replacing the previous one.
+     */
+    bool store(
+            const Entry& entry);
+
+    bool remove(
+            const dds::xrce::ClientKey& client_key);
+
+    bool clear();
+
+private:
+    struct SlotHeader
+    {
+        uint32_t client_key;
+        uint32_t length;
+        uint32_t checksum;
+    };
+
+    uint8_t* slot(
+            size_t index) const;
+
+    bool find_slot(
+            uint32_t client_key,
+            size_t& index,
+            bool allocate);
+
+    void sync(
+            size_t index);
+
+private:
+    std::mutex mtx_;
+    int fd_;
+    uint8_t* map_;
+    size_t map_size_;
+    size_t max_clients_;
+    size_t slot_size_;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_CLIENT_CLIENTSNAPSHOT_HPP_
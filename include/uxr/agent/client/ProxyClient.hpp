@@ -18,8 +18,16 @@
 #include <uxr/agent/middleware/Middleware.hpp>
 #include <uxr/agent/participant/Participant.hpp>
 #include <uxr/agent/client/session/Session.hpp>
+#include <uxr/agent/config.hpp>
+#include <uxr/agent/utils/OverloadControl.hpp>
+#ifdef UAGENT_SNAPSHOT_PROFILE
+#include <uxr/agent/client/ClientSnapshot.hpp>
+#endif
 #include <unordered_map>
 #include <array>
+#include <atomic>
+#include <map>
+#include <set>
 
 namespace eprosima {
 namespace uxr {
@@ -79,6 +87,42 @@ public:
     bool has_hard_liveliness_check() const { return hard_liveliness_check_; }
 
     uint8_t & get_hard_liveliness_check_tries() { return hard_liveliness_check_tries_; }
+
+    /**
+     * @brief Bounds the number of objects by the max_entities_per_client limit, new objects over it
+     *        are refused with STATUS_ERR_RESOURCES.
+     */
+    void set_overload_control(
+            std::shared_ptr<utils::OverloadControl> overload_control)
+    {
+        overload_control_ = std::move(overload_control);
+    }
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    /**
+     * @brief Persists the object tree in the snapshot from now on.
+     */
+    void enable_snapshot(
+            std::shared_ptr<ClientSnapshot> snapshot);
+
+    /**
+     * @brief Pre-instantiates the objects of a snapshot entry. Each restored object is adopted by
+     *        the first matching creation request, whatever its creation mode.
+     */
+    bool restore(
+            std::shared_ptr<ClientSnapshot> snapshot,
+            const std::vector<std::pair<dds::xrce::ObjectId, dds::xrce::ObjectVariant>>& objects);
+
+    /**
+     * @brief Returns true only once for a restored client, whose session shall be bound to the
+     *        first endpoint it is heard from.
+     */
+    bool claim_restored_session()
+    {
+        return restored_session_.load(std::memory_order_relaxed) && restored_session_.exchange(false);
+    }
+#endif
+
 private:
     bool create_object(
             const dds::xrce::ObjectId& object_id,
@@ -128,6 +172,23 @@ private:
     bool delete_object_unlock(
             const dds::xrce::ObjectId& object_id);
 
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    void save_snapshot();
+
+    /* Parents are created before their children, as their kinds are ordered. */
+    struct CreationOrder
+    {
+        bool operator()(
+                const dds::xrce::ObjectId& lhs,
+                const dds::xrce::ObjectId& rhs) const
+        {
+            return ((lhs[1] & 0x0F) != (rhs[1] & 0x0F))
+                ? ((lhs[1] & 0x0F) < (rhs[1] & 0x0F))
+                : (lhs < rhs);
+        }
+    };
+#endif
+
 private:
     const dds::xrce::CLIENT_Representation representation_;
     std::unique_ptr<Middleware> middleware_;
@@ -141,6 +202,15 @@ private:
     std::chrono::milliseconds client_dead_time_;
     bool hard_liveliness_check_;
     uint8_t  hard_liveliness_check_tries_;
+    std::shared_ptr<utils::OverloadControl> overload_control_;
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    Middleware::Kind middleware_kind_;
+    std::shared_ptr<ClientSnapshot> snapshot_;
+    std::map<dds::xrce::ObjectId, dds::xrce::ObjectVariant, CreationOrder> representations_;
+    std::set<dds::xrce::ObjectId> restored_;
+    std::atomic<bool> restored_session_;
+    bool snapshot_dirty_;
+#endif
 };
 
 } // namespace uxr
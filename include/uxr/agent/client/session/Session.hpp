@@ -41,6 +41,12 @@ inline bool is_reliable_stream(dds::xrce::StreamId stream_id)
     return (dds::xrce::STREAMID_BUILTIN_RELIABLE <= stream_id);
 }
 
+/* Control messages (HEARTBEAT, ACKNACK, STATUS) travel on the stream none and reliable recovery depends on them. */
+inline bool is_sheddable_stream(dds::xrce::StreamId stream_id)
+{
+    return is_besteffort_stream(stream_id);
+}
+
 class Session
 {
 public:
@@ -95,6 +101,12 @@ public:
             const T& submessage,
             std::chrono::milliseconds timeout);
 
+    /* Only reliable streams hold back, the others never block a producer. */
+    bool wait_output_credits(
+            dds::xrce::StreamId stream_id,
+            size_t submessage_size,
+            std::chrono::milliseconds timeout);
+
     bool get_next_output_message(
             dds::xrce::StreamId stream_id,
             OutputMessagePtr& output_message);
@@ -113,6 +125,10 @@ public:
             dds::xrce::HEARTBEAT_Payload& heartbeat);
 
 private:
+    ReliableInputStream& get_reliable_input_stream(
+            dds::xrce::StreamId stream_id,
+            utils::SharedLock& shared_lock);
+
     ReliableOutputStream& get_reliable_output_stream(
             dds::xrce::StreamId stream_id,
             utils::SharedLock& shared_lock);
@@ -124,7 +140,7 @@ private:
     std::unordered_map<dds::xrce::StreamId, BestEffortInputStream> best_effort_istreams_;
     std::unordered_map<dds::xrce::StreamId, ReliableInputStream> reliable_istreams_;
     std::mutex best_effort_imtx_;
-    std::mutex reliable_imtx_;
+    utils::SharedMutex reliable_imtx_;
 
     NoneOutputStream none_ostream_;
     std::unordered_map<dds::xrce::StreamId, BestEffortOutputStream> best_effort_ostreams_;
@@ -142,7 +158,7 @@ inline void Session::reset()
     }
     best_effort_ilock.unlock();
 
-    std::unique_lock<std::mutex> reliable_ilock(reliable_imtx_);
+    utils::SharedLock reliable_ilock(reliable_imtx_);
     for (auto& it : reliable_istreams_)
     {
         it.second.reset();
@@ -187,8 +203,8 @@ inline bool Session::push_input_message(
     }
     else
     {
-        std::lock_guard<std::mutex> lock(reliable_imtx_);
-        rv = reliable_istreams_[stream_id].push_message(sequence_nr, std::move(message));
+        utils::SharedLock shared_lock(reliable_imtx_);
+        rv = get_reliable_input_stream(stream_id, shared_lock).push_message(sequence_nr, std::move(message));
     }
     return rv;
 }
@@ -209,8 +225,8 @@ inline bool Session::pop_input_message(
     }
     else
     {
-        std::lock_guard<std::mutex> lock(reliable_imtx_);
-        rv = reliable_istreams_[stream_id].pop_message(message);
+        utils::SharedLock shared_lock(reliable_imtx_);
+        rv = get_reliable_input_stream(stream_id, shared_lock).pop_message(message);
     }
     return rv;
 }
@@ -222,8 +238,8 @@ inline void Session::update_from_heartbeat(
 {
     if (is_reliable_stream(stream_id))
     {
-        std::lock_guard<std::mutex> lock(reliable_imtx_);
-        reliable_istreams_[stream_id].update_from_heartbeat(first_unacked, last_unacked);
+        utils::SharedLock shared_lock(reliable_imtx_);
+        get_reliable_input_stream(stream_id, shared_lock).update_from_heartbeat(first_unacked, last_unacked);
     }
 }
 
@@ -233,8 +249,8 @@ inline void Session::fill_acknack(
 {
     if (is_reliable_stream(stream_id))
     {
-        std::lock_guard<std::mutex> lock(reliable_imtx_);
-        reliable_istreams_[stream_id].fill_acknack(acknack);
+        utils::SharedLock shared_lock(reliable_imtx_);
+        get_reliable_input_stream(stream_id, shared_lock).fill_acknack(acknack);
     }
 }
 
@@ -242,15 +258,15 @@ inline void Session::push_input_fragment(dds::xrce::StreamId stream_id, InputMes
 {
     if (is_reliable_stream(stream_id))
     {
-        std::lock_guard<std::mutex> lock(reliable_imtx_);
-        reliable_istreams_[stream_id].push_fragment(message);
+        utils::SharedLock shared_lock(reliable_imtx_);
+        get_reliable_input_stream(stream_id, shared_lock).push_fragment(message);
     }
 }
 
 inline bool Session::pop_input_fragment_message(dds::xrce::StreamId stream_id, InputMessagePtr& message)
 {
-    std::lock_guard<std::mutex> lock(reliable_imtx_);
-    return reliable_istreams_[stream_id].pop_fragment_message(message);
+    utils::SharedLock shared_lock(reliable_imtx_);
+    return get_reliable_input_stream(stream_id, shared_lock).pop_fragment_message(message);
 }
 
 /**************************************************************************************************
@@ -294,6 +310,21 @@ inline bool Session::push_output_submessage(
     return rv;
 }
 
+inline bool Session::wait_output_credits(
+        dds::xrce::StreamId stream_id,
+        size_t submessage_size,
+        std::chrono::milliseconds timeout)
+{
+    bool rv = true;
+    if (is_reliable_stream(stream_id))
+    {
+        utils::SharedLock shared_lock(reliable_omtx_);
+        rv = get_reliable_output_stream(stream_id, shared_lock).wait_for_credits(
+            session_info_, submessage_size, timeout);
+    }
+    return rv;
+}
+
 inline bool Session::get_next_output_message(
         dds::xrce::StreamId stream_id,
         OutputMessagePtr& output_message)
@@ -356,6 +387,25 @@ inline bool Session::fill_heartbeat(
     return rv;
 }
 
+inline ReliableInputStream& Session::get_reliable_input_stream(
+        dds::xrce::StreamId stream_id,
+        utils::SharedLock& shared_lock)
+{
+    shared_lock.lock();
+    auto it = reliable_istreams_.find(stream_id);
+    if (it != reliable_istreams_.end())
+    {
+        return it->second;
+    }
+    else
+    {
+        shared_lock.unlock();
+        utils::ExclusiveLock exclusive_lock(reliable_imtx_);
+        shared_lock.lock();
+        return reliable_istreams_[stream_id];
+    }
+}
+
 inline ReliableOutputStream& Session::get_reliable_output_stream(
         dds::xrce::StreamId stream_id,
         utils::SharedLock& shared_lock)
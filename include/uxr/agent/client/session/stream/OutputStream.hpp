@@ -27,6 +27,7 @@
 #include <array>
 #include <map>
 #include <condition_variable>
+#include <algorithm>
 
 namespace eprosima {
 namespace uxr {
@@ -235,6 +236,17 @@ public:
             const T& submessage,
             std::chrono::milliseconds timeout);
 
+    /**
+     * @brief Waits until the window has room for a submessage of the given serialized size, counting
+     *        its fragments. Nothing is reserved, so a single producer per stream is assumed.
+     */
+    bool wait_for_credits(
+            const SessionInfo& session_info,
+            size_t submessage_size,
+            std::chrono::milliseconds timeout);
+
+    size_t available_slots();
+
     bool get_next_message(OutputMessagePtr& output_message);
 
     bool get_message(
@@ -245,6 +257,13 @@ public:
 
     bool fill_heartbeat(dds::xrce::HEARTBEAT_Payload& heartbeat);
 
+private:
+    size_t free_slots() const;
+
+    static size_t required_slots(
+            const SessionInfo& session_info,
+            size_t submessage_size);
+
 private:
     std::map<uint16_t, OutputMessagePtr> messages_;
     SeqNum last_unacked_;
@@ -274,6 +293,48 @@ inline void ReliableOutputStream::reset()
     last_sent_ = UINT16_MAX;
     first_unacked_ = 0x0000;
     messages_.clear();
+    cv_.notify_all();
+}
+
+inline size_t ReliableOutputStream::free_slots() const
+{
+    const uint16_t in_flight = uint16_t(uint16_t(last_unacked_) - uint16_t(first_unacked_) + 1);
+    return (in_flight < RELIABLE_STREAM_DEPTH) ? size_t(RELIABLE_STREAM_DEPTH - in_flight) : 0;
+}
+
+inline size_t ReliableOutputStream::required_slots(
+        const SessionInfo& session_info,
+        size_t submessage_size)
+{
+    dds::xrce::MessageHeader message_header;
+    message_header.session_id(session_info.session_id);
+    const size_t header_size = message_header.getCdrSerializedSize();
+    const size_t subheader_size = dds::xrce::SubmessageHeader{}.getCdrSerializedSize();
+
+    /* Same split as push_submessage, capped so that an oversized message waits for an empty window. */
+    size_t slots = 1;
+    if (session_info.mtu < (header_size + subheader_size + submessage_size))
+    {
+        const size_t max_fragment_size = session_info.mtu - header_size - subheader_size;
+        slots = (subheader_size + submessage_size + max_fragment_size - 1) / max_fragment_size;
+    }
+    return std::min(slots, size_t(RELIABLE_STREAM_DEPTH));
+}
+
+inline bool ReliableOutputStream::wait_for_credits(
+        const SessionInfo& session_info,
+        size_t submessage_size,
+        std::chrono::milliseconds timeout)
+{
+    const size_t slots = required_slots(session_info, submessage_size);
+    std::unique_lock<std::mutex> lock(mtx_);
+    return cv_.wait_for(lock, timeout, [&](){ return slots <= free_slots(); });
+}
+
+inline size_t ReliableOutputStream::available_slots()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return free_slots();
 }
 
 template<class T>
@@ -325,8 +386,8 @@ inline bool ReliableOutputStream::push_submessage(
         }
         else
         {
-            /* Serialize submessage. */
-            std::unique_ptr<uint8_t[]> buf(new uint8_t[submessage_size]);
+            /* Serialize submessage once, shared by all the fragments and their retransmissions. */
+            std::shared_ptr<uint8_t> buf(new uint8_t[submessage_size], std::default_delete<uint8_t[]>());
             fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(buf.get()), submessage_size);
             fastcdr::Cdr serializer(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::CdrVersion::XCDRv1);
             submessage_header.serialize(serializer);
@@ -353,22 +414,19 @@ inline bool ReliableOutputStream::push_submessage(
                 }
                 fragment_subheader.submessage_length(fragment_size);
 
-                const size_t current_message_size = header_size + subheader_size + fragment_size;
-
                 /* Create message. */
                 last_unacked_ += 1;
                 message_header.sequence_nr(last_unacked_);
-                OutputMessagePtr output_message(new OutputMessage(message_header, current_message_size));
-                if (output_message->append_fragment(fragment_subheader,  buf.get() + serialized_size, fragment_size))
-                {
-                    /* Push message. */
-                    messages_.insert(std::make_pair(last_unacked_, std::move(output_message)));
-                    serialized_size += fragment_size;
-                }
-                else
-                {
-                    break;
-                }
+                OutputMessagePtr output_message(
+                    new OutputMessage(
+                        message_header,
+                        fragment_subheader,
+                        std::shared_ptr<const uint8_t>(buf, buf.get() + serialized_size),
+                        fragment_size));
+
+                /* Push message. */
+                messages_.insert(std::make_pair(last_unacked_, std::move(output_message)));
+                serialized_size += fragment_size;
 
             } while (serialized_size < submessage_size);
             rv = (serialized_size == submessage_size);
@@ -415,7 +473,7 @@ inline void ReliableOutputStream::update_from_acknack(SeqNum first_unacked)
             messages_.erase(first_unacked_);
             first_unacked_ += 1;
         }
-        cv_.notify_one();
+        cv_.notify_all();
     }
 }
 
@@ -50,7 +50,8 @@ public:
     bool read(
         const dds::xrce::READ_DATA_Payload& read_data,
         Reader<bool>::WriteFn write_fn,
-        WriteFnArgs& cb_args);
+        WriteFnArgs& cb_args,
+        Reader<bool>::CreditFn credit_fn);
 
 private:
     DataReader(
@@ -16,6 +16,7 @@
 #define UXR_AGENT_DATAWRITER_DATAWRITER_HPP_
 
 #include <uxr/agent/object/XRCEObject.hpp>
+#include <uxr/agent/middleware/Middleware.hpp>
 #include <string>
 #include <set>
 
@@ -47,6 +48,12 @@ public:
 
     bool write(dds::xrce::WRITE_DATA_Payload_Data& write_data);
     bool write(const std::vector<uint8_t>& data);
+    bool write(
+            const uint8_t* buf,
+            size_t len);
+    size_t write(
+            const Middleware::Sample* samples,
+            size_t count);
 
 private:
     DataWriter(const dds::xrce::ObjectId& object_id,
@@ -0,0 +1,123 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_LOGGER_ASYNCLOGGER_HPP_
+#define UXR_AGENT_LOGGER_ASYNCLOGGER_HPP_
+
+#include <uxr/agent/config.hpp>
+#include <uxr/agent/visibility.hpp>
+#include <uxr/agent/utils/BoundedQueue.hpp>
+
+#ifndef SPDLOG_ACTIVE_LEVEL
+#define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief Asynchronous backend for the message dumps of the I/O threads.
+ *        Producers copy a binary record into a bounded lock-free ring buffer, and a background
+ *        thread formats and writes it through the default spdlog logger.
+ *        Records that do not fit in the ring buffer are dropped and counted.
+ */
+class AsyncLogger
+{
+public:
+    static constexpr size_t status_size = 64;
+    static constexpr size_t data_size = 256;
+
+    UXR_AGENT_EXPORT static AsyncLogger& instance();
+
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Start the background thread and route the message dumps through the ring buffer.
+     */
+    UXR_AGENT_EXPORT bool start();
+
+    /**
+     * @brief Stop the background thread, writing the pending records first.
+     */
+    UXR_AGENT_EXPORT void stop();
+
+    /**
+     * @brief Queue a message dump without blocking.
+     * @param fd File descriptor of the message, or -1 if it has none.
+     * @param with_data Whether the content of the message is dumped, which is truncated to data_size octets.
+     * @return true if the record was queued, false if it was dropped because the ring buffer is full.
+     */
+    UXR_AGENT_EXPORT bool log_message(
+            const spdlog::source_loc& loc,
+            const char* status,
+            uint32_t client_key,
+            int fd,
+            const uint8_t* buf,
+            size_t len,
+            bool with_data);
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    AsyncLogger();
+    ~AsyncLogger();
+
+    AsyncLogger(AsyncLogger&&) = delete;
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    struct Record
+    {
+        spdlog::log_clock::time_point timestamp;
+        spdlog::source_loc loc;
+        std::array<char, status_size> status;
+        uint32_t client_key;
+        int fd;
+        size_t len;
+        size_t data_len;
+        bool with_data;
+        std::array<uint8_t, data_size> data;
+    };
+
+    void loop();
+
+    size_t flush();
+
+    void write(
+            const Record& record);
+
+private:
+    UXR_AGENT_EXPORT static std::atomic<bool> enabled_;
+
+    utils::BoundedQueue<Record> queue_;
+    std::atomic<uint64_t> dropped_;
+    uint64_t reported_dropped_;
+
+    std::mutex mtx_;
+    std::thread thread_;
+    std::atomic<bool> running_cond_;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_LOGGER_ASYNCLOGGER_HPP_
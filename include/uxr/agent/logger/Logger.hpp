@@ -19,11 +19,14 @@
 #include <uxr/agent/utils/Color.hpp>
 
 #ifdef UAGENT_LOGGER_PROFILE
+#ifndef SPDLOG_ACTIVE_LEVEL
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/fmt/bin_to_hex.h>
 #include <spdlog/sinks/stdout_sinks.h>
+#include <uxr/agent/logger/AsyncLogger.hpp>
 #endif
 
 #ifdef _WIN32
@@ -138,8 +141,21 @@
 #endif
 
 #ifdef UAGENT_LOGGER_PROFILE
+#define UXR_AGENT_LOG_ASYNC_MESSAGE(STATUS, CLIENT_KEY, FD, BUF, LEN) \
+    if (spdlog::default_logger_raw()->should_log(spdlog::level::debug)) \
+    { \
+        eprosima::uxr::AsyncLogger::instance().log_message( \
+            spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, STATUS, CLIENT_KEY, FD, BUF, LEN, \
+            spdlog::default_logger_raw()->should_log(spdlog::level::trace)); \
+    } \
+    void(0)
+
 #define UXR_AGENT_LOG_MESSAGE(STATUS, CLIENT_KEY, BUF, LEN) \
-    if (spdlog::default_logger()->should_log(spdlog::level::trace)) \
+    if (eprosima::uxr::AsyncLogger::enabled()) \
+    { \
+        UXR_AGENT_LOG_ASYNC_MESSAGE(STATUS, CLIENT_KEY, -1, BUF, LEN); \
+    } \
+    else if (spdlog::default_logger()->should_log(spdlog::level::trace)) \
     { \
         UXR_AGENT_LOG_DEBUG(STATUS, UXR_MESSAGE_WITH_DATA_PATTERN, CLIENT_KEY, LEN, spdlog::to_hex(BUF, BUF + LEN)); \
     } \
@@ -150,7 +166,11 @@
     void(0)
 
 #define UXR_MULTIAGENT_LOG_MESSAGE(STATUS, CLIENT_KEY, FD, BUF, LEN) \
-    if (spdlog::default_logger()->should_log(spdlog::level::trace)) \
+    if (eprosima::uxr::AsyncLogger::enabled()) \
+    { \
+        UXR_AGENT_LOG_ASYNC_MESSAGE(STATUS, CLIENT_KEY, FD, BUF, LEN); \
+    } \
+    else if (spdlog::default_logger()->should_log(spdlog::level::trace)) \
     { \
         UXR_AGENT_LOG_DEBUG(STATUS, UXR_MESSAGE_WITH_FD_PATTERN, CLIENT_KEY, FD, LEN, spdlog::to_hex(BUF, BUF + LEN)); \
     } \
@@ -159,9 +179,12 @@
         UXR_AGENT_LOG_DEBUG(STATUS, UXR_MESSAGE_PATTERN, CLIENT_KEY, FD, LEN, spdlog::to_hex(BUF, BUF + LEN)); \
     } \
     void(0)
+
+#define UXR_AGENT_LOG_MESSAGE_ENABLED() spdlog::default_logger()->should_log(spdlog::level::debug)
 #else
 #define UXR_AGENT_LOG_MESSAGE(...) void(0)
 #define UXR_MULTIAGENT_LOG_MESSAGE(...) void(0)
+#define UXR_AGENT_LOG_MESSAGE_ENABLED() false
 #endif
 
 #endif // UXR_AGENT_LOGGER_LOGGER_HPP_
@@ -21,9 +21,38 @@
 #include <fastcdr/Cdr.h>
 #include <fastcdr/exceptions/Exception.h>
 
+#include <memory>
+
 namespace eprosima {
 namespace uxr {
 
+/**
+ * @brief Classification of a message, obtained from a single scan of its headers on reception.
+ *        It lets the receiver and the processor decide on a message without deserializing it again.
+ */
+struct MessageSummary
+{
+    dds::xrce::SessionId session_id = 0;
+    dds::xrce::StreamId stream_id = 0;
+    uint16_t submessage_count = 0;
+    dds::xrce::SubmessageId first_submessage_id = dds::xrce::CREATE_CLIENT;
+    /* One bit per submessage kind found, indexed by its id. */
+    uint32_t submessage_kinds = 0;
+    bool valid = false;
+
+    bool has(
+            dds::xrce::SubmessageId submessage_id) const
+    {
+        return (32 > submessage_id) && (0 != (submessage_kinds & (uint32_t(1) << submessage_id)));
+    }
+
+    bool is_only(
+            dds::xrce::SubmessageId submessage_id) const
+    {
+        return valid && (1 == submessage_count) && (submessage_id == first_submessage_id);
+    }
+};
+
 class InputMessage
 {
 public:
@@ -38,10 +67,21 @@ public:
           deserializer_(fastbuffer_, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::CdrVersion::XCDRv1)
     {
         memcpy(buf_, buf, len);
+        scan();
+    }
 
-        // A valid XRCE message must have a valid header and at least 1 submessage
-        valid_xrce_message_ = deserialize(header_);
-        valid_xrce_message_ = valid_xrce_message_ && count_submessages() > 0;
+    /* Takes the ownership of an already filled buffer, such as a reassembled fragmented message. */
+    InputMessage(
+            std::unique_ptr<uint8_t[]>&& buf,
+            size_t len)
+        : buf_(buf.release()),
+          len_(len),
+          header_(),
+          subheader_(),
+          fastbuffer_(reinterpret_cast<char*>(buf_), len_),
+          deserializer_(fastbuffer_, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::CdrVersion::XCDRv1)
+    {
+        scan();
     }
 
     uint8_t* get_buf() const { return buf_; }
@@ -71,13 +111,17 @@ public:
 
     bool prepare_next_submessage();
 
-    size_t count_submessages();
+    size_t count_submessages() const { return summary_.submessage_count; }
 
-    bool is_valid_xrce_message() { return valid_xrce_message_; }
+    bool is_valid_xrce_message() const { return summary_.valid; }
 
-    dds::xrce::SubmessageId get_submessage_id();
+    dds::xrce::SubmessageId get_submessage_id() const { return summary_.first_submessage_id; }
+
+    const MessageSummary& get_summary() const { return summary_; }
 
 private:
+    void scan();
+
     template<class T>
     bool deserialize(T& data);
 
@@ -90,7 +134,7 @@ private:
     dds::xrce::SubmessageHeader subheader_;
     fastcdr::FastBuffer fastbuffer_;
     fastcdr::Cdr deserializer_;
-    bool valid_xrce_message_ = false;
+    MessageSummary summary_;
 };
 
 inline bool InputMessage::prepare_next_submessage()
@@ -111,54 +155,36 @@ inline bool InputMessage::prepare_next_submessage()
     return rv;
 }
 
-inline size_t InputMessage::count_submessages()
+inline void InputMessage::scan()
 {
-    fastcdr::Cdr local_deserializer(fastbuffer_, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::CdrVersion::XCDRv1);
-    dds::xrce::MessageHeader local_header;
-    dds::xrce::SubmessageHeader local_subheader;
-
-    local_header.deserialize(local_deserializer);
-
-    bool rv = false;
-    size_t count = 0;
-
-    do
+    /* A valid XRCE message must have a valid header and at least 1 submessage. */
+    if (deserialize(header_))
     {
-        local_deserializer.jump((4 - ((local_deserializer.get_current_position() - local_deserializer.get_buffer_pointer()) & 3)) & 3);
-        if (fastbuffer_.getBufferSize() > local_deserializer.get_serialized_data_length())
+        summary_.session_id = header_.session_id();
+        summary_.stream_id = header_.stream_id();
+
+        /* Walk the subheaders in place, skipping the payloads without deserializing them. */
+        const size_t subheader_size = 4;
+        size_t offset = deserializer_.get_serialized_data_length();
+        while (len_ >= offset + subheader_size)
         {
-            try
+            const dds::xrce::SubmessageId submessage_id = dds::xrce::SubmessageId(buf_[offset]);
+            const uint16_t submessage_length = uint16_t(buf_[offset + 2] | (buf_[offset + 3] << 8));
+            if (0 == summary_.submessage_count)
             {
-                local_subheader.deserialize(local_deserializer);
-                count++;
+                summary_.first_submessage_id = submessage_id;
             }
-            catch(eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+            if (32 > submessage_id)
             {
-                rv = false;
+                summary_.submessage_kinds |= uint32_t(1) << submessage_id;
             }
-        } else {
-            rv = false;
-        }
-    } while (rv);
+            ++summary_.submessage_count;
 
-    return count;
-}
-
-inline dds::xrce::SubmessageId InputMessage::get_submessage_id()
-{
-    fastcdr::Cdr local_deserializer(fastbuffer_, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::CdrVersion::XCDRv1);
-    dds::xrce::MessageHeader local_header;
-    dds::xrce::SubmessageHeader local_subheader;
-
-    local_header.deserialize(local_deserializer);
-
-    local_deserializer.jump((4 - ((local_deserializer.get_current_position() - local_deserializer.get_buffer_pointer()) & 3)) & 3);
-    if (fastbuffer_.getBufferSize() > local_deserializer.get_serialized_data_length())
-    {
-        local_subheader.deserialize(local_deserializer);
+            offset += subheader_size + submessage_length;
+            offset += (4 - (offset & 3)) & 3;
+        }
+        summary_.valid = (0 < summary_.submessage_count);
     }
-
-    return local_subheader.submessage_id();
 }
 
 template<class T>
@@ -22,6 +22,10 @@
 #include <fastcdr/Cdr.h>
 #include <fastcdr/exceptions/Exception.h>
 
+#include <cstring>
+#include <memory>
+#include <mutex>
+
 namespace eprosima {
 namespace uxr {
 
@@ -39,6 +43,32 @@ public:
         serialize(header);
     }
 
+    /**
+     * @brief Builds a fragment message made of the message header and the fragment subheader, followed
+     *        by a view of a serialized submessage shared by all its fragments. The payload is not copied:
+     *        it is sent as a second segment by the transports that support scatter-gather.
+     * @param header Message header.
+     * @param subheader Fragment subheader.
+     * @param payload Pointer into the shared serialized submessage, sharing its ownership.
+     * @param payload_len Length of the fragment payload.
+     */
+    OutputMessage(
+            const dds::xrce::MessageHeader& header,
+            const dds::xrce::SubmessageHeader& subheader,
+            std::shared_ptr<const uint8_t> payload,
+            size_t payload_len)
+        : buf_(new uint8_t[header.getCdrSerializedSize() + 3 + subheader.getCdrSerializedSize()]{0}),
+          len_(header.getCdrSerializedSize() + 3 + subheader.getCdrSerializedSize()),
+          fastbuffer_(reinterpret_cast<char*>(buf_), len_),
+          serializer_(fastbuffer_, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::CdrVersion::XCDRv1),
+          payload_(std::move(payload)),
+          payload_len_(payload_len)
+    {
+        serialize(header);
+        serializer_.jump((4 - ((serializer_.get_current_position() - serializer_.get_buffer_pointer()) & 3)) & 3);
+        serialize(subheader);
+    }
+
     ~OutputMessage()
     {
         delete[] buf_;
@@ -49,9 +79,43 @@ public:
     OutputMessage& operator=(OutputMessage&&) = delete;
     OutputMessage& operator=(const OutputMessage&) = delete;
 
-    uint8_t* get_buf() const { return buf_; }
+    /**
+     * @brief Contiguous view of the whole message. For fragment messages the payload is copied once
+     *        after the header, on the first call, so prefer the segments on the send path.
+     */
+    uint8_t* get_buf() const
+    {
+        if (0 == payload_len_)
+        {
+            return buf_;
+        }
+        std::call_once(flat_flag_, [&]()
+        {
+            const size_t head_len = get_head_len();
+            flat_buf_.reset(new uint8_t[head_len + payload_len_]);
+            std::memcpy(flat_buf_.get(), buf_, head_len);
+            std::memcpy(flat_buf_.get() + head_len, payload_.get(), payload_len_);
+        });
+        return flat_buf_.get();
+    }
+
+    size_t get_len() const { return get_head_len() + payload_len_; }
+
+    /**
+     * @brief Segments of the message: the header, serialized in place, and the optional shared payload.
+     */
+    const uint8_t* get_head_buf() const { return buf_; }
+
+    size_t get_head_len() const { return serializer_.get_serialized_data_length(); }
+
+    const uint8_t* get_payload_buf() const { return payload_.get(); }
+
+    size_t get_payload_len() const { return payload_len_; }
 
-    size_t get_len() const { return serializer_.get_serialized_data_length(); }
+    /**
+     * @brief Stream of the message, from its header.
+     */
+    dds::xrce::StreamId get_stream_id() const { return buf_[1]; }
 
     template<class T>
     bool append_submessage(
@@ -86,6 +150,10 @@ private:
     size_t len_;
     fastcdr::FastBuffer fastbuffer_;
     fastcdr::Cdr serializer_;
+    std::shared_ptr<const uint8_t> payload_;
+    size_t payload_len_ = 0;
+    mutable std::once_flag flat_flag_;
+    mutable std::unique_ptr<uint8_t[]> flat_buf_;
 };
 
 template<class T>
@@ -46,6 +46,15 @@ public:
     #endif
     };
 
+    /**
+     * @brief View of a serialized sample owned by the caller.
+     */
+    struct Sample
+    {
+        const uint8_t* buf;
+        size_t len;
+    };
+
     Middleware() = default;
     Middleware(
             bool intraprocess_enabled)
@@ -192,6 +201,35 @@ public:
             uint16_t datawriter_id,
             const std::vector<uint8_t>& data) = 0;
 
+    /**
+     * @brief Writes a sample from a caller-owned buffer. Middlewares able to take the bytes directly
+     *        override it to skip the intermediate vector.
+     */
+    virtual bool write_data(
+            uint16_t datawriter_id,
+            const uint8_t* buf,
+            size_t len)
+    {
+        return write_data(datawriter_id, std::vector<uint8_t>(buf, buf + len));
+    }
+
+    /**
+     * @brief Writes several samples in a row, stopping at the first failure.
+     * @return The number of samples written.
+     */
+    virtual size_t write_batch(
+            uint16_t datawriter_id,
+            const Sample* samples,
+            size_t count)
+    {
+        size_t written = 0;
+        while (written < count && write_data(datawriter_id, samples[written].buf, samples[written].len))
+        {
+            ++written;
+        }
+        return written;
+    }
+
     virtual bool write_request(
             uint16_t requester_id,
             uint32_t sequence_number,
@@ -15,7 +15,10 @@
 #ifndef UXR_AGENT_MIDDLEWARE_CED_CED_ENTITIES_HPP_
 #define UXR_AGENT_MIDDLEWARE_CED_CED_ENTITIES_HPP_
 
+#include <uxr/agent/middleware/Middleware.hpp>
 #include <uxr/agent/utils/SeqNum.hpp>
+#include <uxr/agent/utils/CorrelationTable.hpp>
+#include <uxr/agent/types/XRCETypes.hpp>
 
 #include <string>
 #include <array>
@@ -62,12 +65,15 @@ enum class ReadAccess : uint8_t
  * CedTopicManager
  **********************************************************************************************************************/
 class CedGlobalTopic;
+class CedGlobalService;
 typedef const std::function<void (int16_t)> OnNewDomain;
 typedef const std::function<void (int16_t, const std::string&)> OnNewTopic;
+typedef const std::function<void (int16_t, const std::string&, bool)> OnTopicInterest;
 
 class CedTopicManager
 {
     friend class CedGlobalTopic;
+    friend class CedGlobalService;
 public:
     static void register_on_new_domain_cb(
             uint32_t key,
@@ -83,11 +89,34 @@ public:
     static void unregister_on_new_topic_cb(
             uint32_t key);
 
+    /**
+     * @brief Register a callback notified when a topic gets its first local DataReader (true)
+     *        and when it loses the last one (false). Topics with local DataReaders at the time
+     *        of the registration are notified immediately.
+     */
+    static void register_on_topic_interest_cb(
+            uint32_t key,
+            const OnTopicInterest& on_topic_interest_cb);
+
+    static void unregister_on_topic_interest_cb(
+            uint32_t key);
+
     static bool register_topic(
             const std::string& topic_name,
             int16_t domain_id,
             std::shared_ptr<CedGlobalTopic>& topic);
 
+    /**
+     * @brief Registers a service, or gets the registered one if its types match.
+     *        An empty type matches any other.
+     */
+    static bool register_service(
+            const std::string& service_name,
+            int16_t domain_id,
+            const std::string& request_type,
+            const std::string& reply_type,
+            std::shared_ptr<CedGlobalService>& service);
+
 private:
     CedTopicManager() = default;
     ~CedTopicManager() = default;
@@ -96,10 +125,16 @@ private:
             const std::string& topic_name,
             int16_t domain_id);
 
+    static bool unregister_service(
+            const std::string& service_name,
+            int16_t domain_id);
+
 private:
     static std::unordered_map<uint32_t, OnNewDomain> on_new_domain_map_;
     static std::unordered_map<uint32_t, OnNewTopic> on_new_topic_map_;
+    static std::unordered_map<uint32_t, OnTopicInterest> on_topic_interest_map_;
     static std::unordered_map<int16_t, std::unordered_map<std::string, std::weak_ptr<CedGlobalTopic>>> topics_;
+    static std::unordered_map<int16_t, std::unordered_map<std::string, std::weak_ptr<CedGlobalService>>> services_;
     static std::mutex mtx_;
 };
 
@@ -108,6 +143,7 @@ private:
  **********************************************************************************************************************/
 class CedGlobalTopic
 {
+    friend class CedTopicManager;
     friend class CedDataReader;
     friend class CedDataWriter;
 public:
@@ -121,7 +157,20 @@ public:
 
 private:
     bool write(
-            const std::vector<uint8_t>& data,
+            const uint8_t* buf,
+            size_t len,
+            WriteAccess write_access,
+            TopicSource topic_src,
+            uint8_t& errcode);
+
+    /*
+     * Writes at most one history worth of samples under the lock, so that readers are notified
+     * before the samples of a longer batch wrap around the history. Returns the samples written,
+     * CedMiddleware::write_batch calls it again for the rest.
+     */
+    size_t write(
+            const Middleware::Sample* samples,
+            size_t count,
             WriteAccess write_access,
             TopicSource topic_src,
             uint8_t& errcode);
@@ -146,9 +195,17 @@ private:
             SeqNum& last_read,
             ReadAccess read_access);
 
+    /* Local DataReaders are the ones with complete read access, i.e. not bridging to other Agents. */
+    void add_reader(
+            ReadAccess read_access);
+
+    void remove_reader(
+            ReadAccess read_access);
+
 private:
     const std::string name_;
     int16_t domain_id_;
+    size_t local_readers_; // Guarded by CedTopicManager::mtx_.
     SeqNum last_write_;
     std::mutex mtx_;
     std::condition_variable cv_;
@@ -156,6 +213,90 @@ private:
     std::array<TopicSource, 16> srcs_; // TODO (review history size)
 };
 
+/**********************************************************************************************************************
+ * CedGlobalService
+ **********************************************************************************************************************/
+class CedGlobalService
+{
+    friend class CedTopicManager;
+    friend class CedRequester;
+    friend class CedReplier;
+public:
+    CedGlobalService(
+            const std::string& service_name,
+            int16_t domain_id,
+            const std::string& request_type,
+            const std::string& reply_type);
+
+    ~CedGlobalService();
+
+    const std::string& name() const;
+
+    bool match(
+            const std::string& request_type,
+            const std::string& reply_type) const;
+
+private:
+    /* Requests carry the requester that sent them, replies the requester they are addressed to. */
+    struct Sample
+    {
+        std::vector<uint8_t> data;
+        uint32_t requester;
+        uint64_t sequence;
+    };
+
+    /*
+     * Keep-last history shared by every requester of the service: a write overwrites the oldest
+     * sample, and a reader lapped by the writer resumes from the oldest sample still kept.
+     * The size divides the range of SeqNum so that the slots stay aligned across its wrap-around.
+     */
+    static_assert((CED_SERVICE_HISTORY_SIZE & (CED_SERVICE_HISTORY_SIZE - 1)) == 0,
+            "CED_SERVICE_HISTORY_SIZE shall be a power of two.");
+
+    struct History
+    {
+        SeqNum last_write;
+        std::condition_variable cv;
+        std::array<Sample, CED_SERVICE_HISTORY_SIZE> samples;
+    };
+
+    uint32_t add_requester();
+
+    void write(
+            History& history,
+            const uint8_t* buf,
+            size_t len,
+            uint32_t requester,
+            uint64_t sequence);
+
+    /**
+     * @brief Reads the next sample of a history as CedGlobalTopic::read does.
+     *        A requester other than 0 skips the samples of the other requesters.
+     */
+    bool read(
+            History& history,
+            uint32_t requester,
+            Sample& sample,
+            SeqNum& last_read,
+            std::chrono::milliseconds timeout);
+
+    bool get_sample(
+            History& history,
+            uint32_t requester,
+            Sample& sample,
+            SeqNum& last_read);
+
+private:
+    const std::string name_;
+    int16_t domain_id_;
+    std::string request_type_; // Guarded by CedTopicManager::mtx_.
+    std::string reply_type_; // Guarded by CedTopicManager::mtx_.
+    uint32_t last_requester_;
+    std::mutex mtx_;
+    History requests_;
+    History replies_;
+};
+
 /**********************************************************************************************************************
  * CedParticipant
  **********************************************************************************************************************/
@@ -263,7 +404,13 @@ public:
     ~CedDataWriter() = default;
 
     bool write(
-        const std::vector<uint8_t>& data,
+        const uint8_t* buf,
+        size_t len,
+        uint8_t& errcode) const;
+
+    size_t write(
+        const Middleware::Sample* samples,
+        size_t count,
         uint8_t& errcode) const;
 
     const std::string& topic_name() const { return topic_->get_global_topic()->name(); }
@@ -289,8 +436,14 @@ public:
         , topic_(topic)
         , last_read_(UINT16_MAX)
         , read_access_(read_access)
-    {}
-    ~CedDataReader() = default;
+    {
+        topic_->get_global_topic()->add_reader(read_access_);
+    }
+
+    ~CedDataReader()
+    {
+        topic_->get_global_topic()->remove_reader(read_access_);
+    }
 
     bool read(
             std::vector<uint8_t>& data,
@@ -306,6 +459,99 @@ private:
     const ReadAccess read_access_;
 };
 
+/**********************************************************************************************************************
+ * CedRequester
+ **********************************************************************************************************************/
+class CedRequester
+{
+public:
+    CedRequester(
+            const std::shared_ptr<CedParticipant>& participant,
+            const std::shared_ptr<CedGlobalService>& service);
+    ~CedRequester() = default;
+
+    bool write(
+            uint32_t sequence_number,
+            const std::vector<uint8_t>& data);
+
+    bool read(
+            uint32_t& sequence_number,
+            std::vector<uint8_t>& data,
+            std::chrono::milliseconds timeout);
+
+    bool match(
+            const std::string& service_name,
+            const std::string& request_type,
+            const std::string& reply_type) const;
+
+    /**
+     * @brief The sample identity a replier gets along with the requests of this requester.
+     */
+    static void get_sample_identity(
+            uint32_t requester,
+            uint64_t sequence,
+            dds::SampleIdentity& sample_identity);
+
+    /**
+     * @brief Gets the requester and sequence of a sample identity.
+     * @return false if it does not come from a CedRequester.
+     */
+    static bool from_sample_identity(
+            const dds::SampleIdentity& sample_identity,
+            uint32_t& requester,
+            uint64_t& sequence);
+
+private:
+    const std::shared_ptr<CedParticipant> participant_;
+    const std::shared_ptr<CedGlobalService> service_;
+    const uint32_t requester_;
+    uint64_t last_sequence_;
+    SeqNum last_read_;
+    CedGlobalService::Sample sample_;
+    utils::CorrelationTable<uint32_t> pending_requests_;
+};
+
+/**********************************************************************************************************************
+ * CedReplier
+ **********************************************************************************************************************/
+class CedReplier
+{
+public:
+    CedReplier(
+            const std::shared_ptr<CedParticipant>& participant,
+            const std::shared_ptr<CedGlobalService>& service)
+        : participant_(participant)
+        , service_(service)
+        , last_read_(UINT16_MAX)
+        , sample_{}
+    {}
+    ~CedReplier() = default;
+
+    /**
+     * @brief Writes a reply, which is prefixed by the sample identity of its request.
+     */
+    bool write(
+            const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Reads a request, prefixed by its sample identity as the FastDDSReplier does.
+     */
+    bool read(
+            std::vector<uint8_t>& data,
+            std::chrono::milliseconds timeout);
+
+    bool match(
+            const std::string& service_name,
+            const std::string& request_type,
+            const std::string& reply_type) const;
+
+private:
+    const std::shared_ptr<CedParticipant> participant_;
+    const std::shared_ptr<CedGlobalService> service_;
+    SeqNum last_read_;
+    CedGlobalService::Sample sample_;
+};
+
 } // namespace uxr
 } // namespace eprosima
 
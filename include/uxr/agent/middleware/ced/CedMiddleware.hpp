@@ -257,82 +257,82 @@ public:
             const dds::xrce::OBJK_DataReader_Binary& datareader_xrce) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param requester_id 
-     * @param participant_id 
-     * @param ref 
-     * @return false 
+     * @brief Creates a CedRequester associated to a CedParticipant from a reference.
+     *        Currently, the ref parameter is used as service name, and the types are left unset.
+     * @param requester_id      The CedRequester identifier.
+     * @param participant_id    The CedParticipant identifier to which the CedRequester is associated.
+     * @param ref               The CedRequester reference. Currently, it is used as the service name.
+     * @return  true in case of creation and false in other case.
      */
     bool create_requester_by_ref(
-            uint16_t,
-            uint16_t,
-            const std::string&) override { return false; };
+            uint16_t requester_id,
+            uint16_t participant_id,
+            const std::string& ref) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param requester_id 
-     * @param participant_id 
-     * @param xml
-     * @return false 
+     * @brief Creates a CedRequester associated to a CedParticipant from an XML.
+     *        Currently, the xml parameter is used as service name, and the types are left unset.
+     * @param requester_id      The CedRequester identifier.
+     * @param participant_id    The CedParticipant identifier to which the CedRequester is associated.
+     * @param xml               The XML that describes the CedRequester. Currently, it is used as the service name.
+     * @return  true in case of creation and false in other case.
      */
     bool create_requester_by_xml(
-            uint16_t,
-            uint16_t,
-            const std::string&) override { return false; };
+            uint16_t requester_id,
+            uint16_t participant_id,
+            const std::string& xml) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param requester_id 
-     * @param participant_id 
-     * @param requester_xrce
-     * @return false 
+     * @brief Creates a CedRequester associated to a CedParticipant from a binary reference.
+     *        It fails if the service already exists in the Domain with other types.
+     * @param requester_id      The CedRequester identifier.
+     * @param participant_id    The CedParticipant identifier to which the CedRequester is associated.
+     * @param requester_xrce    XRCE Requester binary representation. The topic names are NOT USED.
+     * @return  true in case of creation and false in other case.
      */
     bool create_requester_by_bin(
-            uint16_t,
-            uint16_t,
-            const dds::xrce::OBJK_Requester_Binary&) override { return false; };
+            uint16_t requester_id,
+            uint16_t participant_id,
+            const dds::xrce::OBJK_Requester_Binary& requester_xrce) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param replier_id 
-     * @param participant_id 
-     * @param ref 
-     * @return false 
+     * @brief Creates a CedReplier associated to a CedParticipant from a reference.
+     *        Currently, the ref parameter is used as service name, and the types are left unset.
+     * @param replier_id        The CedReplier identifier.
+     * @param participant_id    The CedParticipant identifier to which the CedReplier is associated.
+     * @param ref               The CedReplier reference. Currently, it is used as the service name.
+     * @return  true in case of creation and false in other case.
      */
     bool create_replier_by_ref(
-            uint16_t,
-            uint16_t,
-            const std::string&) override { return false; };
+            uint16_t replier_id,
+            uint16_t participant_id,
+            const std::string& ref) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param replier_id 
-     * @param participant_id 
-     * @param xml
-     * @return false 
+     * @brief Creates a CedReplier associated to a CedParticipant from an XML.
+     *        Currently, the xml parameter is used as service name, and the types are left unset.
+     * @param replier_id        The CedReplier identifier.
+     * @param participant_id    The CedParticipant identifier to which the CedReplier is associated.
+     * @param xml               The XML that describes the CedReplier. Currently, it is used as the service name.
+     * @return  true in case of creation and false in other case.
      */
     bool create_replier_by_xml(
-            uint16_t,
-            uint16_t,
-            const std::string&) override { return false; };
+            uint16_t replier_id,
+            uint16_t participant_id,
+            const std::string& xml) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param replier_id 
-     * @param participant_id 
-     * @param replier_xrce
-     * @return false 
+     * @brief Creates a CedReplier associated to a CedParticipant from a binary reference.
+     *        It fails if the service already exists in the Domain with other types.
+     * @param replier_id        The CedReplier identifier.
+     * @param participant_id    The CedParticipant identifier to which the CedReplier is associated.
+     * @param replier_xrce      XRCE Replier binary representation. The topic names are NOT USED.
+     * @return  true in case of creation and false in other case.
      */
     bool create_replier_by_bin(
-            uint16_t,
-            uint16_t,
-            const dds::xrce::OBJK_Replier_Binary&) override { return false; };
+            uint16_t replier_id,
+            uint16_t participant_id,
+            const dds::xrce::OBJK_Replier_Binary& replier_xrce) override;
 
     /**
      * @brief Removes a CedParticipant from the participants register.
@@ -377,20 +377,18 @@ public:
     bool delete_datareader(uint16_t datareader_id) override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param requester_id 
-     * @return false 
+     * @brief Removes a CedRequester from the requesters register.
+     * @param requester_id  The CedRequester identifier.
+     * @return  true in case of the CedRequester was found and removed, false in other case.
      */
-    bool delete_requester(uint16_t) override { return false; };
+    bool delete_requester(uint16_t requester_id) override;
 
     /**
-     * @brief Not implemented
-     * 
-     * @param replier_id 
-     * @return false 
+     * @brief Removes a CedReplier from the repliers register.
+     * @param replier_id    The CedReplier identifier.
+     * @return  true in case of the CedReplier was found and removed, false in other case.
      */
-    bool delete_replier(uint16_t) override { return false; };
+    bool delete_replier(uint16_t replier_id) override;
 
     /**
      * @brief Writes data using the CedDataWriter identified by the datawriter_id parameter.
@@ -403,19 +401,53 @@ public:
             const std::vector<uint8_t>& data) override;
 
     /**
-     * @brief Not implemented.
+     * @brief Writes data from a caller-owned buffer, copying it straight into the topic history.
+     * @param datawriter_id The CedDataWriter identifier.
+     * @param buf           The data to be written.
+     * @param len           The length of the data.
+     * @return  true in case of successful writing and false in other case.
+     */
+    bool write_data(
+            uint16_t datawriter_id,
+            const uint8_t* buf,
+            size_t len) override;
+
+    /**
+     * @brief Writes several samples, locking the topic history once per history depth of samples
+     *        and notifying the readers in between. Like single writes, a batch longer than the
+     *        history keeps the last samples for the readers that have not caught up.
+     * @param datawriter_id The CedDataWriter identifier.
+     * @param samples       The samples to be written.
+     * @param count         The number of samples.
+     * @return  The number of samples written.
+     */
+    size_t write_batch(
+            uint16_t datawriter_id,
+            const Sample* samples,
+            size_t count) override;
+
+    /**
+     * @brief Writes a request using the CedRequester identified by the requester_id parameter.
+     * @param requester_id      The CedRequester identifier.
+     * @param sequence_number   The XRCE sequence number returned along with the reply.
+     * @param data              The request to be written.
+     * @return  true in case of successful writing and false in other case.
      */
     bool write_request(
-            uint16_t,
-            uint32_t,
-            const std::vector<uint8_t>&) override { return false; }
+            uint16_t requester_id,
+            uint32_t sequence_number,
+            const std::vector<uint8_t>& data) override;
 
     /**
-     * @brief Not implemented.
+     * @brief Writes a reply using the CedReplier identified by the replier_id parameter.
+     *        The reply is delivered only to the CedRequester of the sample identity it starts with.
+     * @param replier_id    The CedReplier identifier.
+     * @param data          The sample identity of the request followed by the reply.
+     * @return  true in case of successful writing and false in other case.
      */
     bool write_reply(
-            uint16_t,
-            const std::vector<uint8_t>&) override { return false; }
+            uint16_t replier_id,
+            const std::vector<uint8_t>& data) override;
 
     /**
      * @brief Read data using the CedDataReader identified by the datareader_id paramenter.
@@ -431,21 +463,32 @@ public:
             std::chrono::milliseconds timeout) override;
 
     /**
-     * @brief Not implemented.
+     * @brief Reads a request using the CedReplier identified by the replier_id parameter.
+     *        This is a blocking function that will block at most "timeout" milleseconds.
+     * @param replier_id    The CedReplier identifier.
+     * @param data          The sample identity of the request followed by the request.
+     * @param timeout       The timeout (milliseconds) of the reading.
+     * @return  true in case of successful reading and false in other case.
      */
     bool read_request(
-            uint16_t,
-            std::vector<uint8_t>&,
-            std::chrono::milliseconds) override { return false; };
+            uint16_t replier_id,
+            std::vector<uint8_t>& data,
+            std::chrono::milliseconds timeout) override;
 
     /**
-     * @brief Not implemented.
+     * @brief Reads a reply using the CedRequester identified by the requester_id parameter.
+     *        This is a blocking function that will block at most "timeout" milleseconds.
+     * @param requester_id      The CedRequester identifier.
+     * @param sequence_number   The sequence number given when the request was written.
+     * @param data              The reply read.
+     * @param timeout           The timeout (milliseconds) of the reading.
+     * @return  true in case of successful reading and false in other case.
      */
     bool read_reply(
-            uint16_t,
-            uint32_t&,
-            std::vector<uint8_t>&,
-            std::chrono::milliseconds) override { return false; };
+            uint16_t requester_id,
+            uint32_t& sequence_number,
+            std::vector<uint8_t>& data,
+            std::chrono::milliseconds timeout) override;
 
     /**
      * @brief Checks whether an existing CedParticipant, identified by the participant_id, matches with a new
@@ -610,70 +653,80 @@ public:
             const dds::xrce::OBJK_DataReader_Binary&  datareader_xrce) const override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param participant_id 
-     * @param ref 
-     * @return false 
+     * @brief Checks whether an existing CedRequester, identified by the requester_id, matches with the new
+     *        CedRequester that would result from the creation of a new one using the reference representation.
+     *        It is considered that the CedRequesters match if both are associated to the same service.
+     * @param requester_id  The existing CedRequester identifier.
+     * @param ref           The reference that represents the new CedRequester.
+     *                      It defines the service name.
+     * @return true if both CedRequester have associated the same service name.
      */
     bool matched_requester_from_ref(
-            uint16_t,
-            const std::string&) const override { return false; };
+            uint16_t requester_id,
+            const std::string& ref) const override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param participant_id 
-     * @param xml 
-     * @return false 
+     * @brief Checks whether an existing CedRequester, identified by the requester_id, matches with the new
+     *        CedRequester that would result from the creation of a new one using the XML representation.
+     *        It is considered that the CedRequesters match if both are associated to the same service.
+     * @param requester_id  The existing CedRequester identifier.
+     * @param xml           The XML that describes the new CedRequester.
+     *                      It defines the service name.
+     * @return true if both CedRequester have associated the same service name.
      */
     bool matched_requester_from_xml(
-            uint16_t,
-            const std::string&) const override { return false; };
-   
+            uint16_t requester_id,
+            const std::string& xml) const override;
+
     /**
-     * @brief Not implemented.
-     * 
-     * @param requester_id 
-     * @param requester_xrce 
-     * @return false 
+     * @brief Checks whether an existing CedRequester, identified by the requester_id, matches with the new
+     *        CedRequester that would result from the creation of a new one using the binary reference.
+     *        It is considered that the CedRequesters match if both have the same service name and types.
+     * @param requester_id      The existing CedRequester identifier.
+     * @param requester_xrce    XRCE Requester binary representation.
+     * @return true if both CedRequester have the same service name and types.
      */
     bool matched_requester_from_bin(
-            uint16_t,
-            const dds::xrce::OBJK_Requester_Binary&) const override { return false; };
+            uint16_t requester_id,
+            const dds::xrce::OBJK_Requester_Binary& requester_xrce) const override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param participant_id 
-     * @param ref 
-     * @return false 
+     * @brief Checks whether an existing CedReplier, identified by the replier_id, matches with the new
+     *        CedReplier that would result from the creation of a new one using the reference representation.
+     *        It is considered that the CedRepliers match if both are associated to the same service.
+     * @param replier_id    The existing CedReplier identifier.
+     * @param ref           The reference that represents the new CedReplier.
+     *                      It defines the service name.
+     * @return true if both CedReplier have associated the same service name.
      */
     bool matched_replier_from_ref(
-            uint16_t,
-            const std::string&) const override { return false; };
+            uint16_t replier_id,
+            const std::string& ref) const override;
 
     /**
-     * @brief Not implemented.
-     * 
-     * @param participant_id 
-     * @param xml 
-     * @return false 
+     * @brief Checks whether an existing CedReplier, identified by the replier_id, matches with the new
+     *        CedReplier that would result from the creation of a new one using the XML representation.
+     *        It is considered that the CedRepliers match if both are associated to the same service.
+     * @param replier_id    The existing CedReplier identifier.
+     * @param xml           The XML that describes the new CedReplier.
+     *                      It defines the service name.
+     * @return true if both CedReplier have associated the same service name.
      */
     bool matched_replier_from_xml(
-            uint16_t,
-            const std::string&) const override { return false; };
-    
+            uint16_t replier_id,
+            const std::string& xml) const override;
+
     /**
-     * @brief Not implemented.
-     * 
-     * @param replier_id 
-     * @param replier_xrce 
-     * @return false 
+     * @brief Checks whether an existing CedReplier, identified by the replier_id, matches with the new
+     *        CedReplier that would result from the creation of a new one using the binary reference.
+     *        It is considered that the CedRepliers match if both have the same service name and types.
+     * @param replier_id    The existing CedReplier identifier.
+     * @param replier_xrce  XRCE Replier binary representation.
+     * @return true if both CedReplier have the same service name and types.
      */
     bool matched_replier_from_bin(
-            uint16_t,
-            const dds::xrce::OBJK_Replier_Binary&) const override { return false; };
+            uint16_t replier_id,
+            const dds::xrce::OBJK_Replier_Binary& replier_xrce) const override;
 
 private:
     std::unordered_map<uint16_t, std::shared_ptr<CedParticipant>> participants_;
@@ -682,6 +735,8 @@ private:
     std::unordered_map<uint16_t, std::shared_ptr<CedSubscriber>> subscribers_;
     std::unordered_map<uint16_t, std::shared_ptr<CedDataWriter>> datawriters_;
     std::unordered_map<uint16_t, std::shared_ptr<CedDataReader>> datareaders_;
+    std::unordered_map<uint16_t, std::shared_ptr<CedRequester>> requesters_;
+    std::unordered_map<uint16_t, std::shared_ptr<CedReplier>> repliers_;
 
     TopicSource topics_src_;
     WriteAccess write_access_;
@@ -24,6 +24,8 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <uxr/agent/types/TopicPubSubType.hpp>
 #include <uxr/agent/types/XRCETypes.hpp>
+#include <uxr/agent/utils/CorrelationTable.hpp>
+#include <uxr/agent/config.hpp>
 
 #include <unordered_map>
 
@@ -341,7 +343,7 @@ public:
         , publisher_ptr_{nullptr}
         , subscriber_ptr_{nullptr}
         , publisher_id_{}
-        , sequence_to_sequence_{}
+        , pending_requests_{REQUESTER_TABLE_SIZE, REQUESTER_TABLE_TIMEOUT}
     {}
 
     ~FastDDSRequester();
@@ -372,6 +374,11 @@ public:
 
     const fastdds::dds::DataReader* get_reply_datareader() const;
 
+    /**
+     * @brief Requests awaiting their reply, with the counters of the ones evicted without it.
+     */
+    const utils::CorrelationTable<uint32_t>& get_pending_requests() const { return pending_requests_; }
+
 private:
     std::shared_ptr<FastDDSParticipant> participant_;
 
@@ -388,7 +395,8 @@ private:
     fastdds::dds::DataReader* datareader_ptr_;
 
     dds::GUID_t publisher_id_;
-    std::map<int64_t, uint32_t> sequence_to_sequence_;
+    /* Written from the processing thread and read from the reader thread, it has its own lock. */
+    utils::CorrelationTable<uint32_t> pending_requests_;
 };
 
 /**********************************************************************************************************************
@@ -169,6 +169,8 @@ public:
 /**********************************************************************************************************************
  * Write/Read functions.
  **********************************************************************************************************************/
+    using Middleware::write_data;
+
     bool write_data(
             uint16_t datawriter_id,
             const std::vector<uint8_t>& data) override;
@@ -0,0 +1,132 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR__AGENT__MIDDLEWARE__FASTDDS__QOS_CACHE_HPP_
+#define UXR__AGENT__MIDDLEWARE__FASTDDS__QOS_CACHE_HPP_
+
+#include <fastdds/dds/core/detail/DDSReturnCode.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+
+#include <string>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief Process-wide cache of the QoS parsed from XML representations and from profile references.
+ *        Fleets of identical clients send the same XML strings on every creation and match, so the
+ *        results are kept per entity kind, keyed by the string, and the XML parser only runs on misses.
+ *        The getters mirror the Fast DDS ones. The parsed QoS only depends on the string and on the
+ *        loaded profiles, so the cache is cleared whenever a new profiles file is loaded.
+ */
+class FastDDSQosCache
+{
+public:
+    static fastdds::dds::ReturnCode_t get_participant_qos_from_xml(
+            fastdds::dds::DomainParticipantFactory* factory,
+            const std::string& xml,
+            fastdds::dds::DomainParticipantQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_participant_qos_from_profile(
+            fastdds::dds::DomainParticipantFactory* factory,
+            const std::string& ref,
+            fastdds::dds::DomainParticipantQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_participant_extended_qos_from_profile(
+            fastdds::dds::DomainParticipantFactory* factory,
+            const std::string& ref,
+            fastdds::dds::DomainParticipantExtendedQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_topic_qos_from_xml(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& xml,
+            fastdds::dds::TopicQos& qos,
+            std::string& topic_name,
+            std::string& type_name);
+
+    static fastdds::dds::ReturnCode_t get_topic_qos_from_profile(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& ref,
+            fastdds::dds::TopicQos& qos,
+            std::string& topic_name,
+            std::string& type_name);
+
+    static fastdds::dds::ReturnCode_t get_publisher_qos_from_xml(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& xml,
+            fastdds::dds::PublisherQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_subscriber_qos_from_xml(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& xml,
+            fastdds::dds::SubscriberQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_datawriter_qos_from_xml(
+            fastdds::dds::Publisher* publisher,
+            const std::string& xml,
+            fastdds::dds::DataWriterQos& qos,
+            std::string& topic_name);
+
+    static fastdds::dds::ReturnCode_t get_datawriter_qos_from_profile(
+            fastdds::dds::Publisher* publisher,
+            const std::string& ref,
+            fastdds::dds::DataWriterQos& qos,
+            std::string& topic_name);
+
+    static fastdds::dds::ReturnCode_t get_datareader_qos_from_xml(
+            fastdds::dds::Subscriber* subscriber,
+            const std::string& xml,
+            fastdds::dds::DataReaderQos& qos,
+            std::string& topic_name);
+
+    static fastdds::dds::ReturnCode_t get_datareader_qos_from_profile(
+            fastdds::dds::Subscriber* subscriber,
+            const std::string& ref,
+            fastdds::dds::DataReaderQos& qos,
+            std::string& topic_name);
+
+    static fastdds::dds::ReturnCode_t get_requester_qos_from_xml(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& xml,
+            fastdds::dds::RequesterQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_requester_qos_from_profile(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& ref,
+            fastdds::dds::RequesterQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_replier_qos_from_xml(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& xml,
+            fastdds::dds::ReplierQos& qos);
+
+    static fastdds::dds::ReturnCode_t get_replier_qos_from_profile(
+            fastdds::dds::DomainParticipant* participant,
+            const std::string& ref,
+            fastdds::dds::ReplierQos& qos);
+
+    /**
+     * @brief Drops every cached entry. Called after loading a profiles file, since it may redefine
+     *        profiles already cached.
+     */
+    static void clear();
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR__AGENT__MIDDLEWARE__FASTDDS__QOS_CACHE_HPP_
@@ -17,15 +17,17 @@
 
 #include <uxr/client/client.h>
 #include <array>
-#include <thread>
+#include <map>
+#include <deque>
+#include <vector>
 #include <set>
 #include <mutex>
-#include <atomic>
 
 namespace eprosima {
 namespace uxr {
 
 class Agent;
+class InternalClientManager;
 
 const uint8_t internal_client_history = 8; // TODO (julian): take from config.
 
@@ -34,20 +36,54 @@ class InternalClient
 public:
     InternalClient(
             Agent& agent,
+            InternalClientManager& manager,
             const std::array<uint8_t, 4>& ip,
             uint16_t port,
             uint32_t remote_client_key,
             uint32_t local_client_key);
 
-    ~InternalClient() = default;
+    ~InternalClient();
 
+    /**
+     * @brief Create the session with the remote Agent.
+     *        Must be called from the InternalClientManager loop.
+     */
     bool run();
 
+    /**
+     * @brief Close the session and unregister the CED callbacks.
+     */
     bool stop();
 
+    /**
+     * @brief Create pending entities and process the received messages without blocking.
+     *        Must be called from the InternalClientManager loop.
+     */
+    void spin();
+
+    /**
+     * @brief Queue a datagram received from the remote Agent, to be read by the session.
+     */
+    void push_message(
+            const uint8_t* buf,
+            size_t len);
+
+    bool pop_message(
+            uint8_t* buf,
+            size_t len,
+            size_t& message_len);
+
     Agent& get_agent() { return agent_; }
 
+    InternalClientManager& get_manager() { return manager_; }
+
+    const std::array<uint8_t, 4>& get_ip() const { return ip_; }
+
+    uint16_t get_port() const { return port_; }
+
 private:
+    void unregister_callbacks();
+
     void set_callback();
 
     void create_streams();
@@ -56,38 +92,42 @@ private:
 
     void create_topic_entities();
 
-    void loop();
+    void delete_topic_entities();
 
     void on_new_domain(int16_t domain);
 
-    void on_new_topic(
+    void on_topic_interest(
             int16_t domain_id,
-            const std::string& topic_name);
+            const std::string& topic_name,
+            bool interest);
 
 private:
     Agent& agent_;
+    InternalClientManager& manager_;
     std::array<uint8_t, 4> ip_;
     uint16_t port_;
 
     /* Domains. */
     std::set<int16_t> domains_;
+    /* Topics with local DataReaders, bridged from the remote Agent only while the interest lasts. */
     std::set<std::pair<int16_t, std::string>> topics_;
-    uint16_t topic_counter_;
+    std::set<std::pair<int16_t, std::string>> unsubscribed_topics_;
+    std::map<std::pair<int16_t, std::string>, uint16_t> bridged_topics_;
 
     /* Transport. */
-    uxrUDPTransport transport_;
+    uxrCustomTransport transport_;
+    std::deque<std::vector<uint8_t>> inbox_;
 
     /* Client. */
     uint32_t remote_client_key_;
     uint32_t local_client_key_;
     uxrSession session_;
-    uint8_t out_buffer_[UXR_CONFIG_UDP_TRANSPORT_MTU * internal_client_history];
-    uint8_t in_buffer_[UXR_CONFIG_UDP_TRANSPORT_MTU * internal_client_history];
+    uint8_t out_buffer_[UXR_CONFIG_CUSTOM_TRANSPORT_MTU * internal_client_history];
+    uint8_t in_buffer_[UXR_CONFIG_CUSTOM_TRANSPORT_MTU * internal_client_history];
     uxrStreamId out_stream_id_;
     uxrStreamId in_stream_id_;
 
-    std::atomic<bool> running_cond_;
-    std::thread thread_;
+    bool running_cond_;
     std::mutex mtx_;
 };
 
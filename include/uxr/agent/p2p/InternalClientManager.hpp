@@ -15,9 +15,15 @@
 #ifndef UXR_AGENT_P2P_INTERNAL_CLIENT_MANAGER_HPP_
 #define UXR_AGENT_P2P_INTERNAL_CLIENT_MANAGER_HPP_
 
+#include <array>
 #include <map>
 #include <mutex>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include <uxr/client/config.h>
 
 struct uxrAgentAddress;
 
@@ -27,6 +33,11 @@ namespace uxr {
 class InternalClient;
 class Agent;
 
+/**
+ * @brief Owner of the InternalClients connected to the remote Agents.
+ *        All the sessions share a single UDP socket and are driven from a single
+ *        epoll loop, which demultiplexes the incoming datagrams by remote address.
+ */
 class InternalClientManager
 {
 public:
@@ -35,13 +46,43 @@ public:
     void set_local_address(
             uint16_t port);
 
-    void create_client(
+    /**
+     * @brief Register a remote Agent. The session is created asynchronously by the loop.
+     * @return true if the remote Agent was not known yet, false otherwise.
+     */
+    bool create_client(
             Agent& agent,
             const std::array<uint8_t, 4>& ip,
             uint16_t port);
 
     void delete_clients();
 
+    /**
+     * @brief Wake up the loop, e.g. when an InternalClient has new entities to create.
+     */
+    void notify();
+
+    /**
+     * @brief Allocate the id of the Topic and DataWriter bridging a topic. All the InternalClients
+     *        create them under INTERNAL_CLIENT_KEY, so the ids are shared to keep them apart.
+     */
+    uint16_t next_entity_id();
+
+    size_t send_to(
+            InternalClient& client,
+            const uint8_t* buf,
+            size_t len);
+
+    /**
+     * @brief Read the next datagram of a client. If none is queued and timeout is not zero,
+     *        it waits on the shared socket, queueing the datagrams of any other client.
+     */
+    size_t recv_from(
+            InternalClient& client,
+            uint8_t* buf,
+            size_t len,
+            int timeout);
+
 private:
     InternalClientManager();
     ~InternalClientManager();
@@ -51,10 +92,41 @@ private:
     InternalClientManager& operator=(InternalClientManager&&) = delete;
     InternalClientManager& operator=(const InternalClientManager&) = delete;
 
+    bool init();
+
+    bool fini();
+
+    void loop();
+
+    void start_pending_clients();
+
+    bool read_socket(
+            InternalClient* target,
+            uint8_t* buf,
+            size_t len,
+            size_t& message_len);
+
+    static uint64_t peer_id(
+            const std::array<uint8_t, 4>& ip,
+            uint16_t port);
+
 private:
+    static constexpr int idle_timeout = 1000;
+
     std::mutex mtx_;
     uint32_t local_client_key_;
     std::map<uint32_t, std::unique_ptr<InternalClient>> clients_;
+    std::vector<InternalClient*> pending_clients_;
+    std::vector<InternalClient*> running_clients_;
+    std::map<uint64_t, InternalClient*> peers_;
+    std::atomic<uint16_t> entity_counter_;
+
+    int socket_fd_;
+    int epoll_fd_;
+    int event_fd_;
+    std::thread thread_;
+    std::atomic<bool> running_cond_;
+    std::array<uint8_t, UXR_CONFIG_CUSTOM_TRANSPORT_MTU> buffer_;
 };
 
 } // namespace uxr
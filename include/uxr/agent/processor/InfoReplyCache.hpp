@@ -0,0 +1,78 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_PROCESSOR_INFO_REPLY_CACHE_HPP_
+#define UXR_AGENT_PROCESSOR_INFO_REPLY_CACHE_HPP_
+
+#include <uxr/agent/message/Packet.hpp>
+#include <uxr/agent/types/XRCETypes.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief Pre-serialized INFO submessage payload, answered to GET_INFO requests.
+ *        Only the related request and the implementation status are patched per reply.
+ *        The payload is serialized once per header layout (with or without client key)
+ *        so its CDR alignment matches the final message.
+ */
+class InfoReplyCache
+{
+public:
+    InfoReplyCache() = default;
+
+    /**
+     * @brief Serializes the INFO payload for the given object info, replacing the previous one.
+     * @param object_info Agent info, including its activity and configuration.
+     */
+    void build(
+            const dds::xrce::ObjectInfo& object_info);
+
+    /**
+     * @brief Whether the cache has been built.
+     */
+    bool ready() const { return !payloads_[0].empty(); }
+
+    /**
+     * @brief Creates an INFO message from the cached payload.
+     * @param header Header of the reply.
+     * @param request Related GET_INFO request.
+     * @param implementation_status Implementation status of the result.
+     * @param message Output message.
+     * @return true if the message was created, false otherwise.
+     */
+    bool make_reply(
+            const dds::xrce::MessageHeader& header,
+            const dds::xrce::BaseObjectRequest& request,
+            uint8_t implementation_status,
+            OutputMessagePtr& message) const;
+
+private:
+    static size_t layout_index(
+            const dds::xrce::MessageHeader& header)
+    {
+        return (128 > header.session_id()) ? 1 : 0;
+    }
+
+    std::array<std::vector<uint8_t>, 2> payloads_;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_PROCESSOR_INFO_REPLY_CACHE_HPP_
@@ -16,6 +16,8 @@
 #define UXR_AGENT_PROCESSOR_PROCESSOR_HPP_
 
 #include <uxr/agent/middleware/Middleware.hpp>
+#include <uxr/agent/processor/InfoReplyCache.hpp>
+#include <uxr/agent/utils/RateLimiter.hpp>
 
 #include <cstdint>
 #include <vector>
@@ -68,9 +70,20 @@ public:
 
     bool process_get_info_packet(
             InputPacket<IPv4EndPoint>&& input_packet,
-            std::vector<dds::xrce::TransportAddress>& address,
+            const InfoReplyCache& info_cache,
             OutputPacket<IPv4EndPoint>& output_packet) const;
 
+    /**
+     * @brief Answers an out of session GET_INFO packet straight away, bypassing the input queue.
+     * @return true if the packet was an out of session GET_INFO and has been consumed.
+     */
+    bool answer_get_info_packet(
+            InputPacket<EndPoint>& input_packet);
+
+    void build_info_cache(
+            const std::vector<dds::xrce::TransportAddress>& address,
+            InfoReplyCache& info_cache) const;
+
     void check_heartbeats();
 
 private:
@@ -130,10 +143,17 @@ private:
             const std::vector<uint8_t>& buffer,
             std::chrono::milliseconds timeout);
 
+    bool read_credit_callback(
+            const WriteFnArgs& write_args,
+            size_t data_size,
+            std::chrono::milliseconds timeout);
+
 private:
     Server<EndPoint>& server_;
     Middleware::Kind middleware_kind_;
     Root& root_;
+    InfoReplyCache info_cache_;
+    mutable utils::RateLimiter<EndPoint> info_rate_limiter_;
 };
 
 } // namespace uxr
@@ -17,6 +17,7 @@
 
 #include <uxr/agent/types/XRCETypes.hpp>
 #include <uxr/agent/utils/TokenBucket.hpp>
+#include <uxr/agent/utils/ThreadSettings.hpp>
 
 #include <atomic>
 #include <thread>
@@ -44,6 +45,7 @@ class Reader
 public:
     typedef const std::function<bool (RA, std::vector<uint8_t>&, std::chrono::milliseconds)> ReadFn;
     typedef const std::function<bool (WA, const std::vector<uint8_t>&, std::chrono::milliseconds)> WriteFn;
+    typedef const std::function<bool (WA, size_t, std::chrono::milliseconds)> CreditFn;
 
 public:
     ~Reader();
@@ -53,14 +55,16 @@ public:
         ReadFn read_fn,
         RA read_args,
         WriteFn write_fn,
-        WA write_args);
+        WA write_args,
+        CreditFn credit_fn = nullptr);
 
     bool stop_reading();
 
 private:
     void read_task(
         ReadFn read_fn,
-        WriteFn write_fn);
+        WriteFn write_fn,
+        CreditFn credit_fn);
 
 private:
     dds::xrce::DataDeliveryControl delivery_control_;
@@ -89,7 +93,8 @@ inline bool Reader<RA, WA>::start_reading(
         ReadFn read_fn,
         RA read_args,
         WriteFn write_fn,
-        WA write_args)
+        WA write_args,
+        CreditFn credit_fn)
 {
     std::lock_guard<std::mutex> lock(mtx_);
     bool rv = false;
@@ -99,7 +104,7 @@ inline bool Reader<RA, WA>::start_reading(
         read_args_ = read_args;
         write_args_ = write_args;
         running_cond_ = true;
-        thread_ = std::thread(&Reader<RA, WA>::read_task, this, read_fn, write_fn);
+        thread_ = std::thread(&Reader<RA, WA>::read_task, this, read_fn, write_fn, credit_fn);
         rv = true;
     }
     return rv;
@@ -128,11 +133,14 @@ inline bool Reader<RA, WA>::stop_reading()
 template<typename RA, typename WA>
 inline void Reader<RA, WA>::read_task(
         ReadFn read_fn,
-        WriteFn write_fn)
+        WriteFn write_fn,
+        CreditFn credit_fn)
 {
     using namespace eprosima::uxr::utils;
     using namespace std::chrono;
 
+    ThreadSettings::apply(ThreadKind::READER, "uxr-reader");
+
     constexpr std::chrono::milliseconds max_timeout{rw_timeout};
 
     size_t rate = (max_bytes_per_second_unlimited == delivery_control_.max_bytes_per_second())
@@ -151,7 +159,13 @@ inline void Reader<RA, WA>::read_task(
     while (running_cond_ && !stop_cond)
     {
         timeout = std::min(max_timeout, duration_cast<milliseconds>(final_time - steady_clock::now()));
-        if (read_fn(read_args_, data, timeout))
+
+        /*
+         * A sample is only taken from the middleware once the output stream has room for one as large
+         * as the previous, otherwise it stays in the middleware history, where its QoS applies.
+         */
+        if ((!credit_fn || credit_fn(write_args_, data.size(), timeout)) &&
+            read_fn(read_args_, data, timeout))
         {
             bool submessage_pushed = false;
             do {
@@ -47,7 +47,8 @@ public:
     bool read(
         const dds::xrce::READ_DATA_Payload& read_data,
         Reader<bool>::WriteFn write_fn,
-        WriteFnArgs& write_args);
+        WriteFnArgs& write_args,
+        Reader<bool>::CreditFn credit_fn);
 
     bool matched(
         const dds::xrce::ObjectVariant& new_object_rep) const override;
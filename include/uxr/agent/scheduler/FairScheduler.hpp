@@ -0,0 +1,402 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_SCHEDULER_FAIR_SCHEDULER_HPP_
+#define UXR_AGENT_SCHEDULER_FAIR_SCHEDULER_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief Deficit round robin over one FIFO per flow. On each round a flow may dequeue up to
+ *        quantum * weight bytes, so a flow with a deep backlog does not delay the others by more
+ *        than one round. Flows are dropped once empty, and their weight is looked up again when
+ *        they come back.
+ *        When full, either in elements or in bytes, sheddable elements are dropped first, from the
+ *        flow with the most of them, and only then the oldest element of the longest flow.
+ */
+template<class T, class Key>
+class FairScheduler
+{
+public:
+    typedef std::function<uint16_t (const Key&)> WeightFn;
+
+    /* Elements dropped by a push to make room, including the pushed one if it was refused. */
+    struct Drops
+    {
+        size_t sheddable;
+        size_t others;
+    };
+
+    FairScheduler(
+            size_t max_size,
+            size_t quantum)
+        : flows_()
+        , active_()
+        , size_(0)
+        , bytes_(0)
+        , max_bytes_(0)
+        , mtx_()
+        , cond_var_()
+        , running_cond_(false)
+        , weight_fn_()
+        , max_size_{max_size}
+        , quantum_{quantum}
+    {}
+
+    void set_weight_function(
+            WeightFn weight_fn);
+
+    /**
+     * @brief Bounds the bytes held by the scheduler, 0 leaves them unbounded.
+     */
+    void set_max_bytes(
+            size_t max_bytes);
+
+    void init();
+
+    void deinit();
+
+    Drops push(
+            const Key& key,
+            T&& element,
+            size_t bytes,
+            bool sheddable = false);
+
+    void push_front(
+            const Key& key,
+            T&& element,
+            size_t bytes,
+            bool sheddable = false);
+
+    bool pop(
+            T& element);
+
+    bool pop(
+            std::vector<T>& elements,
+            size_t max_elements);
+
+private:
+    struct Entry
+    {
+        T element;
+        size_t bytes;
+        bool sheddable;
+    };
+
+    struct Flow
+    {
+        std::deque<Entry> queue;
+        size_t deficit;
+        size_t weight;
+        bool credited;
+        size_t sheddable;
+    };
+
+    typedef std::map<Key, Flow> FlowMap;
+    typedef typename std::deque<typename FlowMap::iterator>::iterator ActiveIterator;
+
+    typename FlowMap::iterator get_flow(
+            const Key& key,
+            bool& created);
+
+    bool is_full(
+            size_t bytes) const;
+
+    ActiveIterator find_longest(
+            bool sheddable);
+
+    void erase(
+            ActiveIterator active,
+            typename std::deque<Entry>::iterator entry);
+
+    bool make_room(
+            bool sheddable,
+            Drops& drops);
+
+    void pop_next(
+            T& element);
+
+    FlowMap flows_;
+    /* Every flow in the map is backlogged and present here once, in round order. */
+    std::deque<typename FlowMap::iterator> active_;
+    size_t size_;
+    size_t bytes_;
+    size_t max_bytes_;
+    std::mutex mtx_;
+    std::condition_variable cond_var_;
+    bool running_cond_;
+    WeightFn weight_fn_;
+    const size_t max_size_;
+    const size_t quantum_;
+};
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::set_weight_function(
+        WeightFn weight_fn)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    weight_fn_ = weight_fn;
+}
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::set_max_bytes(
+        size_t max_bytes)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    max_bytes_ = max_bytes;
+}
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::init()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    running_cond_ = true;
+}
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::deinit()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    running_cond_ = false;
+    cond_var_.notify_one();
+}
+
+template<class T, class Key>
+inline typename FairScheduler<T, Key>::FlowMap::iterator FairScheduler<T, Key>::get_flow(
+        const Key& key,
+        bool& created)
+{
+    auto it = flows_.find(key);
+    created = (flows_.end() == it);
+    if (created)
+    {
+        const uint16_t weight = weight_fn_ ? weight_fn_(key) : 1;
+        it = flows_.emplace(key, Flow{std::deque<Entry>(), 0, (0 == weight) ? 1u : weight, false, 0}).first;
+    }
+    return it;
+}
+
+template<class T, class Key>
+inline bool FairScheduler<T, Key>::is_full(
+        size_t bytes) const
+{
+    return (max_size_ <= size_) || ((0 != max_bytes_) && (max_bytes_ < bytes_ + bytes));
+}
+
+template<class T, class Key>
+inline typename FairScheduler<T, Key>::ActiveIterator FairScheduler<T, Key>::find_longest(
+        bool sheddable)
+{
+    auto longest = active_.end();
+    size_t longest_size = 0;
+    for (auto it = active_.begin(); it != active_.end(); ++it)
+    {
+        const Flow& flow = (*it)->second;
+        const size_t size = sheddable ? flow.sheddable : flow.queue.size();
+        if (longest_size < size)
+        {
+            longest = it;
+            longest_size = size;
+        }
+    }
+    return longest;
+}
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::erase(
+        ActiveIterator active,
+        typename std::deque<Entry>::iterator entry)
+{
+    auto it = *active;
+    Flow& flow = it->second;
+    --size_;
+    bytes_ -= entry->bytes;
+    flow.sheddable -= entry->sheddable ? 1 : 0;
+    flow.queue.erase(entry);
+    if (flow.queue.empty())
+    {
+        active_.erase(active);
+        flows_.erase(it);
+    }
+}
+
+template<class T, class Key>
+inline bool FairScheduler<T, Key>::make_room(
+        bool sheddable,
+        Drops& drops)
+{
+    /* Only when full, so the flow flooding the queue is the one that loses data. */
+    auto longest = find_longest(true);
+    if (active_.end() != longest)
+    {
+        auto& queue = (*longest)->second.queue;
+        erase(longest, std::find_if(queue.begin(), queue.end(), [](const Entry& entry)
+        {
+            return entry.sheddable;
+        }));
+        ++drops.sheddable;
+        return true;
+    }
+
+    if (sheddable)
+    {
+        ++drops.sheddable;
+        return false;
+    }
+
+    longest = find_longest(false);
+    erase(longest, (*longest)->second.queue.begin());
+    ++drops.others;
+    return true;
+}
+
+template<class T, class Key>
+inline typename FairScheduler<T, Key>::Drops FairScheduler<T, Key>::push(
+        const Key& key,
+        T&& element,
+        size_t bytes,
+        bool sheddable)
+{
+    Drops drops{0, 0};
+    std::lock_guard<std::mutex> lock(mtx_);
+    while (!active_.empty() && is_full(bytes))
+    {
+        if (!make_room(sheddable, drops))
+        {
+            return drops;
+        }
+    }
+
+    bool created = false;
+    auto it = get_flow(key, created);
+    it->second.queue.push_back(Entry{std::move(element), bytes, sheddable});
+    it->second.sheddable += sheddable ? 1 : 0;
+    ++size_;
+    bytes_ += bytes;
+    if (created)
+    {
+        active_.push_back(it);
+    }
+    cond_var_.notify_one();
+    return drops;
+}
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::push_front(
+        const Key& key,
+        T&& element,
+        size_t bytes,
+        bool sheddable)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    bool created = false;
+    auto it = get_flow(key, created);
+    it->second.queue.push_front(Entry{std::move(element), bytes, sheddable});
+    it->second.sheddable += sheddable ? 1 : 0;
+    ++size_;
+    bytes_ += bytes;
+    if (created)
+    {
+        active_.push_front(it);
+    }
+}
+
+template<class T, class Key>
+inline void FairScheduler<T, Key>::pop_next(
+        T& element)
+{
+    for (;;)
+    {
+        auto it = active_.front();
+        Flow& flow = it->second;
+        if (!flow.credited)
+        {
+            flow.deficit += quantum_ * flow.weight;
+            flow.credited = true;
+        }
+
+        Entry& entry = flow.queue.front();
+        if (entry.bytes <= flow.deficit)
+        {
+            flow.deficit -= entry.bytes;
+            flow.sheddable -= entry.sheddable ? 1 : 0;
+            bytes_ -= entry.bytes;
+            element = std::move(entry.element);
+            flow.queue.pop_front();
+            --size_;
+            if (flow.queue.empty())
+            {
+                active_.pop_front();
+                flows_.erase(it);
+            }
+            return;
+        }
+
+        /* Out of budget for this round, the unused deficit is kept for the next one. */
+        flow.credited = false;
+        active_.pop_front();
+        active_.push_back(it);
+    }
+}
+
+template<class T, class Key>
+inline bool FairScheduler<T, Key>::pop(
+        T& element)
+{
+    bool rv = false;
+    std::unique_lock<std::mutex> lock(mtx_);
+    cond_var_.wait(lock, [this] { return !((0 == size_) && running_cond_); });
+    if (running_cond_)
+    {
+        pop_next(element);
+        rv = true;
+        cond_var_.notify_one();
+    }
+    return rv;
+}
+
+template<class T, class Key>
+inline bool FairScheduler<T, Key>::pop(
+        std::vector<T>& elements,
+        size_t max_elements)
+{
+    bool rv = false;
+    std::unique_lock<std::mutex> lock(mtx_);
+    cond_var_.wait(lock, [this] { return !((0 == size_) && running_cond_); });
+    if (running_cond_)
+    {
+        while ((0 != size_) && (elements.size() < max_elements))
+        {
+            elements.emplace_back();
+            pop_next(elements.back());
+        }
+        rv = true;
+        cond_var_.notify_one();
+    }
+    return rv;
+}
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_SCHEDULER_FAIR_SCHEDULER_HPP_
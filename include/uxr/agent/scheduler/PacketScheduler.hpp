@@ -18,6 +18,7 @@
 #include <uxr/agent/scheduler/Scheduler.hpp>
 
 #include <deque>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
@@ -44,7 +45,7 @@ public:
 
     void deinit() final;
 
-    void push(
+    bool push(
             T&& element,
             uint8_t priority) final;
 
@@ -55,6 +56,10 @@ public:
     bool pop(
             T& element) final;
 
+    bool pop(
+            std::vector<T>& elements,
+            size_t max_elements);
+
 private:
     bool empty();
 
@@ -90,17 +95,20 @@ inline void PacketScheduler<T>::deinit()
 }
 
 template<class T>
-inline void PacketScheduler<T>::push(
+inline bool PacketScheduler<T>::push(
         T&& element,
         uint8_t priority)
 {
+    bool rv = true;
     std::lock_guard<std::mutex> lock(mtx_);
     if (sizes_[priority] <= deque_[priority].size())
     {
         deque_[priority].pop_front();
+        rv = false;
     }
     deque_[priority].push_back(std::move(element));
     cond_var_.notify_one();
+    return rv;
 }
 
 template<class T>
@@ -151,6 +159,30 @@ inline bool PacketScheduler<T>::pop(
     return rv;
 }
 
+template<class T>
+inline bool PacketScheduler<T>::pop(
+        std::vector<T>& elements,
+        size_t max_elements)
+{
+    bool rv = false;
+    std::unique_lock<std::mutex> lock(mtx_);
+    cond_var_.wait(lock, [this] { return !(empty() && running_cond_); });
+    if (running_cond_)
+    {
+        for (auto iter = deque_.rbegin(); iter != deque_.rend() && elements.size() < max_elements; ++iter)
+        {
+            while (!iter->second.empty() && elements.size() < max_elements)
+            {
+                elements.push_back(std::move(iter->second.front()));
+                iter->second.pop_front();
+            }
+        }
+        rv = true;
+        cond_var_.notify_one();
+    }
+    return rv;
+}
+
 } // namespace uxr
 } // namespace eprosima
 
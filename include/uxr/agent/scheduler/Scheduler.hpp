@@ -29,7 +29,8 @@ public:
 
     virtual void init() = 0;
     virtual void deinit() = 0;
-    virtual void push(T&& element, uint8_t priority) = 0;
+    /* Returns false if an older element was dropped to make room. */
+    virtual bool push(T&& element, uint8_t priority) = 0;
     virtual bool pop(T& element) = 0;
 };
 
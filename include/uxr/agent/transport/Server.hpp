@@ -19,10 +19,16 @@
 #include <uxr/agent/transport/TransportRc.hpp>
 #include <uxr/agent/transport/SessionManager.hpp>
 #include <uxr/agent/scheduler/PacketScheduler.hpp>
+#include <uxr/agent/scheduler/FairScheduler.hpp>
 #include <uxr/agent/message/Packet.hpp>
 #include <uxr/agent/processor/Processor.hpp>
+#include <uxr/agent/utils/RateLimiter.hpp>
+#ifdef UAGENT_CAPTURE_PROFILE
+#include <uxr/agent/transport/capture/PacketCapture.hpp>
+#endif
 
 #include <thread>
+#include <vector>
 
 namespace eprosima {
 namespace uxr {
@@ -54,6 +60,24 @@ public:
     UXR_AGENT_EXPORT bool disable_p2p();
 #endif
 
+    /**
+     * @brief Set the share of the output bandwidth of a client. Per round of the output scheduler, a
+     *        client sends up to weight times the bytes of a client of weight 1, the default.
+     *        It takes effect the next time the output queue of the client goes from empty to busy.
+     */
+    UXR_AGENT_EXPORT void set_client_weight(
+            uint32_t client_key,
+            uint16_t weight);
+
+#ifdef UAGENT_CAPTURE_PROFILE
+    /**
+     * @brief Capture the incoming and outgoing XRCE messages into rotating pcapng files.
+     * @param path Path of the capture, the file index is inserted before the extension.
+     */
+    UXR_AGENT_EXPORT bool enable_capture(const std::string& path);
+    UXR_AGENT_EXPORT bool disable_capture();
+#endif
+
 private:
     void push_output_packet(
             OutputPacket<EndPoint>&& output_packet);
@@ -87,6 +111,34 @@ private:
             int timeout,
             TransportRc& transport_rc) = 0;
 
+    /**
+     * @brief Number of receiver threads. Transports with several sockets serve each one from its own
+     *        receiver thread, which calls the recv_message overload taking the receiver index.
+     */
+    virtual size_t receiver_count() const { return 1; }
+
+    /**
+     * @brief Called from each receiver thread before its first reception, once the receiver thread
+     *        policy has been applied.
+     */
+    virtual void init_receiver(
+            size_t /* receiver */) {}
+
+    /**
+     * @brief Called from each receiver thread after its last reception.
+     */
+    virtual void fini_receiver(
+            size_t /* receiver */) {}
+
+    virtual bool recv_message(
+            InputPacket<EndPoint>& input_packet,
+            int timeout,
+            TransportRc& transport_rc,
+            size_t /* receiver */)
+    {
+        return recv_message(input_packet, timeout, transport_rc);
+    }
+
     virtual bool recv_message(
             std::vector<InputPacket<EndPoint>>& /* input_packet */,
             int /* timeout */,
@@ -98,12 +150,46 @@ private:
             OutputPacket<EndPoint> output_packet,
             TransportRc& transport_rc) = 0;
 
+    /**
+     * @brief Sends a batch of packets. The sent packets are removed from the vector, and the
+     *        caller keeps the remaining ones only on a server error.
+     */
+    virtual bool send_message(
+            std::vector<OutputPacket<EndPoint>>& /* output_packets */,
+            TransportRc& /* transport_rc */)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Whether the sender thread hands the batch send_message overload up to
+     *        SERVER_BATCH_SIZE packets at a time, instead of sending them one by one.
+     */
+    virtual bool sends_batches() const { return false; }
+
     virtual bool handle_error(TransportRc transport_rc) = 0;
 
-    void receiver_loop();
+    void receiver_loop(
+            size_t receiver);
+
+    void dispatch_input_packet(
+            InputPacket<EndPoint>&& input_packet);
 
     void sender_loop();
 
+    void batch_sender_loop();
+
+    void capture_packet(
+            const InputPacket<EndPoint>& input_packet);
+
+    void capture_packet(
+            const OutputPacket<EndPoint>& output_packet);
+
+    uint16_t get_output_weight(
+            const EndPoint& endpoint);
+
+    void update_overload_limits();
+
     void processing_loop();
 
     void heartbeat_loop();
@@ -115,17 +201,26 @@ protected:
 
 private:
     std::mutex mtx_;
-    std::thread receiver_thread_;
+    std::vector<std::thread> receiver_threads_;
     std::thread sender_thread_;
     std::thread processing_thread_;
     std::thread heartbeat_thread_;
     std::thread error_handler_thread_;
     std::atomic<bool> running_cond_;
     PacketScheduler<InputPacket<EndPoint>> input_scheduler_;
-    PacketScheduler<OutputPacket<EndPoint>> output_scheduler_;
+    FairScheduler<OutputPacket<EndPoint>, EndPoint> output_scheduler_;
+    std::mutex client_weights_mtx_;
+    std::map<uint32_t, uint16_t> client_weights_;
+    utils::RateLimiter<EndPoint> ingress_limiter_;
+    std::atomic<uint32_t> overload_generation_;
     TransportRc transport_rc_;
     std::mutex error_mtx_;
     std::condition_variable error_cv_;
+#ifdef UAGENT_CAPTURE_PROFILE
+    std::mutex capture_mtx_;
+    std::unique_ptr<PacketCapture> capture_storage_;
+    std::atomic<PacketCapture*> capture_;
+#endif
 };
 
 } // namespace uxr
@@ -17,10 +17,17 @@
 
 #include <uxr/agent/transport/Server.hpp>
 #include <uxr/agent/transport/endpoint/CanEndPoint.hpp>
+#include <uxr/agent/transport/can/CanSegmentation.hpp>
 #include <uxr/agent/transport/stream_framing/StreamFramingProtocol.hpp>
 #include <sys/poll.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+
+#include <array>
+#include <vector>
 
 #define DEFAULT_CAN_ID "0x00000001"
+#define DEFAULT_CAN_MASK "0x00000000"
 
 namespace eprosima {
 namespace uxr {
@@ -31,7 +38,8 @@ public:
     CanAgent(
             char const * dev,
             uint32_t can_id,
-            Middleware::Kind middleware_kind);
+            Middleware::Kind middleware_kind,
+            uint32_t can_mask = 0);
 
     ~CanAgent();
 
@@ -59,9 +67,23 @@ private:
             TransportRc& transport_rc) final;
 
 private:
+    static constexpr size_t max_rx_frames = 32;
+    static constexpr int tx_timeout = 100;
+
     const std::string dev_;
     const uint32_t can_id_;
+    const uint32_t can_mask_;
     struct pollfd poll_fd_;
+    CanSegmentation segmentation_;
+    std::array<struct canfd_frame, max_rx_frames> rx_frames_;
+    std::array<struct iovec, max_rx_frames> rx_iovecs_;
+    std::array<struct mmsghdr, max_rx_frames> rx_msgs_;
+    size_t rx_count_;
+    size_t rx_index_;
+    std::vector<CanSegmentation::Frame> tx_segments_;
+    std::vector<struct canfd_frame> tx_frames_;
+    std::vector<struct iovec> tx_iovecs_;
+    std::vector<struct mmsghdr> tx_msgs_;
 };
 
 } // namespace uxr
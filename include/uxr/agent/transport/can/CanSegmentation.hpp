@@ -0,0 +1,111 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_CAN_CANSEGMENTATION_HPP_
+#define UXR_AGENT_TRANSPORT_CAN_CANSEGMENTATION_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <map>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief ISO-TP like segmentation of XRCE messages over CAN FD frames.
+ *        The first octet of each frame is a protocol control information (PCI) octet:
+ *          - 0b00LLLLLL: single frame, L is the payload length (up to 63 octets).
+ *          - 0b01000000: first frame, followed by the total message length (16 bits, big endian).
+ *          - 0b10SSSSSS: consecutive frame, S is the sequence number modulo 64 (first one is 1).
+ *        Single frames are backwards compatible with the unsegmented CAN transport.
+ *        Messages are reassembled independently for each CAN ID.
+ */
+class CanSegmentation
+{
+public:
+    static constexpr size_t frame_data_size = 64;
+    static constexpr size_t single_frame_max_payload = frame_data_size - 1;
+    static constexpr size_t first_frame_payload = frame_data_size - 3;
+    static constexpr size_t consecutive_frame_payload = frame_data_size - 1;
+    static constexpr size_t max_message_size = UINT16_MAX;
+
+    /**
+     * @brief CAN FD frame payload, as written into the data field of a canfd_frame.
+     */
+    struct Frame
+    {
+        std::array<uint8_t, frame_data_size> data;
+        uint8_t len;
+    };
+
+    CanSegmentation() = default;
+
+    /**
+     * @brief Split a message into CAN FD frames.
+     * @param buf Message to be sent.
+     * @param len Length of the message.
+     * @param frames Output frames, cleared before being filled.
+     * @return true if the message fits in the segmentation protocol, false otherwise.
+     */
+    static bool segment(
+            const uint8_t* buf,
+            size_t len,
+            std::vector<Frame>& frames);
+
+    /**
+     * @brief Feed a received frame into the reassembly state of its CAN ID.
+     * @param can_id CAN ID from which the frame was received.
+     * @param data Data field of the frame.
+     * @param len Length of the data field.
+     * @param message Set to the complete message when available. It points either into data
+     *                (single frames) or into the internal buffer, and is valid until the next call.
+     * @param message_len Set to the length of the complete message.
+     * @return true if a complete message is available, false otherwise.
+     */
+    bool reassemble(
+            uint32_t can_id,
+            const uint8_t* data,
+            size_t len,
+            const uint8_t*& message,
+            size_t& message_len);
+
+    /**
+     * @brief Drop any partially reassembled message.
+     */
+    void reset() { reassembly_.clear(); }
+
+private:
+    struct Reassembly
+    {
+        std::vector<uint8_t> buffer;
+        size_t expected_len;
+        uint8_t next_sequence;
+    };
+
+    static constexpr uint8_t pci_type_mask = 0xC0;
+    static constexpr uint8_t pci_value_mask = 0x3F;
+    static constexpr uint8_t pci_single_frame = 0x00;
+    static constexpr uint8_t pci_first_frame = 0x40;
+    static constexpr uint8_t pci_consecutive_frame = 0x80;
+
+    std::map<uint32_t, Reassembly> reassembly_;
+    std::vector<uint8_t> completed_;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_CAN_CANSEGMENTATION_HPP_
@@ -0,0 +1,226 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_CAPTURE_PACKETCAPTURE_HPP_
+#define UXR_AGENT_TRANSPORT_CAPTURE_PACKETCAPTURE_HPP_
+
+#include <uxr/agent/config.hpp>
+#include <uxr/agent/utils/BoundedQueue.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace eprosima {
+namespace uxr {
+
+class CustomEndPoint;
+
+/**
+ * @brief Capture of the raw XRCE messages of a Server into rotating pcapng files.
+ *        The I/O threads copy each message into a bounded lock-free queue, and a background
+ *        thread writes the Enhanced Packet Blocks into memory-mapped files. Each block carries
+ *        the timestamp, the direction (epb_flags) and the endpoint (opt_comment); the transport
+ *        kind is the name of the interface. Messages that do not fit in the queue are dropped.
+ *        Files are preallocated and trimmed on close, so an abrupt exit leaves a zeroed tail.
+ */
+class PacketCapture
+{
+public:
+    enum class Direction : uint8_t
+    {
+        INBOUND = 1,
+        OUTBOUND = 2
+    };
+
+    /* LINKTYPE_USER0, the payload is a raw XRCE message. */
+    static constexpr uint16_t link_type = 147;
+    /* Large enough for every endpoint type, the Unix one holds its path. */
+    static constexpr size_t endpoint_size = 64;
+
+    PacketCapture();
+
+    ~PacketCapture();
+
+    PacketCapture(PacketCapture&&) = delete;
+    PacketCapture(const PacketCapture&) = delete;
+    PacketCapture& operator=(PacketCapture&&) = delete;
+    PacketCapture& operator=(const PacketCapture&) = delete;
+
+    /**
+     * @brief Start capturing.
+     * @param path Path of the capture, the file index is inserted before the extension.
+     * @param interface_name Name of the transport kind.
+     * @param file_size Size of each file.
+     * @param max_files Number of files kept, the oldest ones are removed.
+     */
+    bool open(
+            const std::string& path,
+            const std::string& interface_name,
+            size_t file_size = CAPTURE_FILE_SIZE,
+            size_t max_files = CAPTURE_MAX_FILES);
+
+    /**
+     * @brief Stop capturing, writing the pending messages first.
+     */
+    bool close();
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Queue a message without blocking. The endpoint is only formatted by the background thread.
+     */
+    template<typename EndPoint>
+    void capture(
+            Direction direction,
+            const EndPoint& endpoint,
+            const uint8_t* buf,
+            size_t len)
+    {
+        push(direction, buf, len, [&endpoint](Record& record)
+        {
+            EndPointFormatter<EndPoint>::store(endpoint, record);
+        });
+    }
+
+private:
+    struct Record;
+    typedef void (*FormatFunction)(const Record&, std::string&);
+
+    struct Record
+    {
+        std::chrono::system_clock::time_point timestamp;
+        Direction direction;
+        size_t len;
+        size_t captured_len;
+        FormatFunction format;
+        typename std::aligned_storage<endpoint_size, alignof(std::max_align_t)>::type endpoint;
+        std::array<uint8_t, CAPTURE_SNAPLEN> data;
+    };
+
+    /* The endpoint is copied into the record and destroyed once formatted. */
+    template<typename EndPoint>
+    struct EndPointFormatter
+    {
+        static_assert(sizeof(EndPoint) <= endpoint_size, "EndPoint too large for the capture records.");
+
+        static void store(
+                const EndPoint& endpoint,
+                Record& record)
+        {
+            new (&record.endpoint) EndPoint(endpoint);
+            record.format = &format;
+        }
+
+        static void format(
+                const Record& record,
+                std::string& output)
+        {
+            const EndPoint* endpoint = reinterpret_cast<const EndPoint*>(&record.endpoint);
+            std::ostringstream ss;
+            ss << *endpoint;
+            output = ss.str();
+            endpoint->~EndPoint();
+        }
+    };
+
+    template<typename Fill>
+    void push(
+            Direction direction,
+            const uint8_t* buf,
+            size_t len,
+            Fill&& fill_endpoint)
+    {
+        bool rv = queue_.try_push([&](Record& record)
+        {
+            record.timestamp = std::chrono::system_clock::now();
+            record.direction = direction;
+            record.len = len;
+            record.captured_len = (len < record.data.size()) ? len : record.data.size();
+            std::memcpy(record.data.data(), buf, record.captured_len);
+            fill_endpoint(record);
+        });
+
+        if (!rv)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void loop();
+
+    size_t flush();
+
+    void write(
+            const Record& record);
+
+    bool open_file();
+
+    bool close_file();
+
+    bool append(
+            const uint8_t* buf,
+            size_t len);
+
+    void write_header();
+
+private:
+    utils::BoundedQueue<Record> queue_;
+    std::atomic<uint64_t> dropped_;
+    std::atomic<bool> enabled_;
+
+    std::string path_;
+    std::string interface_name_;
+    size_t file_size_;
+    size_t max_files_;
+    size_t file_index_;
+    int fd_;
+    uint8_t* map_;
+    size_t offset_;
+    std::string block_;
+    std::string endpoint_;
+
+    std::mutex mtx_;
+    std::thread thread_;
+    std::atomic<bool> running_cond_;
+};
+
+/* Custom endpoints own heap memory and have no textual form, so only their hash is recorded. */
+template<>
+struct PacketCapture::EndPointFormatter<CustomEndPoint>
+{
+    static void store(
+            const CustomEndPoint& endpoint,
+            Record& record);
+
+    static void format(
+            const Record& record,
+            std::string& output);
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_CAPTURE_PACKETCAPTURE_HPP_
@@ -21,6 +21,8 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <memory>
+#include <vector>
 
 #ifdef _WIN32
 #include <BaseTsd.h>
@@ -85,6 +87,52 @@ public:
         size_t /*message_length*/,
         TransportRc& /*transport_rc*/)>;
 
+    /**
+     * @brief Slot for a message received through the batch receive function.
+     *        The agent provides the endpoint and the buffer, the user fills
+     *        the endpoint members and the message length.
+     */
+    struct IncomingMessage
+    {
+        CustomEndPoint* source_endpoint;
+        uint8_t* buffer;
+        size_t buffer_length;
+        size_t message_length;
+    };
+
+    /**
+     * @brief Message to be sent through the batch send function.
+     */
+    struct OutgoingMessage
+    {
+        const CustomEndPoint* destination_endpoint;
+        const uint8_t* buffer;
+        size_t message_length;
+    };
+
+    /**
+     * @brief Batch receive function signature, optionally implemented by final users.
+     * @param messages Reception slots, up to SERVER_BATCH_SIZE. The first N slots
+     *        must be filled, where N is the returned value.
+     * @param timeout Connection timeout for receiving the first message.
+     * @param transport_rc Transport return code, to be filled by the user.
+     * @return size_t Number of received messages.
+     */
+    using RecvMsgsFunction = std::function<size_t (
+        std::vector<IncomingMessage>& /*messages*/,
+        int /*timeout*/,
+        TransportRc& /*transport_rc*/)>;
+
+    /**
+     * @brief Batch send function signature, optionally implemented by final users.
+     * @param messages Messages to be sent, in order.
+     * @param transport_rc Transport return code, to be filled by the user.
+     * @return size_t Number of messages sent, counting from the first one.
+     */
+    using SendMsgsFunction = std::function<size_t (
+        const std::vector<OutgoingMessage>& /*messages*/,
+        TransportRc& /*transport_rc*/)>;
+
     /**
      * @brief Constructor.
      * @param name Name of the middleware to be implemented by this CustomAgent.
@@ -106,6 +154,25 @@ public:
             SendMsgFunction& send_msg_function,
             RecvMsgFunction& recv_msg_function);
 
+    /**
+     * @brief Constructor with batch operations.
+     *        The batch functions are used instead of the single message ones when set,
+     *        except if framing is enabled. Either of them may be left empty.
+     * @param send_msgs_function Custom user-defined function, called to send several messages at once.
+     * @param recv_msgs_function Custom user-defined function, called to receive several messages at once.
+     */
+    UXR_AGENT_EXPORT CustomAgent(
+            const std::string& name,
+            CustomEndPoint* endpoint,
+            Middleware::Kind middleware_kind,
+            bool framing,
+            InitFunction& init_function,
+            FiniFunction& fini_function,
+            SendMsgFunction& send_msg_function,
+            RecvMsgFunction& recv_msg_function,
+            SendMsgsFunction send_msgs_function,
+            RecvMsgsFunction recv_msgs_function);
+
     /**
      * @brief Destructor.
      */
@@ -136,6 +203,26 @@ private:
             OutputPacket<CustomEndPoint> output_packet,
             TransportRc& transport_rc) final;
 
+    bool recv_message(
+            std::vector<InputPacket<CustomEndPoint>>& input_packets,
+            int timeout,
+            TransportRc& transport_rc) final;
+
+    bool send_message(
+            std::vector<OutputPacket<CustomEndPoint>>& output_packets,
+            TransportRc& transport_rc) final;
+
+    bool sends_batches() const final { return true; }
+
+    /**
+     * @brief Logs a message, looking up its client key only when message logging is enabled.
+     */
+    void log_message(
+            const std::string& label,
+            const CustomEndPoint& endpoint,
+            const uint8_t* buffer,
+            size_t length);
+
     bool handle_error(
             TransportRc transport_rc) final;
 
@@ -149,6 +236,12 @@ private:
      */
     const std::string name_;
 
+    /**
+     * @brief Precomputed log labels for received and sent messages.
+     */
+    const std::string recv_label_;
+    const std::string send_label_;
+
     /**
      * @brief Pointers to this custom agent's endpoint definition.
      *        They are used for receive and send operations, respectively.
@@ -164,6 +257,20 @@ private:
     SendMsgFunction& custom_send_msg_func_;
     RecvMsgFunction& custom_recv_msg_func_;
 
+    /**
+     * @brief Optional user-defined batch operations.
+     */
+    SendMsgsFunction custom_send_msgs_func_;
+    RecvMsgsFunction custom_recv_msgs_func_;
+
+    /**
+     * @brief Reception slots, endpoints and buffers for batch operations.
+     */
+    std::vector<IncomingMessage> incoming_messages_;
+    std::vector<CustomEndPoint> recv_endpoints_;
+    std::unique_ptr<uint8_t[]> recv_buffers_;
+    std::vector<OutgoingMessage> outgoing_messages_;
+
     /**
      * @brief Indicates the usage or non-usage of framing for R/W operations.
      */
@@ -16,6 +16,8 @@
 #define UXR_AGENT_TRANSPORT_DISCOVERY_SERVER_HPP_
 
 #include <uxr/agent/message/Packet.hpp>
+#include <uxr/agent/processor/InfoReplyCache.hpp>
+#include <uxr/agent/utils/RateLimiter.hpp>
 #include <uxr/agent/transport/endpoint/IPv4EndPoint.hpp>
 #include <uxr/agent/transport/endpoint/IPv6EndPoint.hpp>
 
@@ -67,6 +69,8 @@ private:
     std::thread thread_;
     std::atomic<bool> running_cond_;
     const Processor<EndPoint>& processor_;
+    InfoReplyCache info_cache_;
+    utils::RateLimiter<IPv4EndPoint> rate_limiter_;
 
 protected:
     std::vector<dds::xrce::TransportAddress> transport_addresses_;
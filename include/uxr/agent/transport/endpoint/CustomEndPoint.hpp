@@ -15,9 +15,16 @@
 #ifndef UXR_AGENT_TRANSPORT_ENDPOINT_CUSTOM_ENDPOINT_HPP_
 #define UXR_AGENT_TRANSPORT_ENDPOINT_CUSTOM_ENDPOINT_HPP_
 
-#include <map>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace eprosima {
 namespace uxr {
@@ -47,15 +54,34 @@ private:
     };
 
     /**
-     * @brief Struct defining a member in terms of its kind and an opaque pointer,
-     *        containing the member data itself.
+     * @brief Struct defining a member in terms of its name, kind and location.
+     *        Integer members live at a byte offset of the inline storage,
+     *        and string members at an index of the string storage.
      */
     typedef struct Member
     {
+        std::string name;
         MemberKind kind;
-        std::shared_ptr<void> data;
+        size_t location;
     } Member;
 
+    /**
+     * @brief Layout of an endpoint, fixed once all the members are added.
+     *        It is shared among all the copies of an endpoint.
+     */
+    typedef struct Schema
+    {
+        std::vector<Member> members;
+        size_t data_size = 0;
+        size_t strings_size = 0;
+    } Schema;
+
+    /**
+     * @brief Maximum number of members and octets of inline storage for integer members.
+     */
+    static constexpr size_t max_members = 64;
+    static constexpr size_t max_inline_size = 64;
+
     /**
      * @brief Exception to be launched when trying to insert two elements
      *        with the same key on the CustomEndPoint map.
@@ -110,6 +136,56 @@ private:
         std::string message_;
     };
 
+    class MemberOverflowException : public std::exception
+    {
+    public:
+        MemberOverflowException(
+                const char* file,
+                int line,
+                const char* func,
+                const std::string& key)
+        {
+            std::stringstream what;
+            what << file << ":" << line << ":" << func
+                 << ": No room left for member '"
+                 << key << "'.";
+            message_ = what.str();
+        }
+
+        const char* what() const noexcept
+        {
+            return message_.c_str();
+        }
+
+    private:
+        std::string message_;
+    };
+
+    class MemberKindMismatchException : public std::exception
+    {
+    public:
+        MemberKindMismatchException(
+                const char* file,
+                int line,
+                const char* func,
+                const std::string& key)
+        {
+            std::stringstream what;
+            what << file << ":" << line << ":" << func
+                 << ": Type does not match the kind of member '"
+                 << key << "'.";
+            message_ = what.str();
+        }
+
+        const char* what() const noexcept
+        {
+            return message_.c_str();
+        }
+
+    private:
+        std::string message_;
+    };
+
     class EmptyMemberException : public std::exception
     {
     public:
@@ -135,36 +211,85 @@ public:
     /**
      * @brief Default constructor.
      */
-    CustomEndPoint() = default;
+    CustomEndPoint()
+        : schema_{std::make_shared<Schema>()}
+        , data_{}
+        , strings_{}
+        , set_members_{0}
+        , hash_{0}
+    {
+        update_hash();
+    }
 
     /**
      * @brief Default destructor.
      */
     ~CustomEndPoint() = default;
 
+    CustomEndPoint(const CustomEndPoint&) = default;
+    CustomEndPoint(CustomEndPoint&&) = default;
+    CustomEndPoint& operator =(const CustomEndPoint&) = default;
+    CustomEndPoint& operator =(CustomEndPoint&&) = default;
+
     /**
      * @brief Adds a member to the member list.
      *        The member must not already exist in the EndPoint.
      * @param name The member name,
      * @param kind The member kind.
      * @throw SameKeyException if member already exists.
+     * @throw MemberOverflowException if there is no room left for the member.
      * @return true if the insert was successful, or false otherwise.
      */
     bool add_member(
             const std::string& name,
             const MemberKind& kind)
     {
-        if (members_.end() != members_.find(name))
+        if (nullptr != find_member(name.c_str()))
         {
             throw SameKeyException(__FILE__, __LINE__, __FUNCTION__, name);
         }
 
         Member member;
+        member.name = name;
         member.kind = kind;
-        member.data.reset();
 
-        auto res = members_.emplace(name, std::move(member));
-        return res.second;
+        size_t size = member_size(kind);
+        size_t location = schema_->data_size;
+        if (MemberKind::STRING == kind)
+        {
+            location = schema_->strings_size;
+        }
+        else
+        {
+            /* Keep integer members naturally aligned. */
+            location = (location + size - 1) & ~(size - 1);
+        }
+
+        if ((max_members == schema_->members.size())
+                || ((MemberKind::STRING != kind) && (max_inline_size < location + size)))
+        {
+            throw MemberOverflowException(__FILE__, __LINE__, __FUNCTION__, name);
+        }
+        member.location = location;
+
+        /* Copies of this endpoint keep the former layout. */
+        if (1 < schema_.use_count())
+        {
+            schema_ = std::make_shared<Schema>(*schema_);
+        }
+
+        if (MemberKind::STRING == kind)
+        {
+            schema_->strings_size = location + 1;
+            strings_.resize(schema_->strings_size);
+        }
+        else
+        {
+            schema_->data_size = location + size;
+        }
+        schema_->members.push_back(std::move(member));
+        update_hash();
+        return true;
     }
 
     /**
@@ -182,10 +307,13 @@ public:
      */
     void reset()
     {
-        for (auto& member : members_)
+        std::memset(data_.data(), 0, schema_->data_size);
+        for (auto& string : strings_)
         {
-            member.second.data.reset();
+            string.clear();
         }
+        set_members_ = 0;
+        update_hash();
     }
 
     /**
@@ -193,20 +321,14 @@ public:
      * @param name Key value to be searched in the members map.
      * @param value A const reference to the value to be set.
      * @throw NoExistingMemberException if trying to set a value not registered in the map.
+     * @throw MemberKindMismatchException if the type of the value does not match the member kind.
      */
     template <typename T>
     void set_member_value(
             const std::string& name,
             const T& value)
     {
-        if (members_.end() == members_.find(name))
-        {
-            throw NoExistingMemberException(__FILE__, __LINE__, __FUNCTION__, name);
-        }
-        else
-        {
-            members_.at(name).data.reset(new T(value));
-        }
+        assign_member<T>(name, value);
     }
 
     /**
@@ -214,138 +336,75 @@ public:
      * @param name Key value to be searched in the members map.
      * @param value A movable reference to the value to be set.
      * @throw NoExistingMemberException if trying to set a value not registered in the map.
+     * @throw MemberKindMismatchException if the type of the value does not match the member kind.
      */
     template <typename T>
     void set_member_value(
             const std::string& name,
             T&& value)
     {
-        if (members_.end() == members_.find(name))
-        {
-            throw NoExistingMemberException(__FILE__, __LINE__, __FUNCTION__, name);
-        }
-        else
-        {
-            members_.at(name).data.reset(new T(std::move(value)));
-        }
+        assign_member<typename std::decay<T>::type>(name, std::forward<T>(value));
     }
 
     /**
-     * 
+     * @brief Checks that all the members have been given a value.
+     * @throw EmptyMemberException if any member has not been set.
      */
-    void check_non_empty_members()
+    void check_non_empty_members() const
     {
-        for (const auto& member : members_)
+        for (size_t i = 0; i < schema_->members.size(); ++i)
         {
-            if (nullptr == member.second.data.get())
+            if (0 == (set_members_ & (uint64_t(1) << i)))
             {
-                throw EmptyMemberException(member.first);
+                throw EmptyMemberException(schema_->members[i].name);
             }
         }
     }
 
     /**
-     * @brief Helper static method that allows to compare two members of the same type.
-     * @param first First member to be compared.
-     * @param second Second member to be compared against the first.
-     * @return 0 if the members are equal, -1 if first < second, 1 if second > first.
+     * @brief Precomputed hash of the member values.
      */
-    template <typename T>
-    static int8_t less_than_members(
-            const Member& first,
-            const Member& second)
+    size_t hash() const
     {
-        T first_data = *static_cast<T *>(first.data.get());
-        T second_data = *static_cast<T *>(second.data.get());
-
-        if (first_data == second_data)
-        {
-            return 0;
-        }
-        else if (first_data < second_data)
-        {
-            return -1;
-        }
-        else
-        {
-            return 1;
-        }
+        return hash_;
     }
 
     /**
      * @brief Operator < overload.
+     *        Endpoints are ordered by their hash first, so most comparisons
+     *        resolve with a single integer comparison.
      * @param other The CustomEndPoint to be checked against this one.
      * @return True if this < other, false otherwise.
      */
     bool operator <(
             const CustomEndPoint& other) const
     {
-        for (const auto& member : members_)
+        if (hash_ != other.hash_)
         {
-            const std::string& member_name = member.first;
+            return hash_ < other.hash_;
+        }
 
-            auto other_member = other.members_.at(member_name);
-            switch (member.second.kind)
-            {
-                case MemberKind::UINT8:
-                {
-                    int8_t res = less_than_members<uint8_t>(member.second, other_member);
-                    if (0 == res)
-                    {
-                        break;
-                    }
-                    return (res < 0) ? true : false;
-                }
-                case MemberKind::UINT16:
-                {
-                    int8_t res = less_than_members<uint16_t>(member.second, other_member);
-                    if (0 == res)
-                    {
-                        break;
-                    }
-                    return (res < 0) ? true : false;
-                }
-                case MemberKind::UINT32:
-                {
-                    int8_t res = less_than_members<uint32_t>(member.second, other_member);
-                    if (0 == res)
-                    {
-                        break;
-                    }
-                    return (res < 0) ? true : false;
-                }
-                case MemberKind::UINT64:
-                {
-                    int8_t res = less_than_members<uint64_t>(member.second, other_member);
-                    if (0 == res)
-                    {
-                        break;
-                    }
-                    return (res < 0) ? true : false;
-                }
-#ifdef __SIZEOF_UINT128__
-                case MemberKind::UINT128:
-                {
-                    int8_t res = less_than_members<uint128_t>(member.second, other_member);
-                    if (0 == res)
-                    {
-                        break;
-                    }
-                    return (res < 0) ? true : false;
-                }
-#endif // __SIZEOF_UINT128__
-                case MemberKind::STRING:
-                {
-                    int8_t res = less_than_members<std::string>(member.second, other_member);
-                    if (0 == res)
-                    {
-                        break;
-                    }
-                    return (res < 0) ? true : false;
-                }
-            }
+        size_t data_size = std::max(schema_->data_size, other.schema_->data_size);
+        int res = std::memcmp(data_.data(), other.data_.data(), data_size);
+        if (0 != res)
+        {
+            return res < 0;
         }
-        return false;
+        return strings_ < other.strings_;
+    }
+
+    /**
+     * @brief Operator == overload.
+     * @param other The CustomEndPoint to be checked against this one.
+     * @return True if both endpoints hold the same values, false otherwise.
+     */
+    bool operator ==(
+            const CustomEndPoint& other) const
+    {
+        size_t data_size = std::max(schema_->data_size, other.schema_->data_size);
+        return (hash_ == other.hash_)
+               && (0 == std::memcmp(data_.data(), other.data_.data(), data_size))
+               && (strings_ == other.strings_);
     }
 
     /**
@@ -358,56 +417,58 @@ public:
             std::ostream& os,
             const CustomEndPoint& endpoint)
     {
-        for (const auto& member : endpoint.members_)
+        const std::vector<Member>& members = endpoint.schema_->members;
+        for (size_t i = 0; i < members.size(); ++i)
         {
-            os << member.first << ": ";
+            const Member& member = members[i];
+            os << member.name << ": ";
 
-            if (nullptr == member.second.data.get())
+            if (0 == (endpoint.set_members_ & (uint64_t(1) << i)))
             {
                 os << "<null>";
             }
             else
             {
-                switch (member.second.kind)
+                switch (member.kind)
                 {
                     case MemberKind::UINT8:
                     {
-                        os << *static_cast<uint8_t *>(member.second.data.get());
+                        os << endpoint.member_value<uint8_t>(member);
                         break;
                     }
                     case MemberKind::UINT16:
                     {
-                        os << *static_cast<uint16_t *>(member.second.data.get());
+                        os << endpoint.member_value<uint16_t>(member);
                         break;
                     }
                     case MemberKind::UINT32:
                     {
-                        os << *static_cast<uint32_t *>(member.second.data.get());
+                        os << endpoint.member_value<uint32_t>(member);
                         break;
                     }
                     case MemberKind::UINT64:
                     {
-                        os << *static_cast<uint64_t *>(member.second.data.get());
+                        os << endpoint.member_value<uint64_t>(member);
                         break;
                     }
 #ifdef __SIZEOF_UINT128__
                     case MemberKind::UINT128:
                     {
-                        os << *static_cast<uint128_t *>(member.second.data.get());
+                        os << endpoint.member_value<uint128_t>(member);
                         break;
                     }
 #endif // __SIZEOF_UINT128__
                     case MemberKind::STRING:
                     {
                         os << "'"
-                        << *static_cast<std::string *>(member.second.data.get())
+                        << endpoint.member_value<std::string>(member)
                         << "'";
                         break;
                     }
                 }
             }
 
-            if (&(*endpoint.members_.rbegin()) != &member)
+            if (i + 1 != members.size())
             {
                 os << ", ";
             }
@@ -420,26 +481,30 @@ public:
      * @brief Get a member's value, given its key.
      * @param key The member's key.
      * @throw NoExistingMemberException if the member is not found.
+     * @throw MemberKindMismatchException if the requested type does not match the member kind.
      * @return Const reference to the requested value.
      */
     template <typename T>
     const T& get_member(
             const char* key) const
     {
-        if (members_.end() == members_.find(key))
+        const Member* member = find_member(key);
+        if (nullptr == member)
         {
             throw NoExistingMemberException(__FILE__, __LINE__, __FUNCTION__, key);
         }
-        else
+        if (!matches_kind<T>(member->kind))
         {
-            return *static_cast<T *>(members_.at(key).data.get());
+            throw MemberKindMismatchException(__FILE__, __LINE__, __FUNCTION__, key);
         }
+        return member_value<T>(*member);
     }
 
     /**
      * @brief Get a member's value, given its key.
      * @param key The member's key.
      * @throw NoExistingMemberException if the member is not found.
+     * @throw MemberKindMismatchException if the requested type does not match the member kind.
      * @return Const reference to the requested value.
      */
     template <typename T>
@@ -450,7 +515,145 @@ public:
     }
 
 private:
-    std::map<std::string, Member> members_;
+    static size_t member_size(
+            MemberKind kind)
+    {
+        switch (kind)
+        {
+            case MemberKind::UINT8:
+                return sizeof(uint8_t);
+            case MemberKind::UINT16:
+                return sizeof(uint16_t);
+            case MemberKind::UINT32:
+                return sizeof(uint32_t);
+            case MemberKind::UINT64:
+                return sizeof(uint64_t);
+#ifdef __SIZEOF_UINT128__
+            case MemberKind::UINT128:
+                return sizeof(uint128_t);
+#endif // __SIZEOF_UINT128__
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * @brief Strings go to string members and integers to integer members of their same width,
+     *        so a value never overruns its slot of the inline storage.
+     */
+    template <typename T>
+    static bool matches_kind(
+            MemberKind kind)
+    {
+        return std::is_same<T, std::string>::value
+               ? (MemberKind::STRING == kind)
+               : ((MemberKind::STRING != kind) && (sizeof(T) == member_size(kind)));
+    }
+
+    const Member* find_member(
+            const char* key) const
+    {
+        for (const auto& member : schema_->members)
+        {
+            if (0 == member.name.compare(key))
+            {
+                return &member;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    const T& member_value(
+            const Member& member) const
+    {
+        return member_value<T>(member, std::is_same<T, std::string>{});
+    }
+
+    template <typename T>
+    const T& member_value(
+            const Member& member,
+            std::false_type /* is_string */) const
+    {
+        return *reinterpret_cast<const T*>(data_.data() + member.location);
+    }
+
+    template <typename T>
+    const T& member_value(
+            const Member& member,
+            std::true_type /* is_string */) const
+    {
+        return strings_[member.location];
+    }
+
+    template <typename T, typename U>
+    void assign_member(
+            const std::string& name,
+            U&& value)
+    {
+        const Member* member = find_member(name.c_str());
+        if (nullptr == member)
+        {
+            throw NoExistingMemberException(__FILE__, __LINE__, __FUNCTION__, name);
+        }
+        if (!matches_kind<T>(member->kind))
+        {
+            throw MemberKindMismatchException(__FILE__, __LINE__, __FUNCTION__, name);
+        }
+
+        store_member<T>(*member, std::forward<U>(value), std::is_same<T, std::string>{});
+        set_members_ |= uint64_t(1) << (member - schema_->members.data());
+        update_hash();
+    }
+
+    template <typename T, typename U>
+    void store_member(
+            const Member& member,
+            U&& value,
+            std::false_type /* is_string */)
+    {
+        static_assert(std::is_integral<T>::value, "CustomEndPoint members must be unsigned integers or strings");
+        T data(std::forward<U>(value));
+        std::memcpy(data_.data() + member.location, &data, sizeof(T));
+    }
+
+    template <typename T, typename U>
+    void store_member(
+            const Member& member,
+            U&& value,
+            std::true_type /* is_string */)
+    {
+        strings_[member.location] = std::forward<U>(value);
+    }
+
+    /**
+     * @brief FNV-1a hash over the inline storage and the strings.
+     */
+    void update_hash()
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        auto hash_bytes = [&hash](const uint8_t* bytes, size_t len)
+                {
+                    for (size_t i = 0; i < len; ++i)
+                    {
+                        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+                    }
+                };
+
+        hash_bytes(data_.data(), schema_->data_size);
+        for (const auto& string : strings_)
+        {
+            hash_bytes(reinterpret_cast<const uint8_t*>(string.data()), string.size());
+            hash = (hash ^ 0xFF) * 1099511628211ULL;
+        }
+        hash_ = static_cast<size_t>(hash);
+    }
+
+    std::shared_ptr<Schema> schema_;
+    alignas(16) std::array<uint8_t, max_inline_size> data_;
+    std::vector<std::string> strings_;
+    uint64_t set_members_;
+    size_t hash_;
 };
 
 /**
@@ -504,4 +707,18 @@ inline bool CustomEndPoint::add_member<std::string>(
 } // namespace uxr
 } // namespace eprosima
 
-#endif // UXR_AGENT_TRANSPORT_ENDPOINT_IPV4_ENDPOINT_HPP_
+namespace std {
+
+template <>
+struct hash<eprosima::uxr::CustomEndPoint>
+{
+    size_t operator ()(
+            const eprosima::uxr::CustomEndPoint& endpoint) const
+    {
+        return endpoint.hash();
+    }
+};
+
+} // namespace std
+
+#endif // UXR_AGENT_TRANSPORT_ENDPOINT_CUSTOM_ENDPOINT_HPP_
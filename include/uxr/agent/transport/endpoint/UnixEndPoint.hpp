@@ -0,0 +1,95 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_ENDPOINT_UNIX_ENDPOINT_HPP_
+#define UXR_AGENT_TRANSPORT_ENDPOINT_UNIX_ENDPOINT_HPP_
+
+#include <stdint.h>
+#include <ostream>
+#include <string>
+#include <tuple>
+
+namespace eprosima {
+namespace uxr {
+
+/**
+ * @brief Peer of a Unix domain socket. Datagram peers are identified by the path of their socket,
+ *        an abstract name starting with a null character included, and connected peers by the
+ *        credentials of the process that connected plus the number of their connection, so that a
+ *        process may keep several connections open.
+ */
+class UnixEndPoint
+{
+public:
+    UnixEndPoint() = default;
+
+    explicit UnixEndPoint(
+            const std::string& path)
+        : path_{path}
+    {}
+
+    UnixEndPoint(
+            uint32_t pid,
+            uint32_t uid,
+            uint32_t gid,
+            uint64_t connection)
+        : pid_{pid}
+        , uid_{uid}
+        , gid_{gid}
+        , connection_{connection}
+    {}
+
+    ~UnixEndPoint() {}
+
+    bool operator<(const UnixEndPoint& other) const
+    {
+        return std::tie(pid_, connection_, uid_, gid_, path_)
+             < std::tie(other.pid_, other.connection_, other.uid_, other.gid_, other.path_);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const UnixEndPoint& endpoint)
+    {
+        if (endpoint.path_.empty())
+        {
+            os << "pid " << endpoint.pid_ << ", uid " << endpoint.uid_ << ", connection " << endpoint.connection_;
+        }
+        else if ('\0' == endpoint.path_.front())
+        {
+            os << "@" << endpoint.path_.substr(1);
+        }
+        else
+        {
+            os << endpoint.path_;
+        }
+        return os;
+    }
+
+    const std::string& get_path() const { return path_; }
+    uint32_t get_pid() const { return pid_; }
+    uint32_t get_uid() const { return uid_; }
+    uint32_t get_gid() const { return gid_; }
+    uint64_t get_connection() const { return connection_; }
+
+private:
+    std::string path_;
+    uint32_t pid_ = 0;
+    uint32_t uid_ = 0;
+    uint32_t gid_ = 0;
+    uint64_t connection_ = 0;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_ENDPOINT_UNIX_ENDPOINT_HPP_
@@ -20,6 +20,7 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <chrono>
 
 namespace eprosima {
 namespace uxr {
@@ -61,6 +62,11 @@ private:
     void loop();
 
 private:
+    /* GET_INFO period, doubled on each round without new Agents and reset when one shows up. */
+    static constexpr std::chrono::milliseconds min_discovery_period{100};
+    static constexpr std::chrono::milliseconds max_discovery_period{5000};
+    static constexpr int recv_timeout = 100;
+
     Agent& agent_;
     std::mutex mtx_;
     std::thread thread_;
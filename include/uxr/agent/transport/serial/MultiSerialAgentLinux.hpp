@@ -19,13 +19,17 @@
 #include <uxr/agent/transport/endpoint/MultiSerialEndPoint.hpp>
 #include <uxr/agent/transport/stream_framing/StreamFramingProtocol.hpp>
 #include <uxr/agent/utils/SharedMutexPriority.hpp>
+#ifdef UAGENT_IO_URING_PROFILE
+#include <uxr/agent/transport/util/IoUringLinux.hpp>
+#endif
 
 #include <cstdint>
 #include <cstddef>
-#include <sys/poll.h>
+#include <sys/epoll.h>
 
 #include <mutex>
 #include <condition_variable>
+#include <memory>
 
 namespace eprosima {
 namespace uxr {
@@ -33,10 +37,20 @@ namespace uxr {
 class MultiSerialAgent : public Server<MultiSerialEndPoint>
 {
 public:
+    /**
+     * @param addr Address of the agent in the framing protocol.
+     * @param middleware_kind Middleware of the agent.
+     * @param io_uring Read the ports that are ready, and write the frames of a send batch, with a
+     *        single io_uring_enter each. It needs the UAGENT_IO_URING_PROFILE build, otherwise it
+     *        is ignored. If the kernel refuses the ring, the same batches use read and write.
+     */
     MultiSerialAgent(
             uint8_t addr,
-            Middleware::Kind middleware_kind);
-    
+            Middleware::Kind middleware_kind,
+            bool io_uring = false);
+
+    ~MultiSerialAgent();
+
     void insert_serial(int serial_fd);
     bool remove_serial(int serial_fd);
 
@@ -69,29 +83,122 @@ private:
             OutputPacket<MultiSerialEndPoint> output_packet,
             TransportRc& transport_rc) final;
 
+    bool send_message(
+            std::vector<OutputPacket<MultiSerialEndPoint>>& output_packets,
+            TransportRc& transport_rc) final;
+
+    bool sends_batches() const final { return use_io_uring_; }
+
     ssize_t write_data(
-            uint8_t serial_fd,
+            int serial_fd,
             uint8_t* buf,
             size_t len,
             TransportRc& transport_rc);
 
     ssize_t read_data(
-            uint8_t serial_fd,
+            int serial_fd,
             uint8_t* buf,
             size_t len,
             int timeout,
             TransportRc& transport_rc);
 
+    bool read_port(
+            int serial_fd,
+            std::vector<InputPacket<MultiSerialEndPoint>>& input_packet,
+            TransportRc& transport_rc);
+
+    void push_error_fd(
+            int serial_fd);
+
+#ifdef UAGENT_IO_URING_PROFILE
+    /**
+     * @brief Reads what each port has into its input, the ring submitting every read at once.
+     */
+    void read_ports(
+            const std::vector<int>& serial_fds,
+            TransportRc& transport_rc);
+
+    /**
+     * @brief Writes the output of each port, the ring submitting every write at once.
+     */
+    bool write_ports(
+            const std::vector<int>& serial_fds,
+            TransportRc& transport_rc);
+
+    /**
+     * @brief Sets up the ring of the calling thread on its first batch, or tells it is not available.
+     */
+    bool prepare_ring(
+            util::IoUring& ring,
+            bool& fallback);
+
+    /**
+     * @brief Submits the queued operations and waits for their completions. On error the ring is
+     *        dropped and the calling thread falls back to read and write.
+     */
+    bool submit_ring(
+            util::IoUring& ring,
+            bool& fallback,
+            unsigned count);
+#endif
+
 protected:
+    /**
+     * @brief Per-port framing state. Each port owns its reception buffer, as the
+     *        framing state machine writes partial payloads into it across reads.
+     */
+    struct SerialPort
+    {
+        SerialPort(
+                FramingIO&& io)
+            : framing_io{std::move(io)}
+            , buffer{new uint8_t[SERVER_BUFFER_SIZE]}
+#ifdef UAGENT_IO_URING_PROFILE
+            , input{new uint8_t[SERVER_BUFFER_SIZE]}
+            , input_pos{0}
+            , input_len{0}
+            , output{}
+#endif
+        {}
+
+        FramingIO framing_io;
+        std::unique_ptr<uint8_t[]> buffer;
+#ifdef UAGENT_IO_URING_PROFILE
+        /* Bytes of the last batch read, handed to the framing by read_data. */
+        std::unique_ptr<uint8_t[]> input;
+        size_t input_pos;
+        size_t input_len;
+        /* Frames of the current send batch, written at once. */
+        std::vector<uint8_t> output;
+#endif
+    };
+
+    static constexpr int max_epoll_events = 64;
+    static constexpr size_t max_frames_per_event = 16;
+
     std::mutex error_mtx;
     std::vector<int> error_fd;
-    
+
     utils::SharedMutexPriority framing_mtx;
-    std::map<int, FramingIO> framing_io;
-    fd_set read_fds;
+    std::map<int, SerialPort> framing_io;
+    int epoll_fd_;
+    struct epoll_event epoll_events_[max_epoll_events];
+
+    /*
+     * Ports that hit max_frames_per_event. Their remaining frames may already sit in the FramingIO
+     * buffer, where level-triggered epoll cannot see them, so they are read again on the next call.
+     */
+    std::vector<int> capped_fds_;
 
     uint8_t addr_;
-    uint8_t buffer_[SERVER_BUFFER_SIZE];
+    const bool use_io_uring_;
+#ifdef UAGENT_IO_URING_PROFILE
+    /* One ring for the receiver thread and one for the sender thread, each only touched by its own. */
+    util::IoUring read_ring_;
+    util::IoUring write_ring_;
+    bool read_ring_fallback_;
+    bool write_ring_fallback_;
+#endif
 };
 
 } // namespace uxr
@@ -32,7 +32,8 @@ public:
             int open_flags,
             termios const & termios_attrs,
             uint8_t addr,
-            Middleware::Kind middleware_kind);
+            Middleware::Kind middleware_kind,
+            bool io_uring = false);
 
     ~MultiTermiosAgent();
 
@@ -51,6 +52,13 @@ public:
 
 private:
     void init_multiport();
+    void watch_devices(
+            int inotify_fd,
+            bool& watching_all);
+    void wait_devices(
+            int inotify_fd,
+            int timeout);
+    void wake_init_multiport();
     bool init() final;
     bool fini() final;
     bool handle_error(
@@ -58,6 +66,7 @@ private:
 
     std::thread init_serial;
     std::condition_variable init_serial_cv;
+    int wakeup_fd_;
 
     std::mutex devs_mtx;
     std::atomic<bool> exitSignal;
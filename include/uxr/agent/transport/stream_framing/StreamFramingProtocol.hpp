@@ -136,6 +136,25 @@ public:
             uint8_t remote_addr,
             TransportRc& transport_rc);
 
+    /**
+     * @brief Write a message made of two segments as a single frame, so that fragments are framed
+     *        straight from their header and their shared payload.
+     * @param head Buffer of the first segment.
+     * @param head_len Length of the first segment.
+     * @param payload Buffer of the second segment.
+     * @param payload_len Length of the second segment.
+     * @param remote_addr Remote address to where the message will be sent.
+     * @param transport_rc Return code of the write operation.
+     * @return size_t Number of written bytes.
+     */
+    size_t write_framed_msg(
+            const uint8_t* head,
+            size_t head_len,
+            const uint8_t* payload,
+            size_t payload_len,
+            uint8_t remote_addr,
+            TransportRc& transport_rc);
+
     /**
      * @brief Read message using the stream framing protocol
      *        and the previously user provided ReadCallback method.
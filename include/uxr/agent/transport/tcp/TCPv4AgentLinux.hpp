@@ -17,12 +17,16 @@
 
 #include <uxr/agent/transport/tcp/TCPServerBase.hpp>
 #include <uxr/agent/transport/Server.hpp>
+#ifdef UAGENT_IO_URING_PROFILE
+#include <uxr/agent/transport/util/IoUringLinux.hpp>
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
 #include <uxr/agent/transport/discovery/DiscoveryServerLinux.hpp>
 #endif
 
 #include <netinet/in.h>
 #include <sys/poll.h>
+#include <sys/uio.h>
 #include <array>
 #include <list>
 #include <set>
@@ -34,6 +38,15 @@ namespace uxr {
 struct TCPv4ConnectionLinux : public TCPv4Connection
 {
     struct pollfd* poll_fd;
+#ifdef UAGENT_IO_URING_PROFILE
+    /* Bumped on each open, so that the completions of a former connection on this slot are ignored. */
+    uint32_t generation;
+    /* Generation the io_uring receive is armed for, only touched by the receiver thread. */
+    uint32_t ring_generation;
+    /* Received data not yet framed, only set while the receiver thread handles a completion. */
+    const uint8_t* ring_data;
+    size_t ring_len;
+#endif
 };
 
 extern template class Server<IPv4EndPoint>; // Explicit instantiation declaration.
@@ -41,9 +54,16 @@ extern template class Server<IPv4EndPoint>; // Explicit instantiation declaratio
 class TCPv4Agent : public Server<IPv4EndPoint>, public TCPServerBase<TCPv4ConnectionLinux>
 {
 public:
+    /**
+     * @param agent_port Port of the agent.
+     * @param middleware_kind Middleware of the agent.
+     * @param io_uring Receive through io_uring instead of poll and recv. It needs the
+     *        UAGENT_IO_URING_PROFILE build, otherwise, or if the kernel refuses it, poll is used.
+     */
     TCPv4Agent(
             uint16_t agent_port,
-            Middleware::Kind middleware_kind);
+            Middleware::Kind middleware_kind,
+            bool io_uring = false);
 
     ~TCPv4Agent() final;
 
@@ -84,10 +104,35 @@ private:
     bool handle_error(
             TransportRc transport_rc) final;
 
+    void fini_receiver(
+            size_t receiver) final;
+
     bool read_message(
             int timeout,
             TransportRc& transport_rc);
 
+#ifdef UAGENT_IO_URING_PROFILE
+    /**
+     * @brief Sets up the ring on the first reception. If that fails, the agent falls back to poll.
+     */
+    bool prepare_ring();
+
+    /**
+     * @brief Waits for the data of every connection with a single io_uring_enter, and frames it.
+     */
+    bool read_ring_message(
+            int timeout,
+            TransportRc& transport_rc);
+
+    /**
+     * @brief Arms the receive of the connections opened since the last call.
+     */
+    void arm_connections();
+
+    bool read_chunk(
+            const util::IoUringStreamReceiver::Chunk& chunk);
+#endif
+
     bool open_connection(
             int fd,
             struct sockaddr_in& sockaddr);
@@ -116,6 +161,12 @@ private:
             size_t len,
             TransportRc& transport_rc) final;
 
+    size_t send_data(
+            TCPv4ConnectionLinux& connection,
+            struct iovec* iov,
+            size_t iovcnt,
+            TransportRc& transport_rc);
+
 private:
     std::array<TCPv4ConnectionLinux, TCP_MAX_CONNECTIONS> connections_;
     std::set<uint32_t> active_connections_;
@@ -129,6 +180,13 @@ private:
     std::thread listener_thread_;
     std::atomic<bool> running_cond_;
     std::queue<InputPacket<IPv4EndPoint>> messages_queue_;
+    std::atomic<bool> use_io_uring_;
+#ifdef UAGENT_IO_URING_PROFILE
+    util::IoUringStreamReceiver ring_;
+    /* Written by the listener thread to have a new connection armed. */
+    int wake_fd_;
+    std::atomic<bool> arm_pending_;
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
     DiscoveryServerLinux<IPv4EndPoint> discovery_server_;
 #endif
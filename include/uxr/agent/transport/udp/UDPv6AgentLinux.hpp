@@ -17,14 +17,23 @@
 
 #include <uxr/agent/transport/Server.hpp>
 #include <uxr/agent/transport/endpoint/IPv6EndPoint.hpp>
+#ifdef UAGENT_IO_URING_PROFILE
+#include <uxr/agent/transport/util/IoUringLinux.hpp>
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
 #include <uxr/agent/transport/discovery/DiscoveryServerLinux.hpp>
 #endif
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstddef>
 #include <sys/poll.h>
+#include <map>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace eprosima {
 namespace uxr {
@@ -34,12 +43,28 @@ extern template class Server<IPv6EndPoint>; // Explicit instantiation declaratio
 class UDPv6Agent : public Server<IPv6EndPoint>
 {
 public:
+    /**
+     * @param port Port of the agent.
+     * @param middleware_kind Middleware of the agent.
+     * @param socket_count Number of SO_REUSEPORT sockets bound to the port, each one served by its own
+     *        receiver thread. The kernel hashes each client flow to one of them.
+     * @param io_uring Receive through io_uring instead of poll and recvfrom. It needs the
+     *        UAGENT_IO_URING_PROFILE build, otherwise, or if the kernel refuses it, poll is used.
+     */
     UDPv6Agent(
             uint16_t port,
-            Middleware::Kind middleware_kind);
+            Middleware::Kind middleware_kind,
+            size_t socket_count = 1,
+            bool io_uring = false);
 
     ~UDPv6Agent() final;
 
+    /**
+     * @brief System calls made by the receiver threads to wait for and read datagrams: poll and
+     *        recvfrom, or io_uring_enter when receiving through io_uring.
+     */
+    uint64_t get_receive_syscalls() const { return receive_syscalls_; }
+
 #ifdef UAGENT_DISCOVERY_PROFILE
     bool has_discovery() final { return true; }
 
@@ -71,6 +96,43 @@ private:
             int timeout,
             TransportRc& transport_rc) final;
 
+    size_t receiver_count() const final { return poll_fds_.size(); }
+
+    void init_receiver(
+            size_t receiver) final;
+
+    void fini_receiver(
+            size_t receiver) final;
+
+    bool recv_message(
+            InputPacket<IPv6EndPoint>& input_packet,
+            int timeout,
+            TransportRc& transport_rc,
+            size_t receiver) final;
+
+#ifdef UAGENT_IO_URING_PROFILE
+    /**
+     * @brief Sets up the ring of the receiver for the current socket, in the receiver thread so that
+     *        it is the submitter of the multishot receive. If that fails, this receiver falls back
+     *        to poll for good, while the others keep their rings.
+     */
+    bool prepare_ring(
+            size_t receiver);
+#endif
+
+    /**
+     * @brief Records that the source arrived on the socket of the receiver, in its own shard.
+     */
+    void track_endpoint(
+            size_t receiver,
+            const IPv6EndPoint& source);
+
+    /**
+     * @brief Index of the socket the destination last arrived on, so that replies leave from it.
+     */
+    size_t get_socket(
+            const IPv6EndPoint& destination);
+
     bool send_message(
             OutputPacket<IPv6EndPoint> output_packet,
             TransportRc& transport_rc) final;
@@ -79,9 +141,28 @@ private:
             TransportRc transport_rc) final;
 
 private:
-    struct pollfd poll_fd_;
-    uint8_t buffer_[SERVER_BUFFER_SIZE];
+    std::vector<struct pollfd> poll_fds_;
+    std::vector<std::array<uint8_t, SERVER_BUFFER_SIZE>> buffers_;
     uint16_t agent_port_;
+    /*
+     * Endpoints seen by each receiver and when, so that a receiver thread only contends with the
+     * sender for its own shard. The sender replies from the socket that saw the endpoint last.
+     */
+    struct EndPointShard
+    {
+        std::mutex mtx;
+        std::map<IPv6EndPoint, std::chrono::steady_clock::time_point> last_seen;
+    };
+    std::vector<EndPointShard> endpoint_shards_;
+    std::atomic<bool> use_io_uring_;
+    std::atomic<uint64_t> receive_syscalls_;
+#ifdef UAGENT_IO_URING_PROFILE
+    std::vector<util::IoUringReceiver> rings_;
+    std::vector<uint32_t> ring_generations_;
+    /* One flag per receiver, each one only touched by its receiver thread. */
+    std::vector<uint8_t> ring_fallbacks_;
+    std::atomic<uint32_t> socket_generation_;
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
     DiscoveryServerLinux<IPv6EndPoint> discovery_server_;
 #endif
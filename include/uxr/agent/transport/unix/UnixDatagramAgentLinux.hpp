@@ -0,0 +1,83 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_UNIX_UNIXDATAGRAMAGENTLINUX_HPP_
+#define UXR_AGENT_TRANSPORT_UNIX_UNIXDATAGRAMAGENTLINUX_HPP_
+
+#include <uxr/agent/transport/Server.hpp>
+#include <uxr/agent/transport/endpoint/UnixEndPoint.hpp>
+
+#include <sys/poll.h>
+
+#include <array>
+#include <string>
+
+namespace eprosima {
+namespace uxr {
+
+extern template class Server<UnixEndPoint>; // Explicit instantiation declaration.
+
+/**
+ * @brief Agent for clients on the same host, served over an AF_UNIX SOCK_DGRAM socket bound to a
+ *        path. Replies go to the path of the client socket, so clients must bind theirs, either to
+ *        a path or to a kernel-chosen abstract name (autobind); datagrams from unbound sockets are dropped.
+ */
+class UnixDatagramAgent : public Server<UnixEndPoint>
+{
+public:
+    /**
+     * @param path Path of the agent socket, or an abstract name if it starts with '@'.
+     * @param middleware_kind Middleware of the agent.
+     */
+    UnixDatagramAgent(
+            const std::string& path,
+            Middleware::Kind middleware_kind);
+
+    ~UnixDatagramAgent() final;
+
+#ifdef UAGENT_DISCOVERY_PROFILE
+    bool has_discovery() final { return false; }
+#endif
+
+#ifdef UAGENT_P2P_PROFILE
+    bool has_p2p() final { return false; }
+#endif
+
+private:
+    bool init() final;
+
+    bool fini() final;
+
+    bool recv_message(
+            InputPacket<UnixEndPoint>& input_packet,
+            int timeout,
+            TransportRc& transport_rc) final;
+
+    bool send_message(
+            OutputPacket<UnixEndPoint> output_packet,
+            TransportRc& transport_rc) final;
+
+    bool handle_error(
+            TransportRc transport_rc) final;
+
+private:
+    const std::string path_;
+    struct pollfd poll_fd_;
+    std::array<uint8_t, SERVER_BUFFER_SIZE> buffer_;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_UNIX_UNIXDATAGRAMAGENTLINUX_HPP_
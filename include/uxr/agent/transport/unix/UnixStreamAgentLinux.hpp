@@ -0,0 +1,100 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_UNIX_UNIXSTREAMAGENTLINUX_HPP_
+#define UXR_AGENT_TRANSPORT_UNIX_UNIXSTREAMAGENTLINUX_HPP_
+
+#include <uxr/agent/transport/Server.hpp>
+#include <uxr/agent/transport/endpoint/UnixEndPoint.hpp>
+
+#include <sys/poll.h>
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+
+extern template class Server<UnixEndPoint>; // Explicit instantiation declaration.
+
+/**
+ * @brief Agent for clients on the same host, served over AF_UNIX SOCK_SEQPACKET connections.
+ *        The socket keeps message boundaries, so no stream framing is needed, and each connection
+ *        is identified by the credentials of its peer (SO_PEERCRED) plus a counter of accepted
+ *        connections, so every connection of a process gets its own session.
+ */
+class UnixStreamAgent : public Server<UnixEndPoint>
+{
+public:
+    /**
+     * @param path Path of the listening socket, or an abstract name if it starts with '@'.
+     * @param middleware_kind Middleware of the agent.
+     */
+    UnixStreamAgent(
+            const std::string& path,
+            Middleware::Kind middleware_kind);
+
+    ~UnixStreamAgent() final;
+
+#ifdef UAGENT_DISCOVERY_PROFILE
+    bool has_discovery() final { return false; }
+#endif
+
+#ifdef UAGENT_P2P_PROFILE
+    bool has_p2p() final { return false; }
+#endif
+
+private:
+    bool init() final;
+
+    bool fini() final;
+
+    bool recv_message(
+            InputPacket<UnixEndPoint>& input_packet,
+            int timeout,
+            TransportRc& transport_rc) final;
+
+    bool send_message(
+            OutputPacket<UnixEndPoint> output_packet,
+            TransportRc& transport_rc) final;
+
+    bool handle_error(
+            TransportRc transport_rc) final;
+
+    void accept_connection();
+
+    void close_connection(
+            size_t connection);
+
+private:
+    static constexpr size_t max_connections = 64;
+
+    const std::string path_;
+    /* The listener goes first, followed by one slot per connection. */
+    std::vector<struct pollfd> poll_fds_;
+    std::vector<UnixEndPoint> endpoints_;
+    std::map<UnixEndPoint, size_t> endpoint_to_connection_map_;
+    std::mutex connections_mtx_;
+    size_t next_connection_;
+    uint64_t accepted_connections_;
+    std::array<uint8_t, SERVER_BUFFER_SIZE> buffer_;
+};
+
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_UNIX_UNIXSTREAMAGENTLINUX_HPP_
@@ -0,0 +1,308 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_UTIL_IOURINGLINUX_HPP_
+#define UXR_AGENT_TRANSPORT_UTIL_IOURINGLINUX_HPP_
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <cstdint>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+namespace eprosima {
+namespace uxr {
+namespace util {
+
+/**
+ * @brief io_uring instance driven through the raw system calls.
+ *
+ * Submissions are queued with get_sqe() and handed to the kernel together by submit(), which is
+ * also where the caller waits. Completions are reaped from the shared completion queue by pop()
+ * without a system call, so a batch of operations costs a single io_uring_enter.
+ *
+ * Optionally a ring of buffers is registered for the operations that let the kernel pick their
+ * buffer, IOSQE_BUFFER_SELECT on buffer_group.
+ *
+ * The ring is not thread-safe: each instance is meant to be driven by a single thread.
+ */
+class IoUring
+{
+public:
+    struct Completion
+    {
+        uint64_t user_data = 0;
+        int32_t res = 0;
+        uint32_t flags = 0;
+    };
+
+    static const uint16_t buffer_group = 0;
+
+    IoUring() = default;
+
+    ~IoUring();
+
+    IoUring(IoUring&&) = delete;
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(IoUring&&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /**
+     * @brief Sets up the rings.
+     * @param entries               Submission queue entries, a power of two.
+     * @param completion_entries    Completion queue entries, a power of two not below entries.
+     */
+    bool init(
+            unsigned entries,
+            unsigned completion_entries);
+
+    /**
+     * @brief Registers the buffers the kernel picks from, all of them given to it up front.
+     * @param buffer_size   Size of each buffer.
+     * @param buffer_count  Number of buffers, a power of two.
+     */
+    bool init_buffers(
+            size_t buffer_size,
+            uint16_t buffer_count);
+
+    void fini();
+
+    bool is_init() const { return -1 != ring_fd_; }
+
+    /**
+     * @brief Queues a cleared submission for the operation, submitting the queue first if it is full.
+     * @return The entry to complete before the next submit(), or nullptr on error.
+     */
+    struct io_uring_sqe* get_sqe(
+            uint8_t opcode,
+            int fd,
+            uint64_t user_data);
+
+    /**
+     * @brief Submits the queued entries and waits up to timeout milliseconds, -1 for ever, until
+     *        min_complete completions are available. Nothing is entered with neither.
+     * @return false on error. A timeout or an interruption is not an error, pop() tells.
+     */
+    bool submit(
+            unsigned min_complete,
+            int timeout);
+
+    /**
+     * @brief Takes the next completion.
+     */
+    bool pop(
+            Completion& completion);
+
+    uint8_t* get_buffer(
+            uint16_t buffer_id) const;
+
+    /**
+     * @brief Gives a buffer back to the kernel.
+     */
+    void add_buffer(
+            uint16_t buffer_id);
+
+    /**
+     * @brief Number of io_uring_enter calls issued, to compare with the operations completed.
+     */
+    uint64_t get_enter_count() const { return enter_count_; }
+
+private:
+    int ring_fd_ = -1;
+    unsigned sq_entries_ = 0;
+
+    void* sq_ptr_ = nullptr;
+    size_t sq_size_ = 0;
+    void* cq_ptr_ = nullptr;
+    size_t cq_size_ = 0;
+    struct io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    struct io_uring_cqe* cqes_ = nullptr;
+
+    struct io_uring_buf_ring* buf_ring_ = nullptr;
+    size_t buf_ring_size_ = 0;
+    uint8_t* buffers_ = nullptr;
+    size_t buffers_size_ = 0;
+    size_t buffer_size_ = 0;
+    uint16_t buffer_count_ = 0;
+    uint16_t buf_ring_tail_ = 0;
+
+    uint64_t enter_count_ = 0;
+};
+
+/**
+ * @brief Datagram receiver built on an IoUring.
+ *
+ * A single multishot RECVMSG keeps the socket armed, and the kernel places each datagram, with
+ * its source address, in one of the registered buffers. io_uring_enter is only issued to wait
+ * when the completion queue is empty, so a burst of datagrams costs a single call.
+ */
+class IoUringReceiver
+{
+public:
+    struct Datagram
+    {
+        const uint8_t* data = nullptr;
+        size_t len = 0;
+        const struct sockaddr* source = nullptr;
+        uint16_t buffer_id = 0;
+    };
+
+    IoUringReceiver() = default;
+
+    ~IoUringReceiver();
+
+    IoUringReceiver(IoUringReceiver&&) = delete;
+    IoUringReceiver(const IoUringReceiver&) = delete;
+    IoUringReceiver& operator=(IoUringReceiver&&) = delete;
+    IoUringReceiver& operator=(const IoUringReceiver&) = delete;
+
+    /**
+     * @brief Sets up the rings, registers the buffers and arms the receive on the socket.
+     * @param fd            Bound datagram socket.
+     * @param buffer_size   Largest datagram accepted, bigger ones are dropped.
+     * @param buffer_count  Number of registered buffers, a power of two.
+     */
+    bool init(
+            int fd,
+            size_t buffer_size,
+            uint16_t buffer_count);
+
+    void fini();
+
+    /**
+     * @brief Takes the next received datagram, waiting up to timeout milliseconds for one.
+     * @return 1 if a datagram was taken, 0 on timeout and -1 on error. A taken datagram must be
+     *         given back with release() once its data has been consumed.
+     */
+    int receive(
+            int timeout,
+            Datagram& datagram);
+
+    void release(
+            const Datagram& datagram);
+
+    uint64_t get_enter_count() const { return ring_.get_enter_count(); }
+
+private:
+    bool arm();
+
+private:
+    IoUring ring_;
+    int socket_fd_ = -1;
+    struct msghdr msg_{};
+    bool armed_ = false;
+};
+
+/**
+ * @brief Receiver of several byte streams built on an IoUring.
+ *
+ * Each stream keeps a multishot RECV armed, so the data of all the connections is collected by a
+ * single io_uring_enter. The data lands in the registered buffers, tagged with the stream id the
+ * stream was added with.
+ *
+ * Another thread can interrupt a wait through the eventfd given to init(), for instance to have
+ * a new stream added.
+ */
+class IoUringStreamReceiver
+{
+public:
+    struct Chunk
+    {
+        uint64_t stream = 0;
+        const uint8_t* data = nullptr;
+        size_t len = 0;
+        /* Result of the receive: the bytes received, 0 at the end of the stream or a negated errno. */
+        int32_t result = 0;
+        /* Whether the receive is still armed. If not, the stream must be added again to go on. */
+        bool armed = false;
+        bool has_buffer = false;
+        uint16_t buffer_id = 0;
+    };
+
+    IoUringStreamReceiver() = default;
+
+    ~IoUringStreamReceiver();
+
+    IoUringStreamReceiver(IoUringStreamReceiver&&) = delete;
+    IoUringStreamReceiver(const IoUringStreamReceiver&) = delete;
+    IoUringStreamReceiver& operator=(IoUringStreamReceiver&&) = delete;
+    IoUringStreamReceiver& operator=(const IoUringStreamReceiver&) = delete;
+
+    /**
+     * @brief Sets up the rings and registers the buffers.
+     * @param wake_fd       Blocking eventfd that interrupts receive() when written.
+     * @param buffer_size   Size of each registered buffer.
+     * @param buffer_count  Number of registered buffers, a power of two.
+     */
+    bool init(
+            int wake_fd,
+            size_t buffer_size,
+            uint16_t buffer_count);
+
+    void fini();
+
+    bool is_init() const { return ring_.is_init(); }
+
+    /**
+     * @brief Arms the receive on a connected socket, submitted with the next receive().
+     *        Every chunk of the socket carries the stream id, which cannot be UINT64_MAX.
+     *        The socket must be shut down before it is closed, for the receive to end.
+     */
+    bool add(
+            int fd,
+            uint64_t stream);
+
+    /**
+     * @brief Takes the next chunk of any stream, waiting up to timeout milliseconds for one.
+     *        A zero timeout only takes what is already completed, without a system call.
+     * @return 1 if a chunk was taken, 0 on timeout or wake up and -1 on error. A taken chunk must
+     *         be given back with release() once its data has been consumed.
+     */
+    int receive(
+            int timeout,
+            Chunk& chunk);
+
+    void release(
+            const Chunk& chunk);
+
+    uint64_t get_enter_count() const { return ring_.get_enter_count(); }
+
+private:
+    bool arm_wake();
+
+private:
+    IoUring ring_;
+    int wake_fd_ = -1;
+    uint64_t wake_value_ = 0;
+    bool wake_armed_ = false;
+};
+
+} // namespace util
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_UTIL_IOURINGLINUX_HPP_
@@ -0,0 +1,103 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_TRANSPORT_UTIL_UNIXSOCKETLINUX_HPP_
+#define UXR_AGENT_TRANSPORT_UTIL_UNIXSOCKETLINUX_HPP_
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace eprosima {
+namespace uxr {
+namespace util {
+
+/**
+ * @brief Fills a socket address from a path, where a leading null character selects the abstract
+ *        namespace. Fails if the path does not fit.
+ */
+inline
+bool to_unix_address(
+        const std::string& path,
+        struct sockaddr_un& address,
+        socklen_t& address_len)
+{
+    if (path.empty() || (sizeof(address.sun_path) <= path.size()))
+    {
+        return false;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, path.data(), path.size());
+    address_len = socklen_t(offsetof(struct sockaddr_un, sun_path) + path.size() + ('\0' == path.front() ? 0 : 1));
+    return true;
+}
+
+/**
+ * @brief Path of a received socket address, empty if the peer socket is unnamed.
+ */
+inline
+std::string from_unix_address(
+        const struct sockaddr_un& address,
+        socklen_t address_len)
+{
+    const size_t offset = offsetof(struct sockaddr_un, sun_path);
+    if (address_len <= offset)
+    {
+        return std::string{};
+    }
+
+    const size_t len = std::min(size_t(address_len) - offset, sizeof(address.sun_path));
+    return ('\0' == address.sun_path[0])
+           ? std::string(address.sun_path, len)
+           : std::string(address.sun_path, strnlen(address.sun_path, len));
+}
+
+/**
+ * @brief Path given on the command line, where a leading '@' stands for the abstract namespace.
+ */
+inline
+std::string to_unix_path(
+        const std::string& name)
+{
+    return (!name.empty() && ('@' == name.front())) ? std::string(1, '\0') + name.substr(1) : name;
+}
+
+/**
+ * @brief Removes a socket left behind at the path by a previous run. Anything else is kept, so that
+ *        a mistyped path cannot delete a regular file.
+ */
+inline
+void remove_stale_socket(
+        const std::string& path)
+{
+    struct stat st{};
+    if (!path.empty() && ('\0' != path.front()) && (0 == lstat(path.c_str(), &st)) && S_ISSOCK(st.st_mode))
+    {
+        ::unlink(path.c_str());
+    }
+}
+
+} // namespace util
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_TRANSPORT_UTIL_UNIXSOCKETLINUX_HPP_
@@ -22,6 +22,7 @@
 #include <type_traits>
 #include <unordered_map>
 #include <uxr/agent/transport/Server.hpp>
+#include <uxr/agent/utils/ThreadSettings.hpp>
 #include <uxr/agent/config.hpp>
 
 #ifdef _WIN32
@@ -43,6 +44,11 @@
 #include <uxr/agent/transport/can/CanAgentLinux.hpp>
 #endif // UAGENT_SOCKETCAN_PROFILE
 
+#ifdef UAGENT_UNIX_PROFILE
+#include <uxr/agent/transport/unix/UnixDatagramAgentLinux.hpp>
+#include <uxr/agent/transport/unix/UnixStreamAgentLinux.hpp>
+#endif // UAGENT_UNIX_PROFILE
+
 #include <termios.h>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -68,6 +74,10 @@ enum class TransportKind
 #ifdef UAGENT_SOCKETCAN_PROFILE
     CAN,
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+    UNIX_DGRAM,
+    UNIX_STREAM,
+#endif // UAGENT_UNIX_PROFILE
     SERIAL,
     MULTISERIAL,
     PSEUDOTERMINAL,
@@ -469,11 +479,35 @@ public:
         , refs_("-r", "--refs")
         , verbose_("-v", "--verbose", static_cast<uint16_t>(DEFAULT_VERBOSE_LEVEL),
             {0, 1, 2, 3, 4, 5, 6})
+        , max_clients_("-Oc", "--max-clients")
+        , max_entities_("-Oe", "--max-entities")
+        , max_queued_bytes_("-Ob", "--max-queued-bytes")
+        , max_ingress_rate_("-Oi", "--max-ingress-rate")
+#ifdef UAGENT_LOGGER_PROFILE
+        , async_log_("-a", "--async-log", ArgumentKind::NO_VALUE)
+#endif
+#ifdef UAGENT_CAPTURE_PROFILE
+        , capture_("-c", "--capture")
+#endif
+#ifdef UAGENT_SNAPSHOT_PROFILE
+        , snapshot_("-s", "--snapshot")
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
         , discovery_("-d", "--discovery", static_cast<uint16_t>(DEFAULT_DISCOVERY_PORT), {}, false)
 #endif
 #ifdef UAGENT_P2P_PROFILE
         , p2p_("-P", "--p2p")
+#endif
+#ifndef _WIN32
+        , thread_args_{
+            {uxr::utils::ThreadKind::RECEIVER, Argument<std::string>("-Tr", "--receiver-thread")},
+            {uxr::utils::ThreadKind::SENDER, Argument<std::string>("-Ts", "--sender-thread")},
+            {uxr::utils::ThreadKind::PROCESSING, Argument<std::string>("-Tp", "--processing-thread")},
+            {uxr::utils::ThreadKind::HEARTBEAT, Argument<std::string>("-Th", "--heartbeat-thread")},
+            {uxr::utils::ThreadKind::ERROR_HANDLER, Argument<std::string>("-Te", "--error-thread")},
+            {uxr::utils::ThreadKind::READER, Argument<std::string>("-Td", "--reader-thread")},
+            {uxr::utils::ThreadKind::MIDDLEWARE, Argument<std::string>("-Tm", "--middleware-thread")}}
+        , lock_memory_("-L", "--lock-memory", ArgumentKind::NO_VALUE)
 #endif
     {
     }
@@ -528,6 +562,35 @@ public:
             result.first = false;
             return result;
         }
+        if ((ParseResult::INVALID == max_clients_.parse_argument(argc, argv)) ||
+            (ParseResult::INVALID == max_entities_.parse_argument(argc, argv)) ||
+            (ParseResult::INVALID == max_queued_bytes_.parse_argument(argc, argv)) ||
+            (ParseResult::INVALID == max_ingress_rate_.parse_argument(argc, argv)))
+        {
+            result.first = false;
+            return result;
+        }
+#ifdef UAGENT_LOGGER_PROFILE
+        if (ParseResult::INVALID == async_log_.parse_argument(argc, argv))
+        {
+            result.first = false;
+            return result;
+        }
+#endif
+#ifdef UAGENT_CAPTURE_PROFILE
+        if (ParseResult::INVALID == capture_.parse_argument(argc, argv))
+        {
+            result.first = false;
+            return result;
+        }
+#endif
+#ifdef UAGENT_SNAPSHOT_PROFILE
+        if (ParseResult::INVALID == snapshot_.parse_argument(argc, argv))
+        {
+            result.first = false;
+            return result;
+        }
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
         if (ParseResult::INVALID == discovery_.parse_argument(argc, argv))
         {
@@ -541,10 +604,51 @@ public:
             result.first = false;
             return result;
         }
+#endif
+#ifndef _WIN32
+        for (auto& thread_arg : thread_args_)
+        {
+            ParseResult parse_thread = thread_arg.second.parse_argument(argc, argv);
+            uxr::utils::ThreadPolicy policy;
+            if ((ParseResult::INVALID == parse_thread) ||
+                ((ParseResult::VALID == parse_thread) &&
+                 !uxr::utils::ThreadSettings::parse_policy(thread_arg.second.value(), policy)))
+            {
+                std::cerr << "Warning: thread policy '" << thread_arg.second.value() << "' is not valid, ";
+                std::cerr << "expected <cpus>[:<other|fifo|rr>[:<priority>]]" << std::endl;
+                result.first = false;
+                return result;
+            }
+        }
+        if (ParseResult::INVALID == lock_memory_.parse_argument(argc, argv))
+        {
+            result.first = false;
+            return result;
+        }
 #endif
         return result;
     }
 
+    /* Thread policies are read by each thread when it starts, so they are set before the agent. */
+    void apply_thread_settings()
+    {
+#ifndef _WIN32
+        for (auto& thread_arg : thread_args_)
+        {
+            uxr::utils::ThreadPolicy policy;
+            if (thread_arg.second.found() &&
+                uxr::utils::ThreadSettings::parse_policy(thread_arg.second.value(), policy))
+            {
+                uxr::utils::ThreadSettings::set_policy(thread_arg.first, policy);
+            }
+        }
+        if (lock_memory_.found())
+        {
+            uxr::utils::ThreadSettings::lock_memory();
+        }
+#endif
+    }
+
     void apply_actions(
             std::unique_ptr<AgentType>& server)
     {
@@ -584,10 +688,37 @@ public:
         {
             server->load_config_file(refs_.value());
         }
+#ifdef UAGENT_SNAPSHOT_PROFILE
+        if (snapshot_.found())
+        {
+            server->enable_snapshot(snapshot_.value());
+        }
+#endif
         if (verbose_.found())
         {
             server->set_verbose_level(verbose_.value());
         }
+        if (max_clients_.found() || max_entities_.found() || max_queued_bytes_.found() || max_ingress_rate_.found())
+        {
+            uxr::utils::OverloadLimits limits{};
+            limits.max_clients = max_clients_.value();
+            limits.max_entities_per_client = max_entities_.value();
+            limits.max_queued_bytes = max_queued_bytes_.value();
+            limits.max_ingress_rate = max_ingress_rate_.value();
+            server->set_overload_limits(limits);
+        }
+#ifdef UAGENT_LOGGER_PROFILE
+        if (async_log_.found())
+        {
+            server->set_async_logging(true);
+        }
+#endif
+#ifdef UAGENT_CAPTURE_PROFILE
+        if (capture_.found())
+        {
+            server->enable_capture(capture_.value());
+        }
+#endif
     }
 
     const std::string get_help() const
@@ -597,11 +728,31 @@ public:
         ss << "    " << middleware_.get_help() << std::endl;
         ss << "    " << refs_.get_help() << std::endl;
         ss << "    " << verbose_.get_help() << std::endl;
+        ss << "    " << max_clients_.get_help() << std::endl;
+        ss << "    " << max_entities_.get_help() << std::endl;
+        ss << "    " << max_queued_bytes_.get_help() << std::endl;
+        ss << "    " << max_ingress_rate_.get_help() << std::endl;
+#ifdef UAGENT_LOGGER_PROFILE
+        ss << "    " << async_log_.get_help() << std::endl;
+#endif
+#ifdef UAGENT_CAPTURE_PROFILE
+        ss << "    " << capture_.get_help() << std::endl;
+#endif
+#ifdef UAGENT_SNAPSHOT_PROFILE
+        ss << "    " << snapshot_.get_help() << std::endl;
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
         ss << "    " << discovery_.get_help() << std::endl;
 #endif
 #ifdef UAGENT_P2P_PROFILE
         ss << "    " << p2p_.get_help() << std::endl;
+#endif
+#ifndef _WIN32
+        for (const auto& thread_arg : thread_args_)
+        {
+            ss << "    " << thread_arg.second.get_help() << " <cpus>[:<other|fifo|rr>[:<priority>]]" << std::endl;
+        }
+        ss << "    " << lock_memory_.get_help() << std::endl;
 #endif
         return ss.str();
     }
@@ -611,12 +762,29 @@ private:
     Argument<std::string> middleware_;
     Argument<std::string> refs_;
     Argument<uint8_t> verbose_;
+    Argument<uint32_t> max_clients_;
+    Argument<uint32_t> max_entities_;
+    Argument<uint32_t> max_queued_bytes_;
+    Argument<uint32_t> max_ingress_rate_;
+#ifdef UAGENT_LOGGER_PROFILE
+    Argument<dummy_type> async_log_;
+#endif
+#ifdef UAGENT_CAPTURE_PROFILE
+    Argument<std::string> capture_;
+#endif
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    Argument<std::string> snapshot_;
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
     Argument<uint16_t> discovery_;
 #endif
 #ifdef UAGENT_P2P_PROFILE
     Argument<uint16_t> p2p_;
 #endif
+#ifndef _WIN32
+    std::vector<std::pair<uxr::utils::ThreadKind, Argument<std::string>>> thread_args_;
+    Argument<dummy_type> lock_memory_;
+#endif
 };
 
 /*************************************************************************************************
@@ -628,6 +796,12 @@ class IPvXArgs
 public:
     IPvXArgs()
         : port_("-p", "--port")
+#ifndef _WIN32
+        , sockets_("-S", "--sockets", static_cast<uint16_t>(1))
+#endif
+#ifdef UAGENT_IO_URING_PROFILE
+        , io_uring_("-U", "--io-uring", ArgumentKind::NO_VALUE)
+#endif
     {
     }
 
@@ -640,6 +814,27 @@ public:
         {
             std::cerr << "Warning: '--port <value>' is required" << std::endl;
         }
+#ifndef _WIN32
+        ParseResult parse_sockets = sockets_.parse_argument(argc, argv);
+        if (ParseResult::INVALID == parse_sockets || 0 == sockets_.value())
+        {
+            std::cerr << "Warning: '--sockets <value>' shall be greater than 0" << std::endl;
+            return false;
+        }
+        /* The option always parses as valid through its default value, hence the value check. */
+        if ((1 < sockets_.value()) &&
+            !std::is_same<AgentType, UDPv4Agent>::value && !std::is_same<AgentType, UDPv6Agent>::value)
+        {
+            std::cerr << "Warning: '--sockets <value>' is only available for UDP" << std::endl;
+            return false;
+        }
+#endif
+#ifdef UAGENT_IO_URING_PROFILE
+        if (ParseResult::INVALID == io_uring_.parse_argument(argc, argv))
+        {
+            return false;
+        }
+#endif
         return (ParseResult::VALID == parse_port ? true : false);
     }
 
@@ -648,15 +843,43 @@ public:
         return port_.value();
     }
 
+#ifndef _WIN32
+    uint16_t sockets() const
+    {
+        return sockets_.value();
+    }
+
+    bool io_uring()
+    {
+#ifdef UAGENT_IO_URING_PROFILE
+        return io_uring_.found();
+#else
+        return false;
+#endif
+    }
+#endif
+
     const std::string get_help() const
     {
         std::stringstream ss;
         ss << "    " << port_.get_help() << std::endl;
+#ifndef _WIN32
+        ss << "    " << sockets_.get_help() << " (UDP only)" << std::endl;
+#endif
+#ifdef UAGENT_IO_URING_PROFILE
+        ss << "    " << io_uring_.get_help() << " (UDP and TCP)" << std::endl;
+#endif
         return ss.str();
     }
 
 private:
     Argument<uint16_t> port_;
+#ifndef _WIN32
+    Argument<uint16_t> sockets_;
+#endif
+#ifdef UAGENT_IO_URING_PROFILE
+    Argument<dummy_type> io_uring_;
+#endif
 };
 
 #ifndef _WIN32
@@ -793,6 +1016,9 @@ public:
         : PseudoTerminalArgs<AgentType>()
         , devs_("-D", "--devs")
         , file_("-f", "--file")
+#ifdef UAGENT_IO_URING_PROFILE
+        , io_uring_("-U", "--io-uring", ArgumentKind::NO_VALUE)
+#endif
     {
     }
 
@@ -804,6 +1030,12 @@ public:
         {
             return false;
         }
+#ifdef UAGENT_IO_URING_PROFILE
+        if (ParseResult::INVALID == io_uring_.parse_argument(argc, argv))
+        {
+            return false;
+        }
+#endif
         ParseResult parse_devs = devs_.parse_argument(argc, argv);
         ParseResult parse_file = file_.parse_argument(argc, argv);
         if (ParseResult::VALID != parse_devs && ParseResult::VALID != parse_file)
@@ -861,17 +1093,75 @@ public:
         return ports;
     }
 
+    bool io_uring()
+    {
+#ifdef UAGENT_IO_URING_PROFILE
+        return io_uring_.found();
+#else
+        return false;
+#endif
+    }
+
     const std::string get_help() const
     {
         std::stringstream ss;
         ss << "    " << devs_.get_help();
+#ifdef UAGENT_IO_URING_PROFILE
+        ss << std::endl << "    " << io_uring_.get_help() << " (multiserial only)";
+#endif
         return ss.str();
     }
 
 private:
     Argument<std::string> devs_;
     Argument<std::string> file_;
+#ifdef UAGENT_IO_URING_PROFILE
+    Argument<dummy_type> io_uring_;
+#endif
+};
+
+#ifdef UAGENT_UNIX_PROFILE
+/*************************************************************************************************
+ * Specific arguments for Unix domain socket transports
+ *************************************************************************************************/
+template <typename AgentType>
+class UnixArgs
+{
+public:
+    UnixArgs()
+        : path_("-D", "--path")
+    {
+    }
+
+    bool parse(
+            int argc,
+            char** argv)
+    {
+        ParseResult parse_path = path_.parse_argument(argc, argv);
+        if (ParseResult::VALID != parse_path)
+        {
+            std::cerr << "Warning: '--path <value>' is required" << std::endl;
+        }
+
+        return (ParseResult::VALID == parse_path ? true : false);
+    }
+
+    const std::string path()
+    {
+        return path_.value();
+    }
+
+    const std::string get_help() const
+    {
+        std::stringstream ss;
+        ss << "    " << path_.get_help() << " (a leading '@' selects the abstract namespace)" << std::endl;
+        return ss.str();
+    }
+
+private:
+    Argument<std::string> path_;
 };
+#endif // UAGENT_UNIX_PROFILE
 
 #ifdef UAGENT_SOCKETCAN_PROFILE
 /*************************************************************************************************
@@ -884,6 +1174,7 @@ public:
     CanArgs()
         : dev_("-D", "--dev")
         , can_id_("-I", "--id", DEFAULT_CAN_ID)
+        , can_mask_("-M", "--mask", DEFAULT_CAN_MASK)
     {
     }
 
@@ -899,6 +1190,7 @@ public:
         else
         {
             can_id_.parse_argument(argc, argv);
+            can_mask_.parse_argument(argc, argv);
         }
 
         return (ParseResult::VALID == parse_dev ? true : false);
@@ -914,16 +1206,24 @@ public:
         return can_id_.value();
     }
 
+    const std::string can_mask()
+    {
+        return can_mask_.value();
+    }
+
     const std::string get_help() const
     {
         std::stringstream ss;
-        ss << "    " << dev_.get_help();
+        ss << "    " << dev_.get_help() << std::endl;
+        ss << "    " << can_id_.get_help() << std::endl;
+        ss << "    " << can_mask_.get_help();
         return ss.str();
     }
 
 private:
     Argument<std::string> dev_;
     Argument<std::string> can_id_;
+    Argument<std::string> can_mask_;
 };
 #endif // UAGENT_SOCKETCAN_PROFILE
 #endif // _WIN32
@@ -947,6 +1247,9 @@ public:
 #ifdef UAGENT_SOCKETCAN_PROFILE
         , can_args_()
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+        , unix_args_()
+#endif // UAGENT_UNIX_PROFILE
         , serial_args_()
         , multiserial_args_()
         , pseudoterminal_args_()
@@ -987,6 +1290,14 @@ public:
                 break;
             }
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+            case TransportKind::UNIX_DGRAM:
+            case TransportKind::UNIX_STREAM:
+            {
+                result &= unix_args_.parse(argc_, argv_);
+                break;
+            }
+#endif // UAGENT_UNIX_PROFILE
             case TransportKind::SERIAL:
             {
                 result &= serial_args_.parse(argc_, argv_);
@@ -1015,6 +1326,7 @@ public:
 
     bool launch_agent()
     {
+        common_args_.apply_thread_settings();
         agent_server_.reset(new AgentType(ip_args_.port(), utils::get_mw_kind(common_args_.middleware())));
         if (agent_server_->start())
         {
@@ -1092,10 +1404,15 @@ public:
         ss << "  * SERIAL (serial, multiserial, pseudoterminal)" << std::endl;
         ss << pseudoterminal_args_.get_help();
         ss << serial_args_.get_help();
+        ss << multiserial_args_.get_help() << std::endl;
 #ifdef UAGENT_SOCKETCAN_PROFILE
         ss << "  * CAN FD (canfd)" << std::endl;
         ss << can_args_.get_help();
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+        ss << "  * UNIX (unixdgram, unixstream)" << std::endl;
+        ss << unix_args_.get_help();
+#endif // UAGENT_UNIX_PROFILE
 #endif // _WIN32
         ss << std::endl;
         // TODO(@jamoralp): Once documentation is updated with proper CLI section, add here an hyperlink to that section
@@ -1111,6 +1428,9 @@ private:
 #ifdef UAGENT_SOCKETCAN_PROFILE
     CanArgs<AgentType> can_args_;
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+    UnixArgs<AgentType> unix_args_;
+#endif // UAGENT_UNIX_PROFILE
     SerialArgs<AgentType> serial_args_;
     MultiSerialArgs<AgentType> multiserial_args_;
     PseudoTerminalArgs<AgentType> pseudoterminal_args_;
@@ -1120,10 +1440,85 @@ private:
 };
 
 #ifndef _WIN32
+template<> inline bool ArgumentParser<UDPv4Agent>::launch_agent()
+{
+    common_args_.apply_thread_settings();
+    agent_server_.reset(new UDPv4Agent(
+            ip_args_.port(), utils::get_mw_kind(common_args_.middleware()), ip_args_.sockets(),
+            ip_args_.io_uring()));
+    if (agent_server_->start())
+    {
+        common_args_.apply_actions(agent_server_);
+        return true;
+    }
+    else
+    {
+        std::cerr << "Error while starting IPvX agent!" << std::endl;
+    }
+
+    return false;
+}
+
+template<> inline bool ArgumentParser<UDPv6Agent>::launch_agent()
+{
+    common_args_.apply_thread_settings();
+    agent_server_.reset(new UDPv6Agent(
+            ip_args_.port(), utils::get_mw_kind(common_args_.middleware()), ip_args_.sockets(),
+            ip_args_.io_uring()));
+    if (agent_server_->start())
+    {
+        common_args_.apply_actions(agent_server_);
+        return true;
+    }
+    else
+    {
+        std::cerr << "Error while starting IPvX agent!" << std::endl;
+    }
+
+    return false;
+}
+
+template<> inline bool ArgumentParser<TCPv4Agent>::launch_agent()
+{
+    common_args_.apply_thread_settings();
+    agent_server_.reset(new TCPv4Agent(
+            ip_args_.port(), utils::get_mw_kind(common_args_.middleware()), ip_args_.io_uring()));
+    if (agent_server_->start())
+    {
+        common_args_.apply_actions(agent_server_);
+        return true;
+    }
+    else
+    {
+        std::cerr << "Error while starting IPvX agent!" << std::endl;
+    }
+
+    return false;
+}
+
+template<> inline bool ArgumentParser<TCPv6Agent>::launch_agent()
+{
+    common_args_.apply_thread_settings();
+    agent_server_.reset(new TCPv6Agent(
+            ip_args_.port(), utils::get_mw_kind(common_args_.middleware()), ip_args_.io_uring()));
+    if (agent_server_->start())
+    {
+        common_args_.apply_actions(agent_server_);
+        return true;
+    }
+    else
+    {
+        std::cerr << "Error while starting IPvX agent!" << std::endl;
+    }
+
+    return false;
+}
+
 template<> inline bool ArgumentParser<TermiosAgent>::launch_agent()
 {
     struct termios attr = init_termios(serial_args_.baud_rate().c_str());
     
+    common_args_.apply_thread_settings();
     agent_server_.reset(new TermiosAgent(
         serial_args_.dev().c_str(),  O_RDWR | O_NOCTTY, attr, 0, utils::get_mw_kind(common_args_.middleware())));
 
@@ -1144,8 +1539,10 @@ template<> inline bool ArgumentParser<MultiTermiosAgent>::launch_agent()
 {
     struct termios attr = init_termios(multiserial_args_.baud_rate().c_str());
 
+    common_args_.apply_thread_settings();
     agent_server_.reset(new MultiTermiosAgent(
-        multiserial_args_.devs(),  O_RDWR | O_NOCTTY, attr, 0, utils::get_mw_kind(common_args_.middleware())));
+        multiserial_args_.devs(),  O_RDWR | O_NOCTTY, attr, 0, utils::get_mw_kind(common_args_.middleware()),
+        multiserial_args_.io_uring()));
 
     if (agent_server_->start())
     {
@@ -1162,6 +1559,7 @@ template<> inline bool ArgumentParser<MultiTermiosAgent>::launch_agent()
 
 template<> inline bool ArgumentParser<PseudoTerminalAgent>::launch_agent()
 {
+    common_args_.apply_thread_settings();
     agent_server_.reset(new PseudoTerminalAgent(
             O_RDWR | O_NOCTTY, pseudoterminal_args_.baud_rate().c_str(), 0, utils::get_mw_kind(common_args_.middleware())));
     if (agent_server_->start())
@@ -1181,8 +1579,10 @@ template<> inline bool ArgumentParser<PseudoTerminalAgent>::launch_agent()
 template<> inline bool ArgumentParser<CanAgent>::launch_agent()
 {
     uint32_t can_id = strtoul(can_args_.can_id().c_str(), NULL, 16);
+    uint32_t can_mask = strtoul(can_args_.can_mask().c_str(), NULL, 16);
+    common_args_.apply_thread_settings();
     agent_server_.reset(new CanAgent(
-            can_args_.dev().c_str(), can_id, utils::get_mw_kind(common_args_.middleware())));
+            can_args_.dev().c_str(), can_id, utils::get_mw_kind(common_args_.middleware()), can_mask));
     if (agent_server_->start())
     {
         common_args_.apply_actions(agent_server_);
@@ -1196,6 +1596,42 @@ template<> inline bool ArgumentParser<CanAgent>::launch_agent()
     return false;
 }
 #endif // UAGENT_SOCKETCAN_PROFILE
+
+#ifdef UAGENT_UNIX_PROFILE
+template<> inline bool ArgumentParser<UnixDatagramAgent>::launch_agent()
+{
+    common_args_.apply_thread_settings();
+    agent_server_.reset(new UnixDatagramAgent(unix_args_.path(), utils::get_mw_kind(common_args_.middleware())));
+    if (agent_server_->start())
+    {
+        common_args_.apply_actions(agent_server_);
+        return true;
+    }
+    else
+    {
+        std::cerr << "Error while starting unixdgram agent!" << std::endl;
+    }
+
+    return false;
+}
+
+template<> inline bool ArgumentParser<UnixStreamAgent>::launch_agent()
+{
+    common_args_.apply_thread_settings();
+    agent_server_.reset(new UnixStreamAgent(unix_args_.path(), utils::get_mw_kind(common_args_.middleware())));
+    if (agent_server_->start())
+    {
+        common_args_.apply_actions(agent_server_);
+        return true;
+    }
+    else
+    {
+        std::cerr << "Error while starting unixstream agent!" << std::endl;
+    }
+
+    return false;
+}
+#endif // UAGENT_UNIX_PROFILE
 #endif // _WIN32
 
 } // namespace parser
@@ -0,0 +1,136 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_UTILS_BOUNDEDQUEUE_HPP_
+#define UXR_AGENT_UTILS_BOUNDEDQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace uxr {
+namespace utils {
+
+/**
+ * @brief Bounded lock-free queue of preallocated slots, for many producers and a single consumer.
+ *        Each slot carries a sequence number telling whether it is free, being filled or ready,
+ *        so producers never block: a push on a full queue fails immediately.
+ * @tparam Slot Type of the slots, which are filled and consumed in place.
+ */
+template<typename Slot>
+class BoundedQueue
+{
+public:
+    /**
+     * @param capacity Number of slots, it shall be a power of two.
+     */
+    explicit BoundedQueue(
+            size_t capacity)
+        : mask_(capacity - 1)
+        , cells_(new Cell[capacity])
+        , enqueue_pos_{0}
+        , dequeue_pos_{0}
+    {
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(BoundedQueue&&) = delete;
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    size_t capacity() const { return mask_ + 1; }
+
+    /**
+     * @brief Claim a free slot and fill it. Thread-safe.
+     * @param fill Callable taking a Slot&.
+     * @return true if a slot was filled, false if the queue is full.
+     */
+    template<typename Fill>
+    bool try_push(
+            Fill&& fill)
+    {
+        Cell* cell;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(sequence) - intptr_t(pos);
+            if (0 == diff)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (0 > diff)
+            {
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(cell->slot);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consume the oldest ready slot. Only one thread shall consume.
+     * @param consume Callable taking a Slot&.
+     * @return true if a slot was consumed, false if the queue is empty.
+     */
+    template<typename Consume>
+    bool try_pop(
+            Consume&& consume)
+    {
+        Cell& cell = cells_[dequeue_pos_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+        {
+            return false;
+        }
+
+        consume(cell.slot);
+        cell.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        Slot slot;
+    };
+
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    std::atomic<size_t> enqueue_pos_;
+    size_t dequeue_pos_;
+};
+
+} // namespace utils
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_UTILS_BOUNDEDQUEUE_HPP_
@@ -0,0 +1,191 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_UTILS_CORRELATIONTABLE_HPP_
+#define UXR_UTILS_CORRELATIONTABLE_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace utils {
+
+/**
+ * @brief Fixed-capacity table correlating the sequence numbers of pending requests with a value.
+ *        Sequence numbers grow by one per request, so each one takes the slot of the one issued
+ *        capacity requests before: an entry still there is evicted, as it is the oldest pending one.
+ *        Entries older than the expiry are evicted when they are found.
+ */
+template<typename Value>
+class CorrelationTable
+{
+public:
+    /**
+     * @param capacity Maximum number of pending requests.
+     * @param expiry Time after which a request is no longer waited for, 0 to wait forever.
+     */
+    CorrelationTable(
+            size_t capacity,
+            std::chrono::milliseconds expiry);
+
+    CorrelationTable(CorrelationTable&&) = delete;
+    CorrelationTable(const CorrelationTable&) = delete;
+    CorrelationTable& operator=(CorrelationTable&&) = delete;
+    CorrelationTable& operator=(const CorrelationTable&) = delete;
+
+    void insert(
+            uint64_t sequence,
+            const Value& value);
+
+    /**
+     * @brief Removes the entry of a sequence number.
+     * @return true if it was pending and not expired.
+     */
+    bool take(
+            uint64_t sequence,
+            Value& value);
+
+    /**
+     * @brief Number of entries, including the expired ones not found yet.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Number of entries evicted because they expired.
+     */
+    uint64_t expired() const;
+
+    /**
+     * @brief Number of entries evicted, before expiring, to make room for a newer one.
+     */
+    uint64_t overflowed() const;
+
+private:
+    struct Slot
+    {
+        uint64_t sequence;
+        Value value;
+        std::chrono::steady_clock::time_point timestamp;
+        bool used;
+    };
+
+    bool is_expired(
+            const Slot& slot,
+            std::chrono::steady_clock::time_point now) const;
+
+    mutable std::mutex mtx_;
+    std::vector<Slot> slots_;
+    const std::chrono::milliseconds expiry_;
+    size_t size_;
+    uint64_t expired_;
+    uint64_t overflowed_;
+};
+
+template<typename Value>
+inline CorrelationTable<Value>::CorrelationTable(
+        size_t capacity,
+        std::chrono::milliseconds expiry)
+    : mtx_()
+    , slots_((0 == capacity) ? 1 : capacity, Slot{0, Value(), std::chrono::steady_clock::time_point(), false})
+    , expiry_(expiry)
+    , size_(0)
+    , expired_(0)
+    , overflowed_(0)
+{
+}
+
+template<typename Value>
+inline bool CorrelationTable<Value>::is_expired(
+        const Slot& slot,
+        std::chrono::steady_clock::time_point now) const
+{
+    return (0 != expiry_.count()) && (expiry_ < now - slot.timestamp);
+}
+
+template<typename Value>
+inline void CorrelationTable<Value>::insert(
+        uint64_t sequence,
+        const Value& value)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    Slot& slot = slots_[sequence % slots_.size()];
+    if (slot.used)
+    {
+        ++(is_expired(slot, now) ? expired_ : overflowed_);
+    }
+    else
+    {
+        ++size_;
+    }
+    slot = Slot{sequence, value, now, true};
+}
+
+template<typename Value>
+inline bool CorrelationTable<Value>::take(
+        uint64_t sequence,
+        Value& value)
+{
+    bool rv = false;
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    Slot& slot = slots_[sequence % slots_.size()];
+    if (slot.used && (sequence == slot.sequence))
+    {
+        if (is_expired(slot, now))
+        {
+            ++expired_;
+        }
+        else
+        {
+            value = slot.value;
+            rv = true;
+        }
+        slot.used = false;
+        --size_;
+    }
+    return rv;
+}
+
+template<typename Value>
+inline size_t CorrelationTable<Value>::size() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size_;
+}
+
+template<typename Value>
+inline uint64_t CorrelationTable<Value>::expired() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return expired_;
+}
+
+template<typename Value>
+inline uint64_t CorrelationTable<Value>::overflowed() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return overflowed_;
+}
+
+} // namespace utils
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_UTILS_CORRELATIONTABLE_HPP_
@@ -0,0 +1,173 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_UTILS_OVERLOADCONTROL_HPP_
+#define UXR_UTILS_OVERLOADCONTROL_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace uxr {
+namespace utils {
+
+/**
+ * @brief Limits of the overload mode. A limit set to 0 is disabled.
+ */
+struct OverloadLimits
+{
+    /** Clients held by the agent, further CREATE_CLIENT are refused. */
+    size_t max_clients;
+    /** Objects held by each client, further CREATE are refused. */
+    size_t max_entities_per_client;
+    /** Bytes waiting in the output queue, best-effort messages are shed first. */
+    size_t max_queued_bytes;
+    /** Messages per second received from each client, best-effort messages over it are shed. */
+    size_t max_ingress_rate;
+};
+
+/**
+ * @brief Number of times each shed decision was taken.
+ */
+struct OverloadStats
+{
+    /** CREATE_CLIENT refused by max_clients. */
+    uint64_t refused_clients;
+    /** CREATE refused by max_entities_per_client. */
+    uint64_t refused_entities;
+    /** Best-effort input messages shed by max_ingress_rate. */
+    uint64_t shed_ingress;
+    /** Input messages dropped by a full input queue. */
+    uint64_t dropped_input;
+    /** Best-effort output messages shed by max_queued_bytes. */
+    uint64_t shed_best_effort;
+    /** Reliable output messages shed by max_queued_bytes, they are recovered by retransmission. */
+    uint64_t shed_reliable;
+};
+
+enum class ShedDecision : uint8_t
+{
+    REFUSED_CLIENT,
+    REFUSED_ENTITY,
+    SHED_INGRESS,
+    DROPPED_INPUT,
+    SHED_BEST_EFFORT,
+    SHED_RELIABLE,
+    COUNT
+};
+
+/**
+ * @brief Limits and counters shared by the admission of clients and objects and by the queues of
+ *        the server. The limits may be changed at any time, the readers on the data path check the
+ *        generation to pick the new values up.
+ */
+class OverloadControl
+{
+public:
+    OverloadControl()
+        : max_clients_(0)
+        , max_entities_per_client_(0)
+        , max_queued_bytes_(0)
+        , max_ingress_rate_(0)
+        , generation_(0)
+        , counters_()
+    {
+        for (auto& counter : counters_)
+        {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    OverloadControl(OverloadControl&&) = delete;
+    OverloadControl(const OverloadControl&) = delete;
+    OverloadControl& operator=(OverloadControl&&) = delete;
+    OverloadControl& operator=(const OverloadControl&) = delete;
+
+    void set_limits(
+            const OverloadLimits& limits)
+    {
+        max_clients_.store(limits.max_clients, std::memory_order_relaxed);
+        max_entities_per_client_.store(limits.max_entities_per_client, std::memory_order_relaxed);
+        max_queued_bytes_.store(limits.max_queued_bytes, std::memory_order_relaxed);
+        max_ingress_rate_.store(limits.max_ingress_rate, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    OverloadLimits get_limits() const
+    {
+        OverloadLimits limits;
+        limits.max_clients = max_clients();
+        limits.max_entities_per_client = max_entities_per_client();
+        limits.max_queued_bytes = max_queued_bytes();
+        limits.max_ingress_rate = max_ingress_rate();
+        return limits;
+    }
+
+    size_t max_clients() const { return max_clients_.load(std::memory_order_relaxed); }
+
+    size_t max_entities_per_client() const { return max_entities_per_client_.load(std::memory_order_relaxed); }
+
+    size_t max_queued_bytes() const { return max_queued_bytes_.load(std::memory_order_relaxed); }
+
+    size_t max_ingress_rate() const { return max_ingress_rate_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Incremented on each change of the limits.
+     */
+    uint32_t generation() const { return generation_.load(std::memory_order_acquire); }
+
+    void count(
+            ShedDecision decision,
+            uint64_t times = 1)
+    {
+        if (0 != times)
+        {
+            counters_[size_t(decision)].fetch_add(times, std::memory_order_relaxed);
+        }
+    }
+
+    OverloadStats get_stats() const
+    {
+        OverloadStats stats;
+        stats.refused_clients = get(ShedDecision::REFUSED_CLIENT);
+        stats.refused_entities = get(ShedDecision::REFUSED_ENTITY);
+        stats.shed_ingress = get(ShedDecision::SHED_INGRESS);
+        stats.dropped_input = get(ShedDecision::DROPPED_INPUT);
+        stats.shed_best_effort = get(ShedDecision::SHED_BEST_EFFORT);
+        stats.shed_reliable = get(ShedDecision::SHED_RELIABLE);
+        return stats;
+    }
+
+private:
+    uint64_t get(
+            ShedDecision decision) const
+    {
+        return counters_[size_t(decision)].load(std::memory_order_relaxed);
+    }
+
+    std::atomic<size_t> max_clients_;
+    std::atomic<size_t> max_entities_per_client_;
+    std::atomic<size_t> max_queued_bytes_;
+    std::atomic<size_t> max_ingress_rate_;
+    std::atomic<uint32_t> generation_;
+    std::array<std::atomic<uint64_t>, size_t(ShedDecision::COUNT)> counters_;
+};
+
+} // namespace utils
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_UTILS_OVERLOADCONTROL_HPP_
@@ -0,0 +1,190 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_UTILS_RATELIMITER_HPP_
+#define UXR_UTILS_RATELIMITER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace eprosima {
+namespace uxr {
+namespace utils {
+
+/**
+ * @brief Non-blocking token bucket rate limiter, with one bucket per source.
+ *        The number of tracked sources is bounded: when it is reached, idle sources
+ *        (full buckets) are forgotten, and if none is idle new sources are rejected.
+ */
+template<typename Key>
+class RateLimiter
+{
+public:
+    /**
+     * @param rate Allowed requests per second and source. 0 disables the limiter.
+     * @param max_sources Maximum number of tracked sources.
+     */
+    RateLimiter(
+            size_t rate,
+            size_t max_sources);
+
+    RateLimiter(RateLimiter&&) = delete;
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(RateLimiter&&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @brief Consumes a token from the source's bucket.
+     * @return true if the request is allowed, false if it shall be dropped.
+     */
+    bool allow(
+            const Key& source);
+
+    /**
+     * @brief Changes the allowed requests per second and source, 0 disables the limiter.
+     *        The buckets of the tracked sources are discarded.
+     */
+    void set_rate(
+            size_t rate);
+
+private:
+    struct Bucket
+    {
+        uint64_t tokens;
+        std::chrono::steady_clock::time_point timestamp;
+    };
+
+    uint64_t refill(
+            const Bucket& bucket,
+            std::chrono::steady_clock::time_point now) const;
+
+    void purge_idle(
+            std::chrono::steady_clock::time_point now);
+
+    /* Tokens are kept in millionths, so that refills are exact with microsecond granularity. */
+    static constexpr uint64_t token_scale = 1000000;
+
+    std::atomic<uint64_t> rate_;
+    uint64_t capacity_;
+    const size_t max_sources_;
+    std::mutex mtx_;
+    std::map<Key, Bucket> buckets_;
+};
+
+template<typename Key>
+inline RateLimiter<Key>::RateLimiter(
+        size_t rate,
+        size_t max_sources)
+    : rate_(rate)
+    , capacity_(rate * token_scale)
+    , max_sources_(max_sources)
+{
+}
+
+template<typename Key>
+inline uint64_t RateLimiter<Key>::refill(
+        const Bucket& bucket,
+        std::chrono::steady_clock::time_point now) const
+{
+    using namespace std::chrono;
+    const uint64_t rate = rate_.load(std::memory_order_relaxed);
+    if ((0 == rate) || (now <= bucket.timestamp))
+    {
+        return std::min(capacity_, bucket.tokens);
+    }
+
+    /* A source idle for long would overflow rate * elapsed, so the refill is compared by division. */
+    const uint64_t elapsed = uint64_t(duration_cast<microseconds>(now - bucket.timestamp).count());
+    const uint64_t missing = capacity_ - std::min(capacity_, bucket.tokens);
+    return (elapsed > (missing / rate)) ? capacity_ : (bucket.tokens + rate * elapsed);
+}
+
+template<typename Key>
+inline void RateLimiter<Key>::purge_idle(
+        std::chrono::steady_clock::time_point now)
+{
+    for (auto it = buckets_.begin(); it != buckets_.end();)
+    {
+        if (capacity_ == refill(it->second, now))
+        {
+            it = buckets_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+template<typename Key>
+inline bool RateLimiter<Key>::allow(
+        const Key& source)
+{
+    if (0 == rate_.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (0 == rate_.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+    auto it = buckets_.find(source);
+    if (buckets_.end() == it)
+    {
+        if (max_sources_ <= buckets_.size())
+        {
+            purge_idle(now);
+            if (max_sources_ <= buckets_.size())
+            {
+                return false;
+            }
+        }
+        it = buckets_.emplace(source, Bucket{capacity_, now}).first;
+    }
+
+    Bucket& bucket = it->second;
+    const uint64_t tokens = refill(bucket, now);
+    if (tokens < token_scale)
+    {
+        return false;
+    }
+
+    bucket.tokens = tokens - token_scale;
+    bucket.timestamp = now;
+    return true;
+}
+
+template<typename Key>
+inline void RateLimiter<Key>::set_rate(
+        size_t rate)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    rate_.store(rate, std::memory_order_relaxed);
+    capacity_ = rate * token_scale;
+    buckets_.clear();
+}
+
+} // namespace utils
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_UTILS_RATELIMITER_HPP_
@@ -0,0 +1,107 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_AGENT_UTILS_THREADSETTINGS_HPP_
+#define UXR_AGENT_UTILS_THREADSETTINGS_HPP_
+
+#include <uxr/agent/visibility.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace utils {
+
+/**
+ * @brief Classes of threads spawned by the agent, each one configured as a whole.
+ */
+enum class ThreadKind : uint8_t
+{
+    RECEIVER,
+    SENDER,
+    PROCESSING,
+    HEARTBEAT,
+    ERROR_HANDLER,
+    READER,
+    MIDDLEWARE,
+};
+
+enum class SchedulingPolicy : uint8_t
+{
+    DEFAULT,
+    FIFO,
+    RR,
+};
+
+/**
+ * @brief CPU set and scheduling of a class of threads. An empty CPU set leaves the threads free
+ *        to run on any core, and the DEFAULT policy leaves them under the time-sharing scheduler.
+ */
+struct ThreadPolicy
+{
+    std::vector<uint16_t> cpus;
+    SchedulingPolicy scheduling = SchedulingPolicy::DEFAULT;
+    int priority = 0;
+
+    bool is_default() const
+    {
+        return cpus.empty() && (SchedulingPolicy::DEFAULT == scheduling);
+    }
+};
+
+/**
+ * @brief Process-wide registry of the thread policies. Policies must be set before the agent is
+ *        started, since each thread applies its own policy once, when it begins to run.
+ */
+class ThreadSettings
+{
+public:
+    UXR_AGENT_EXPORT static void set_policy(
+            ThreadKind kind,
+            const ThreadPolicy& policy);
+
+    UXR_AGENT_EXPORT static ThreadPolicy get_policy(
+            ThreadKind kind);
+
+    /**
+     * @brief Names the calling thread and applies the policy of its class to it.
+     * @param kind  Class of the calling thread.
+     * @param name  Thread name, truncated to the 15 characters allowed by the kernel.
+     * @return true if every setting was applied.
+     */
+    UXR_AGENT_EXPORT static bool apply(
+            ThreadKind kind,
+            const std::string& name);
+
+    /**
+     * @brief Locks the current and future pages of the process in memory.
+     */
+    UXR_AGENT_EXPORT static bool lock_memory();
+
+    /**
+     * @brief Parses a policy given as <cpus>[:<other|fifo|rr>[:<priority>]], where <cpus> is a
+     *        comma-separated list of cores and ranges, such as 0-3,6, or '*' for any core.
+     */
+    UXR_AGENT_EXPORT static bool parse_policy(
+            const std::string& spec,
+            ThreadPolicy& policy);
+};
+
+} // namespace utils
+} // namespace uxr
+} // namespace eprosima
+
+#endif // UXR_AGENT_UTILS_THREADSETTINGS_HPP_
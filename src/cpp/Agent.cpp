@@ -535,6 +535,28 @@ void Agent::set_verbose_level(uint8_t verbose_level)
     root_->set_verbose_level(verbose_level);
 }
 
+void Agent::set_async_logging(bool enable)
+{
+    root_->set_async_logging(enable);
+}
+
+void Agent::set_overload_limits(const utils::OverloadLimits& limits)
+{
+    root_->get_overload_control().set_limits(limits);
+}
+
+utils::OverloadStats Agent::get_overload_stats() const
+{
+    return root_->get_overload_control().get_stats();
+}
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+bool Agent::enable_snapshot(const std::string& file_path)
+{
+    return root_->enable_snapshot(file_path);
+}
+#endif
+
 /**********************************************************************************************************************
  * Write Data.
  **********************************************************************************************************************/
@@ -553,8 +575,7 @@ bool Agent::write(
         std::shared_ptr<DataWriter> datawriter = std::dynamic_pointer_cast<DataWriter>(client->get_object(object_id));
         if (datawriter)
         {
-            std::vector<uint8_t> data(buf, buf + len);
-            rv = datawriter->write(data);
+            rv = datawriter->write(buf, len);
             op_result = rv ? OpResult::OK : OpResult::WRITE_ERROR;
         }
         else
@@ -570,6 +591,79 @@ bool Agent::write(
     return rv;
 }
 
+bool Agent::get_datawriter_handle(
+        uint32_t client_key,
+        uint16_t datawriter_id,
+        DataWriterHandle& handle,
+        OpResult& op_result)
+{
+    bool rv = false;
+
+    if (std::shared_ptr<ProxyClient> client = root_->get_client(conversion::raw_to_clientkey(client_key)))
+    {
+        dds::xrce::ObjectId object_id = conversion::raw_to_objectid(datawriter_id, dds::xrce::OBJK_DATAWRITER);
+        std::shared_ptr<DataWriter> datawriter = std::dynamic_pointer_cast<DataWriter>(client->get_object(object_id));
+        if (datawriter)
+        {
+            handle.datawriter_ = datawriter;
+            op_result = OpResult::OK;
+            rv = true;
+        }
+        else
+        {
+            op_result = OpResult::UNKNOWN_REFERENCE_ERROR;
+        }
+    }
+    else
+    {
+        op_result = OpResult::UNKNOWN_REFERENCE_ERROR;
+    }
+
+    return rv;
+}
+
+bool Agent::write(
+        const DataWriterHandle& handle,
+        const uint8_t* buf,
+        size_t len,
+        OpResult& op_result)
+{
+    bool rv = false;
+
+    if (std::shared_ptr<DataWriter> datawriter = handle.datawriter_.lock())
+    {
+        rv = datawriter->write(buf, len);
+        op_result = rv ? OpResult::OK : OpResult::WRITE_ERROR;
+    }
+    else
+    {
+        op_result = OpResult::UNKNOWN_REFERENCE_ERROR;
+    }
+
+    return rv;
+}
+
+bool Agent::write(
+        const DataWriterHandle& handle,
+        const Sample* samples,
+        size_t count,
+        OpResult& op_result)
+{
+    bool rv = false;
+
+    if (std::shared_ptr<DataWriter> datawriter = handle.datawriter_.lock())
+    {
+        rv = (count == datawriter->write(samples, count));
+        op_result = rv ? OpResult::OK : OpResult::WRITE_ERROR;
+    }
+    else
+    {
+        op_result = OpResult::UNKNOWN_REFERENCE_ERROR;
+    }
+
+    return rv;
+}
+
 /**********************************************************************************************************************
  * Reset.
  **********************************************************************************************************************/
@@ -72,6 +72,18 @@ bool AgentInstance::create(
             break;
         }
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+        case agent::TransportKind::UNIX_DGRAM:
+        {
+            agent_thread_ = std::move(agent::create_agent_thread<UnixDatagramAgent>(argc, argv, exit_signal, valid_transport));
+            break;
+        }
+        case agent::TransportKind::UNIX_STREAM:
+        {
+            agent_thread_ = std::move(agent::create_agent_thread<UnixStreamAgent>(argc, argv, exit_signal, valid_transport));
+            break;
+        }
+#endif // UAGENT_UNIX_PROFILE
         case agent::TransportKind::SERIAL:
         {
             agent_thread_ = std::move(agent::create_agent_thread<TermiosAgent>(argc, argv, exit_signal, valid_transport));
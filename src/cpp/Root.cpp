@@ -18,6 +18,9 @@
 #include <uxr/agent/logger/Logger.hpp>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#ifdef UAGENT_FAST_PROFILE
+#include <uxr/agent/middleware/fastdds/FastDDSQosCache.hpp>
+#endif // UAGENT_FAST_PROFILE
 
 #include <memory>
 #include <chrono>
@@ -27,10 +30,35 @@ constexpr dds::xrce::XrceVendorId EPROSIMA_VENDOR_ID = {0x01, 0x0F};
 namespace eprosima {
 namespace uxr {
 
+namespace {
+
+std::unordered_map<std::string, std::string> get_client_properties(
+        const dds::xrce::CLIENT_Representation& client_representation)
+{
+    std::unordered_map<std::string, std::string> client_properties;
+
+    if (client_representation.properties())
+    {
+        auto v = *client_representation.properties();
+        for (auto it_props = v.begin(); it_props != v.end(); ++it_props)
+        {
+            client_properties.insert(std::pair<std::string, std::string>(it_props->name(), it_props->value()));
+        }
+    }
+
+    return client_properties;
+}
+
+} // namespace
+
 Root::Root()
     : mtx_(),
       clients_(),
-      current_client_()
+      current_client_(),
+      overload_control_(std::make_shared<utils::OverloadControl>())
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    , snapshot_()
+#endif
 {
     current_client_ = clients_.begin();
 #ifdef UAGENT_LOGGER_PROFILE
@@ -78,23 +106,30 @@ dds::xrce::ResultStatus Root::create_client(
             dds::xrce::ClientKey client_key = client_representation.client_key();
             dds::xrce::SessionId session_id = client_representation.session_id();
             auto it = clients_.find(client_key);
-            if (it == clients_.end())
+            const size_t max_clients = overload_control_->max_clients();
+            if ((it == clients_.end()) && (0 != max_clients) && (max_clients <= clients_.size()))
             {
-                std::unordered_map<std::string, std::string> client_properties;
-
-                if (client_representation.properties())
-                {
-                    auto v = *client_representation.properties();
-                    for (auto it_props = v.begin(); it_props != v.end(); ++it_props)
-                    {
-                        client_properties.insert(std::pair<std::string, std::string>(it_props->name(), it_props->value()));
-                    }
-                }
+                result_status.status(dds::xrce::STATUS_ERR_RESOURCES);
+                overload_control_->count(utils::ShedDecision::REFUSED_CLIENT);
 
+                UXR_AGENT_LOG_INFO(
+                    UXR_DECORATE_RED("too many clients"),
+                    UXR_CLIENT_KEY_PATTERN,
+                    conversion::clientkey_to_raw(client_key));
+            }
+            else if (it == clients_.end())
+            {
                 std::shared_ptr<ProxyClient> new_client = std::make_shared<ProxyClient>(
                     client_representation,
                     middleware_kind,
-                    std::move(client_properties));
+                    get_client_properties(client_representation));
+                new_client->set_overload_control(overload_control_);
+#ifdef UAGENT_SNAPSHOT_PROFILE
+                if (snapshot_)
+                {
+                    new_client->enable_snapshot(snapshot_);
+                }
+#endif
                 if (clients_.emplace(client_key, std::move(new_client)).second)
                 {
                     UXR_AGENT_LOG_INFO(
@@ -121,6 +156,13 @@ dds::xrce::ResultStatus Root::create_client(
                     it->second = std::make_shared<ProxyClient>(
                         client_representation,
                         middleware_kind);
+                    it->second->set_overload_control(overload_control_);
+#ifdef UAGENT_SNAPSHOT_PROFILE
+                    if (snapshot_)
+                    {
+                        it->second->enable_snapshot(snapshot_);
+                    }
+#endif
                 }
                 else
                 {
@@ -185,6 +227,12 @@ dds::xrce::ResultStatus Root::delete_client(const dds::xrce::ClientKey& client_k
         }
         client->release();
         clients_.erase(client_key);
+#ifdef UAGENT_SNAPSHOT_PROFILE
+        if (snapshot_)
+        {
+            snapshot_->remove(client_key);
+        }
+#endif
         result_status.status(dds::xrce::STATUS_OK);
         UXR_AGENT_LOG_INFO(
             UXR_DECORATE_GREEN("delete"),
@@ -235,7 +283,9 @@ bool Root::get_next_client(std::shared_ptr<ProxyClient>& next_client)
 bool Root::load_config_file(const std::string& file_path)
 {
 #ifdef UAGENT_FAST_PROFILE
-    return fastdds::dds::RETCODE_OK == fastdds::dds::DomainParticipantFactory::get_instance()->load_XML_profiles_file(file_path.c_str());
+    bool rv = fastdds::dds::RETCODE_OK == fastdds::dds::DomainParticipantFactory::get_instance()->load_XML_profiles_file(file_path.c_str());
+    FastDDSQosCache::clear();
+    return rv;
 #else
     (void) file_path;
     return false;
@@ -300,9 +350,84 @@ void Root::set_verbose_level(uint8_t verbose_level)
 #endif
 }
 
+void Root::set_async_logging(bool enable)
+{
+#ifdef UAGENT_LOGGER_PROFILE
+    if (enable)
+    {
+        if (AsyncLogger::instance().start())
+        {
+            UXR_AGENT_LOG_INFO(
+                UXR_DECORATE_GREEN("async logging enabled"),
+                "queue_size: {}", ASYNC_LOG_QUEUE_SIZE);
+        }
+    }
+    else
+    {
+        AsyncLogger::instance().stop();
+    }
+#else
+    (void) enable;
+#endif
+}
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+bool Root::enable_snapshot(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (snapshot_)
+    {
+        return false;
+    }
+
+    std::shared_ptr<ClientSnapshot> snapshot = std::make_shared<ClientSnapshot>();
+    if (!snapshot->open(path))
+    {
+        return false;
+    }
+
+    /* Clients already connected take precedence over their snapshot, and are not persisted. */
+    for (auto& entry : snapshot->load())
+    {
+        dds::xrce::ClientKey client_key = entry.representation.client_key();
+        if ((Middleware::Kind::NONE == entry.middleware_kind) || (clients_.end() != clients_.find(client_key)))
+        {
+            continue;
+        }
+
+        std::shared_ptr<ProxyClient> client = std::make_shared<ProxyClient>(
+            entry.representation,
+            entry.middleware_kind,
+            get_client_properties(entry.representation));
+        client->set_overload_control(overload_control_);
+        if (client->restore(snapshot, entry.objects))
+        {
+            clients_.emplace(client_key, std::move(client));
+            UXR_AGENT_LOG_INFO(
+                UXR_DECORATE_GREEN("restore"),
+                "client_key: 0x{:08X}, session_id: 0x{:02X}, objects: {}",
+                conversion::clientkey_to_raw(client_key),
+                entry.representation.session_id(),
+                entry.objects.size());
+        }
+    }
+
+    snapshot_ = std::move(snapshot);
+    current_client_ = clients_.begin();
+
+    return true;
+}
+#endif
+
 void Root::reset()
 {
     std::lock_guard<std::mutex> lock(mtx_);
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    if (snapshot_)
+    {
+        snapshot_->clear();
+    }
+#endif
     for (auto it = clients_.begin(); it != clients_.end(); )
     {
         it->second->release();
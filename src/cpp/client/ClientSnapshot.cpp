@@ -0,0 +1,351 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/client/ClientSnapshot.hpp>
+#include <uxr/agent/utils/Conversion.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/exceptions/Exception.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+
+namespace {
+
+const uint32_t snapshot_magic = 0x53525855; // "UXRS"
+const uint32_t snapshot_version = 1;
+
+/* The file header is padded to the cache line so that slots start aligned. */
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t max_clients;
+    uint32_t slot_size;
+    uint8_t padding[48];
+};
+
+uint32_t checksum(
+        const uint8_t* buf,
+        size_t len)
+{
+    /* FNV-1a. */
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash ^= buf[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+ClientSnapshot::ClientSnapshot()
+    : mtx_{}
+    , fd_{-1}
+    , map_{nullptr}
+    , map_size_{0}
+    , max_clients_{0}
+    , slot_size_{0}
+{}
+
+ClientSnapshot::~ClientSnapshot()
+{
+    close();
+}
+
+bool ClientSnapshot::open(
+        const std::string& path,
+        size_t max_clients,
+        size_t slot_size)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (nullptr != map_ || sizeof(SlotHeader) >= slot_size)
+    {
+        return false;
+    }
+
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (-1 == fd_)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("snapshot open error"),
+            "path: {}, errno: {}",
+            path, errno);
+        return false;
+    }
+
+    map_size_ = sizeof(FileHeader) + max_clients * slot_size;
+    struct stat file_stat;
+    bool fresh = (0 != fstat(fd_, &file_stat)) || (size_t(file_stat.st_size) != map_size_);
+    if (fresh && (0 != ftruncate(fd_, 0) || 0 != ftruncate(fd_, off_t(map_size_))))
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("snapshot resize error"),
+            "path: {}, errno: {}",
+            path, errno);
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    void* map = mmap(nullptr, map_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (MAP_FAILED == map)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("snapshot mmap error"),
+            "path: {}, errno: {}",
+            path, errno);
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    map_ = static_cast<uint8_t*>(map);
+    max_clients_ = max_clients;
+    slot_size_ = slot_size;
+
+    FileHeader* header = reinterpret_cast<FileHeader*>(map_);
+    if (snapshot_magic != header->magic ||
+        snapshot_version != header->version ||
+        max_clients != header->max_clients ||
+        slot_size != header->slot_size)
+    {
+        if (!fresh)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("snapshot layout mismatch"),
+                "path: {}, discarded",
+                path);
+        }
+        std::memset(map_, 0, map_size_);
+        header->magic = snapshot_magic;
+        header->version = snapshot_version;
+        header->max_clients = uint32_t(max_clients);
+        header->slot_size = uint32_t(slot_size);
+        msync(map_, map_size_, MS_ASYNC);
+    }
+
+    return true;
+}
+
+bool ClientSnapshot::close()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    bool rv = false;
+    if (nullptr != map_)
+    {
+        rv = (0 == msync(map_, map_size_, MS_SYNC));
+        rv = (0 == munmap(map_, map_size_)) && rv;
+        rv = (0 == ::close(fd_)) && rv;
+        map_ = nullptr;
+        fd_ = -1;
+        max_clients_ = 0;
+    }
+    return rv;
+}
+
+std::vector<ClientSnapshot::Entry> ClientSnapshot::load()
+{
+    std::vector<Entry> entries;
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (size_t i = 0; i < max_clients_; ++i)
+    {
+        uint8_t* buf = slot(i);
+        SlotHeader slot_header;
+        std::memcpy(&slot_header, buf, sizeof(slot_header));
+        uint8_t* data = buf + sizeof(SlotHeader);
+
+        if (0 == slot_header.length)
+        {
+            continue;
+        }
+        if ((slot_size_ - sizeof(SlotHeader)) < slot_header.length ||
+            checksum(data, slot_header.length) != slot_header.checksum)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("snapshot corrupted entry"),
+                UXR_CLIENT_KEY_PATTERN,
+                slot_header.client_key);
+            continue;
+        }
+
+        fastcdr::FastBuffer fastbuffer{reinterpret_cast<char*>(data), slot_header.length};
+        fastcdr::Cdr deserializer{fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1};
+        try
+        {
+            Entry entry;
+            uint8_t middleware_kind;
+            uint16_t count;
+            entry.representation.deserialize(deserializer);
+            deserializer >> middleware_kind;
+            deserializer >> count;
+            entry.middleware_kind = Middleware::Kind(middleware_kind);
+            entry.objects.resize(count);
+            for (auto& object : entry.objects)
+            {
+                uint8_t endianness;
+                deserializer >> object.first;
+                deserializer >> endianness;
+                object.second.deserialize(deserializer);
+                object.second.endianness(dds::xrce::Endianness(endianness));
+            }
+            entries.push_back(std::move(entry));
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("snapshot invalid entry"),
+                UXR_CLIENT_KEY_PATTERN,
+                slot_header.client_key);
+        }
+    }
+    return entries;
+}
+
+bool ClientSnapshot::store(
+        const Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    uint32_t client_key = conversion::clientkey_to_raw(entry.representation.client_key());
+    size_t index;
+    if (!find_slot(client_key, index, true))
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("snapshot full"),
+            UXR_CLIENT_KEY_PATTERN,
+            client_key);
+        return false;
+    }
+
+    /* Invalidate the slot before rewriting it. */
+    uint8_t* buf = slot(index);
+    SlotHeader slot_header{client_key, 0, 0};
+    std::memcpy(buf, &slot_header, sizeof(slot_header));
+
+    uint8_t* data = buf + sizeof(SlotHeader);
+    fastcdr::FastBuffer fastbuffer{reinterpret_cast<char*>(data), slot_size_ - sizeof(SlotHeader)};
+    fastcdr::Cdr serializer{fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1};
+    bool rv = false;
+    try
+    {
+        entry.representation.serialize(serializer);
+        serializer << uint8_t(entry.middleware_kind);
+        serializer << uint16_t(entry.objects.size());
+        for (const auto& object : entry.objects)
+        {
+            /* The endianness of binary representations is not part of the variant itself. */
+            serializer << object.first;
+            serializer << uint8_t(object.second.endianness());
+            object.second.serialize(serializer);
+        }
+
+        slot_header.length = uint32_t(serializer.get_serialized_data_length());
+        slot_header.checksum = checksum(data, slot_header.length);
+        std::memcpy(buf, &slot_header, sizeof(slot_header));
+        rv = true;
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("snapshot entry too large"),
+            "client_key: 0x{:08X}, objects: {}",
+            client_key, entry.objects.size());
+    }
+
+    sync(index);
+    return rv;
+}
+
+bool ClientSnapshot::remove(
+        const dds::xrce::ClientKey& client_key)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    size_t index;
+    bool rv = find_slot(conversion::clientkey_to_raw(client_key), index, false);
+    if (rv)
+    {
+        std::memset(slot(index), 0, sizeof(SlotHeader));
+        sync(index);
+    }
+    return rv;
+}
+
+bool ClientSnapshot::clear()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (size_t i = 0; i < max_clients_; ++i)
+    {
+        std::memset(slot(i), 0, sizeof(SlotHeader));
+    }
+    return (nullptr != map_) && (0 == msync(map_, map_size_, MS_ASYNC));
+}
+
+uint8_t* ClientSnapshot::slot(
+        size_t index) const
+{
+    return map_ + sizeof(FileHeader) + (index * slot_size_);
+}
+
+bool ClientSnapshot::find_slot(
+        uint32_t client_key,
+        size_t& index,
+        bool allocate)
+{
+    bool rv = false;
+    size_t free_index = max_clients_;
+    for (size_t i = 0; i < max_clients_ && !rv; ++i)
+    {
+        SlotHeader slot_header;
+        std::memcpy(&slot_header, slot(i), sizeof(slot_header));
+        if (0 == slot_header.length)
+        {
+            free_index = (max_clients_ == free_index) ? i : free_index;
+        }
+        else if (client_key == slot_header.client_key)
+        {
+            index = i;
+            rv = true;
+        }
+    }
+
+    if (!rv && allocate && (max_clients_ != free_index))
+    {
+        index = free_index;
+        rv = true;
+    }
+    return rv;
+}
+
+void ClientSnapshot::sync(
+        size_t index)
+{
+    /* msync requires a page-aligned address. */
+    static const uintptr_t page_size = uintptr_t(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = reinterpret_cast<uintptr_t>(slot(index)) & ~(page_size - 1);
+    uintptr_t end = reinterpret_cast<uintptr_t>(slot(index)) + slot_size_;
+    msync(reinterpret_cast<void*>(begin), end - begin, MS_ASYNC);
+}
+
+} // namespace uxr
+} // namespace eprosima
@@ -45,6 +45,14 @@ ProxyClient::ProxyClient(
     , properties_(std::move(properties))
     , client_dead_time_(CLIENT_DEAD_TIME)
     , hard_liveliness_check_(false)
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    , middleware_kind_(middleware_kind)
+    , snapshot_{}
+    , representations_{}
+    , restored_{}
+    , restored_session_{false}
+    , snapshot_dirty_{false}
+#endif
 {
     switch (middleware_kind)
     {
@@ -103,8 +111,32 @@ dds::xrce::ResultStatus ProxyClient::create_object(
     auto it = objects_.find(object_id);
     bool exists = (it != objects_.end());
 
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    /* Objects restored from a snapshot are adopted by the first matching request. */
+    if (exists && (0 < restored_.erase(object_id)) && it->second->matched(object_representation))
+    {
+        UXR_AGENT_LOG_DEBUG(
+            UXR_DECORATE_GREEN("object restored"),
+            UXR_CREATE_OBJECT_PATTERN,
+            conversion::clientkey_to_raw(representation_.client_key()),
+            conversion::objectid_to_raw(object_id));
+        return result;
+    }
+#endif
+
     /* Create object according with creation mode (see Table 7 XRCE). */
-    if (!exists)
+    const size_t max_entities = overload_control_ ? overload_control_->max_entities_per_client() : 0;
+    if (!exists && (0 != max_entities) && (max_entities <= objects_.size()))
+    {
+        result.status(dds::xrce::STATUS_ERR_RESOURCES);
+        overload_control_->count(utils::ShedDecision::REFUSED_ENTITY);
+        UXR_AGENT_LOG_DEBUG(
+            UXR_DECORATE_RED("too many objects"),
+            UXR_CREATE_OBJECT_PATTERN,
+            conversion::clientkey_to_raw(representation_.client_key()),
+            conversion::objectid_to_raw(object_id));
+    }
+    else if (!exists)
     {
         create_object(object_id, object_representation, result);
     }
@@ -170,6 +202,10 @@ dds::xrce::ResultStatus ProxyClient::create_object(
         }
     }
 
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    save_snapshot();
+#endif
+
     return result;
 }
 
@@ -184,6 +220,9 @@ dds::xrce::ResultStatus ProxyClient::delete_object(const dds::xrce::ObjectId& ob
     {
         result.status(dds::xrce::STATUS_ERR_UNKNOWN_REFERENCE);
     }
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    save_snapshot();
+#endif
     return result;
 }
 
@@ -267,6 +306,15 @@ bool ProxyClient::create_object(
         default:
             break;
     }
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    if (rv && snapshot_)
+    {
+        representations_[object_id] = representation;
+        snapshot_dirty_ = true;
+    }
+#endif
+
     return rv;
 }
 
@@ -725,6 +773,10 @@ bool ProxyClient::delete_object_unlock(
     if (it != objects_.end())
     {
         objects_.erase(object_id);
+#ifdef UAGENT_SNAPSHOT_PROFILE
+        restored_.erase(object_id);
+        snapshot_dirty_ = (0 < representations_.erase(object_id)) || snapshot_dirty_;
+#endif
         UXR_AGENT_LOG_DEBUG(
             UXR_DECORATE_GREEN("object deleted"),
             UXR_CREATE_OBJECT_PATTERN,
@@ -756,6 +808,69 @@ ProxyClient::State ProxyClient::get_state()
     return state_;
 }
 
+#ifdef UAGENT_SNAPSHOT_PROFILE
+void ProxyClient::enable_snapshot(
+        std::shared_ptr<ClientSnapshot> snapshot)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    snapshot_ = std::move(snapshot);
+    snapshot_dirty_ = true;
+    save_snapshot();
+}
+
+bool ProxyClient::restore(
+        std::shared_ptr<ClientSnapshot> snapshot,
+        const std::vector<std::pair<dds::xrce::ObjectId, dds::xrce::ObjectVariant>>& objects)
+{
+    if (!middleware_)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    snapshot_ = std::move(snapshot);
+
+    std::map<dds::xrce::ObjectId, const dds::xrce::ObjectVariant*, CreationOrder> ordered;
+    for (const auto& object : objects)
+    {
+        ordered.emplace(object.first, &object.second);
+    }
+
+    dds::xrce::ResultStatus result_status;
+    for (const auto& object : ordered)
+    {
+        if (create_object(object.first, *object.second, result_status))
+        {
+            restored_.insert(object.first);
+        }
+    }
+
+    /* The snapshot entry is left untouched until the tree changes. */
+    snapshot_dirty_ = false;
+    restored_session_ = true;
+    return true;
+}
+
+void ProxyClient::save_snapshot()
+{
+    if (!snapshot_ || !snapshot_dirty_)
+    {
+        return;
+    }
+
+    ClientSnapshot::Entry entry;
+    entry.representation = representation_;
+    entry.middleware_kind = middleware_kind_;
+    entry.objects.reserve(representations_.size());
+    for (const auto& object : representations_)
+    {
+        entry.objects.emplace_back(object.first, object.second);
+    }
+    snapshot_->store(entry);
+    snapshot_dirty_ = false;
+}
+#endif
+
 void ProxyClient::update_state(const ProxyClient::State state)
 {
     std::lock_guard<std::mutex> lock(state_mtx_);
@@ -149,5 +149,38 @@ bool DataWriter::write(const std::vector<uint8_t>& data)
     return rv;
 }
 
+bool DataWriter::write(
+        const uint8_t* buf,
+        size_t len)
+{
+    bool rv = false;
+    if (proxy_client_->get_middleware().write_data(get_raw_id(), buf, len))
+    {
+        UXR_AGENT_LOG_MESSAGE(
+            UXR_DECORATE_YELLOW("[** <<DDS>> **]"),
+            get_raw_id(),
+            buf,
+            len);
+        rv = true;
+    }
+    return rv;
+}
+
+size_t DataWriter::write(
+        const Middleware::Sample* samples,
+        size_t count)
+{
+    size_t written = proxy_client_->get_middleware().write_batch(get_raw_id(), samples, count);
+    for (size_t i = 0; i < written; ++i)
+    {
+        UXR_AGENT_LOG_MESSAGE(
+            UXR_DECORATE_YELLOW("[** <<DDS>> **]"),
+            get_raw_id(),
+            samples[i].buf,
+            samples[i].len);
+    }
+    return written;
+}
+
 } // namespace uxr
 } // namespace eprosima
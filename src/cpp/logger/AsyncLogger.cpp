@@ -0,0 +1,176 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/logger/AsyncLogger.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+
+static_assert((ASYNC_LOG_QUEUE_SIZE & (ASYNC_LOG_QUEUE_SIZE - 1)) == 0,
+        "ASYNC_LOG_QUEUE_SIZE shall be a power of two.");
+
+constexpr size_t AsyncLogger::status_size;
+constexpr size_t AsyncLogger::data_size;
+
+std::atomic<bool> AsyncLogger::enabled_{false};
+
+AsyncLogger& AsyncLogger::instance()
+{
+    static AsyncLogger logger;
+    return logger;
+}
+
+AsyncLogger::AsyncLogger()
+    : queue_(ASYNC_LOG_QUEUE_SIZE)
+    , dropped_{0}
+    , reported_dropped_{0}
+    , mtx_{}
+    , thread_{}
+    , running_cond_{false}
+{}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+bool AsyncLogger::start()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (running_cond_)
+    {
+        return false;
+    }
+
+    running_cond_ = true;
+    thread_ = std::thread(&AsyncLogger::loop, this);
+    enabled_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void AsyncLogger::stop()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    enabled_.store(false, std::memory_order_relaxed);
+    running_cond_ = false;
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+bool AsyncLogger::log_message(
+        const spdlog::source_loc& loc,
+        const char* status,
+        uint32_t client_key,
+        int fd,
+        const uint8_t* buf,
+        size_t len,
+        bool with_data)
+{
+    bool rv = queue_.try_push([&](Record& record)
+    {
+        record.timestamp = spdlog::log_clock::now();
+        record.loc = loc;
+        size_t status_len = (std::min)(std::strlen(status), status_size - 1);
+        std::memcpy(record.status.data(), status, status_len);
+        record.status[status_len] = '\0';
+        record.client_key = client_key;
+        record.fd = fd;
+        record.len = len;
+        record.with_data = with_data;
+        record.data_len = with_data ? (std::min)(len, data_size) : 0;
+        std::memcpy(record.data.data(), buf, record.data_len);
+    });
+
+    if (!rv)
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return rv;
+}
+
+void AsyncLogger::loop()
+{
+    while (running_cond_)
+    {
+        if (0 == flush())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    flush();
+}
+
+size_t AsyncLogger::flush()
+{
+    size_t count = 0;
+    while (queue_.try_pop([this](Record& record){ write(record); }))
+    {
+        ++count;
+    }
+
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != reported_dropped_)
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("async log overflow"),
+            "dropped: {}",
+            dropped - reported_dropped_);
+        reported_dropped_ = dropped;
+    }
+
+    return count;
+}
+
+void AsyncLogger::write(
+        const Record& record)
+{
+    const char* status = record.status.data();
+    const uint8_t* data = record.data.data();
+    spdlog::memory_buf_t buf;
+    if (!record.with_data)
+    {
+        fmt::format_to(std::back_inserter(buf), UXR_STATUS_FORMAT UXR_MESSAGE_PATTERN,
+            status, record.client_key, record.len);
+    }
+    else if (-1 == record.fd)
+    {
+        fmt::format_to(std::back_inserter(buf), UXR_STATUS_FORMAT UXR_MESSAGE_WITH_DATA_PATTERN,
+            status, record.client_key, record.len, spdlog::to_hex(data, data + record.data_len));
+    }
+    else
+    {
+        fmt::format_to(std::back_inserter(buf), UXR_STATUS_FORMAT UXR_MESSAGE_WITH_FD_PATTERN,
+            status, record.client_key, record.fd, record.len, spdlog::to_hex(data, data + record.data_len));
+    }
+    if (record.data_len < record.len && record.with_data)
+    {
+        fmt::format_to(std::back_inserter(buf), " (truncated)");
+    }
+
+    spdlog::default_logger_raw()->log(
+        record.timestamp,
+        record.loc,
+        spdlog::level::debug,
+        spdlog::string_view_t(buf.data(), buf.size()));
+}
+
+} // namespace uxr
+} // namespace eprosima
@@ -13,7 +13,12 @@
 // limitations under the License.
 
 #include <uxr/agent/middleware/ced/CedEntities.hpp>
+#include <uxr/agent/config.hpp>
 
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+
+#include <algorithm>
 #include <chrono>
 #include <memory>
 
@@ -25,7 +30,9 @@ namespace uxr {
  **********************************************************************************************************************/
 std::unordered_map<uint32_t, OnNewDomain> CedTopicManager::on_new_domain_map_;
 std::unordered_map<uint32_t, OnNewTopic> CedTopicManager::on_new_topic_map_;
+std::unordered_map<uint32_t, OnTopicInterest> CedTopicManager::on_topic_interest_map_;
 std::unordered_map<int16_t, std::unordered_map<std::string, std::weak_ptr<CedGlobalTopic>>> CedTopicManager::topics_;
+std::unordered_map<int16_t, std::unordered_map<std::string, std::weak_ptr<CedGlobalService>>> CedTopicManager::services_;
 std::mutex CedTopicManager::mtx_;
 
 void CedTopicManager::register_on_new_domain_cb(
@@ -67,6 +74,31 @@ void CedTopicManager::unregister_on_new_topic_cb(uint32_t key)
     on_new_topic_map_.erase(key);
 }
 
+void CedTopicManager::register_on_topic_interest_cb(
+        uint32_t key,
+        const OnTopicInterest& on_topic_interest_cb)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (auto& topic : topics_)
+    {
+        for (auto& t : topic.second)
+        {
+            std::shared_ptr<CedGlobalTopic> global_topic = t.second.lock();
+            if (global_topic && (0 != global_topic->local_readers_))
+            {
+                on_topic_interest_cb(topic.first, t.first, true);
+            }
+        }
+    }
+    on_topic_interest_map_.emplace(key, on_topic_interest_cb);
+}
+
+void CedTopicManager::unregister_on_topic_interest_cb(uint32_t key)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    on_topic_interest_map_.erase(key);
+}
+
 bool CedTopicManager::register_topic(
         const std::string& topic_name,
         int16_t domain_id,
@@ -133,6 +165,72 @@ bool CedTopicManager::unregister_topic(
     return rv;
 }
 
+bool CedTopicManager::register_service(
+        const std::string& service_name,
+        int16_t domain_id,
+        const std::string& request_type,
+        const std::string& reply_type,
+        std::shared_ptr<CedGlobalService>& service)
+{
+    bool rv = false;
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& domain_services = services_[domain_id];
+    auto it_service = domain_services.find(service_name);
+    if (domain_services.end() != it_service)
+    {
+        service = it_service->second.lock();
+    }
+
+    if (!service)
+    {
+        service = std::make_shared<CedGlobalService>(service_name, domain_id, request_type, reply_type);
+        domain_services[service_name] = service;
+        rv = true;
+    }
+    else if ((request_type.empty() || service->request_type_.empty() || (request_type == service->request_type_)) &&
+             (reply_type.empty() || service->reply_type_.empty() || (reply_type == service->reply_type_)))
+    {
+        /* The first endpoint giving the types sets them for the others. */
+        if (service->request_type_.empty())
+        {
+            service->request_type_ = request_type;
+        }
+        if (service->reply_type_.empty())
+        {
+            service->reply_type_ = reply_type;
+        }
+        rv = true;
+    }
+    else
+    {
+        service.reset();
+    }
+    return rv;
+}
+
+bool CedTopicManager::unregister_service(
+        const std::string& service_name,
+        int16_t domain_id)
+{
+    bool rv = false;
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it_domain = services_.find(domain_id);
+    if (services_.end() != it_domain)
+    {
+        auto it_service = it_domain->second.find(service_name);
+        if ((it_domain->second.end() != it_service) && it_service->second.expired())
+        {
+            it_domain->second.erase(it_service);
+            if (it_domain->second.empty())
+            {
+                services_.erase(it_domain);
+            }
+            rv = true;
+        }
+    }
+    return rv;
+}
+
 /**********************************************************************************************************************
  * CedTopicCloud
  **********************************************************************************************************************/
@@ -141,6 +239,7 @@ CedGlobalTopic::CedGlobalTopic(
         int16_t domain_id)
     : name_(topic_name)
     , domain_id_(domain_id)
+    , local_readers_(0)
     , last_write_(UINT16_MAX)
 {
 }
@@ -156,7 +255,8 @@ const std::string& CedGlobalTopic::name() const
 }
 
 bool CedGlobalTopic::write(
-        const std::vector<uint8_t>& data,
+        const uint8_t* buf,
+        size_t len,
         WriteAccess write_access,
         TopicSource topic_src,
         uint8_t& errcode)
@@ -166,7 +266,8 @@ bool CedGlobalTopic::write(
     {
         std::unique_lock<std::mutex> lock(mtx_);
         size_t index = uint16_t(last_write_ + 1) % history_.size();
-        history_[index] = data;
+        /* assign reuses the capacity of the slot, so a steady stream of samples does not allocate. */
+        history_[index].assign(buf, buf + len);
         srcs_[index] = topic_src;
         ++last_write_;
         lock.unlock();
@@ -177,6 +278,32 @@ bool CedGlobalTopic::write(
     return rv;
 }
 
+size_t CedGlobalTopic::write(
+        const Middleware::Sample* samples,
+        size_t count,
+        WriteAccess write_access,
+        TopicSource topic_src,
+        uint8_t& errcode)
+{
+    size_t written = 0;
+    if (check_write_access(write_access, topic_src))
+    {
+        const size_t bounded_count = std::min(count, history_.size());
+        std::unique_lock<std::mutex> lock(mtx_);
+        for (; written < bounded_count; ++written)
+        {
+            size_t index = uint16_t(last_write_ + 1) % history_.size();
+            history_[index].assign(samples[written].buf, samples[written].buf + samples[written].len);
+            srcs_[index] = topic_src;
+            ++last_write_;
+        }
+        lock.unlock();
+        cv_.notify_all();
+        errcode = 0;
+    }
+    return written;
+}
+
 bool CedGlobalTopic::read(
         std::vector<uint8_t>& data,
         std::chrono::milliseconds timeout,
@@ -252,6 +379,157 @@ bool CedGlobalTopic::get_data(
     return rv;
 }
 
+void CedGlobalTopic::add_reader(
+        ReadAccess read_access)
+{
+    if (ReadAccess::COMPLETE == read_access)
+    {
+        std::lock_guard<std::mutex> lock(CedTopicManager::mtx_);
+        if (0 == local_readers_++)
+        {
+            for (auto& cb_interest : CedTopicManager::on_topic_interest_map_)
+            {
+                cb_interest.second(domain_id_, name_, true);
+            }
+        }
+    }
+}
+
+void CedGlobalTopic::remove_reader(
+        ReadAccess read_access)
+{
+    if (ReadAccess::COMPLETE == read_access)
+    {
+        std::lock_guard<std::mutex> lock(CedTopicManager::mtx_);
+        if (0 == --local_readers_)
+        {
+            for (auto& cb_interest : CedTopicManager::on_topic_interest_map_)
+            {
+                cb_interest.second(domain_id_, name_, false);
+            }
+        }
+    }
+}
+
+/**********************************************************************************************************************
+ * CedGlobalService
+ **********************************************************************************************************************/
+CedGlobalService::CedGlobalService(
+        const std::string& service_name,
+        int16_t domain_id,
+        const std::string& request_type,
+        const std::string& reply_type)
+    : name_(service_name)
+    , domain_id_(domain_id)
+    , request_type_(request_type)
+    , reply_type_(reply_type)
+    , last_requester_(0)
+    , mtx_()
+    , requests_()
+    , replies_()
+{
+    requests_.last_write = UINT16_MAX;
+    replies_.last_write = UINT16_MAX;
+}
+
+CedGlobalService::~CedGlobalService()
+{
+    CedTopicManager::unregister_service(name_, domain_id_);
+}
+
+const std::string& CedGlobalService::name() const
+{
+    return name_;
+}
+
+bool CedGlobalService::match(
+        const std::string& request_type,
+        const std::string& reply_type) const
+{
+    std::lock_guard<std::mutex> lock(CedTopicManager::mtx_);
+    return (request_type.empty() || (request_type == request_type_)) &&
+           (reply_type.empty() || (reply_type == reply_type_));
+}
+
+uint32_t CedGlobalService::add_requester()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return ++last_requester_;
+}
+
+void CedGlobalService::write(
+        History& history,
+        const uint8_t* buf,
+        size_t len,
+        uint32_t requester,
+        uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+    Sample& sample = history.samples[uint16_t(history.last_write + 1) % history.samples.size()];
+    sample.data.assign(buf, buf + len);
+    sample.requester = requester;
+    sample.sequence = sequence;
+    ++history.last_write;
+    lock.unlock();
+    history.cv.notify_all();
+}
+
+bool CedGlobalService::read(
+        History& history,
+        uint32_t requester,
+        Sample& sample,
+        SeqNum& last_read,
+        std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+    auto read_next = [&]() -> bool
+    {
+        bool found = false;
+        if (last_read != history.last_write)
+        {
+            /* Fix last_read, in case the writer has lapped it. */
+            if ((last_read <= (history.last_write - int(history.samples.size()))) || (last_read > history.last_write))
+            {
+                last_read = history.last_write - int(history.samples.size());
+            }
+
+            /* Skip every sample addressed to other requesters. */
+            while (!found && (last_read != history.last_write))
+            {
+                found = get_sample(history, requester, sample, last_read);
+            }
+        }
+        return found;
+    };
+
+    bool rv = read_next();
+    if (!rv)
+    {
+        /* Try to read a sample with timeout in case. */
+        auto now = std::chrono::steady_clock::now();
+        rv = history.cv.wait_until(lock, now + timeout, read_next);
+    }
+
+    return rv;
+}
+
+bool CedGlobalService::get_sample(
+        History& history,
+        uint32_t requester,
+        Sample& sample,
+        SeqNum& last_read)
+{
+    bool rv = false;
+    const Sample& stored = history.samples[uint16_t(++last_read) % history.samples.size()];
+    if ((0 == requester) || (requester == stored.requester))
+    {
+        sample.data.assign(stored.data.begin(), stored.data.end());
+        sample.requester = stored.requester;
+        sample.sequence = stored.sequence;
+        rv = true;
+    }
+    return rv;
+}
 
 /**********************************************************************************************************************
  * CedParticipant
@@ -297,10 +575,19 @@ CedGlobalTopic* CedTopic::get_global_topic() const
  * CedDataWriter
  **********************************************************************************************************************/
 bool CedDataWriter::write(
-        const std::vector<uint8_t>& data,
+        const uint8_t* buf,
+        size_t len,
         uint8_t& errcode) const
 {
-    return topic_->get_global_topic()->write(data, write_access_, topic_src_, errcode);
+    return topic_->get_global_topic()->write(buf, len, write_access_, topic_src_, errcode);
+}
+
+size_t CedDataWriter::write(
+        const Middleware::Sample* samples,
+        size_t count,
+        uint8_t& errcode) const
+{
+    return topic_->get_global_topic()->write(samples, count, write_access_, topic_src_, errcode);
 }
 
 /**********************************************************************************************************************
@@ -314,5 +601,162 @@ bool CedDataReader::read(
     return topic_->get_global_topic()->read(data, timeout, last_read_, read_access_, errcode);
 }
 
+/**********************************************************************************************************************
+ * CedRequester
+ **********************************************************************************************************************/
+CedRequester::CedRequester(
+        const std::shared_ptr<CedParticipant>& participant,
+        const std::shared_ptr<CedGlobalService>& service)
+    : participant_(participant)
+    , service_(service)
+    , requester_(service->add_requester())
+    , last_sequence_(0)
+    , last_read_(UINT16_MAX)
+    , sample_{}
+    , pending_requests_{REQUESTER_TABLE_SIZE, REQUESTER_TABLE_TIMEOUT}
+{
+}
+
+bool CedRequester::write(
+        uint32_t sequence_number,
+        const std::vector<uint8_t>& data)
+{
+    pending_requests_.insert(++last_sequence_, sequence_number);
+    service_->write(service_->requests_, data.data(), data.size(), requester_, last_sequence_);
+    return true;
+}
+
+bool CedRequester::read(
+        uint32_t& sequence_number,
+        std::vector<uint8_t>& data,
+        std::chrono::milliseconds timeout)
+{
+    bool rv = false;
+    if (service_->read(service_->replies_, requester_, sample_, last_read_, timeout))
+    {
+        rv = pending_requests_.take(sample_.sequence, sequence_number);
+        if (rv)
+        {
+            data.swap(sample_.data);
+        }
+    }
+    return rv;
+}
+
+bool CedRequester::match(
+        const std::string& service_name,
+        const std::string& request_type,
+        const std::string& reply_type) const
+{
+    return (service_name == service_->name()) && service_->match(request_type, reply_type);
+}
+
+/* The GUID prefix starts by the eProsima vendor id and ends by the requester. */
+static const std::array<uint8_t, 4> ced_guid_prefix = {0x01, 0x0F, 0xCE, 0xD0};
+
+void CedRequester::get_sample_identity(
+        uint32_t requester,
+        uint64_t sequence,
+        dds::SampleIdentity& sample_identity)
+{
+    dds::GUID_t& guid = sample_identity.writer_guid();
+    guid.guidPrefix().fill(0);
+    std::copy(ced_guid_prefix.begin(), ced_guid_prefix.end(), guid.guidPrefix().begin());
+    guid.guidPrefix()[8] = uint8_t(requester >> 24);
+    guid.guidPrefix()[9] = uint8_t(requester >> 16);
+    guid.guidPrefix()[10] = uint8_t(requester >> 8);
+    guid.guidPrefix()[11] = uint8_t(requester);
+    guid.entityId().entityKey().fill(0);
+    guid.entityId().entityKind() = 0x03;
+
+    sample_identity.sequence_number().high() = int32_t(sequence >> 32);
+    sample_identity.sequence_number().low() = uint32_t(sequence);
+}
+
+bool CedRequester::from_sample_identity(
+        const dds::SampleIdentity& sample_identity,
+        uint32_t& requester,
+        uint64_t& sequence)
+{
+    bool rv = false;
+    const dds::GuidPrefix_t& prefix = sample_identity.writer_guid().guidPrefix();
+    if (std::equal(ced_guid_prefix.begin(), ced_guid_prefix.end(), prefix.begin()))
+    {
+        requester = (uint32_t(prefix[8]) << 24) + (uint32_t(prefix[9]) << 16) +
+                    (uint32_t(prefix[10]) << 8) + uint32_t(prefix[11]);
+        sequence = (uint64_t(uint32_t(sample_identity.sequence_number().high())) << 32) +
+                   sample_identity.sequence_number().low();
+        rv = true;
+    }
+    return rv;
+}
+
+/**********************************************************************************************************************
+ * CedReplier
+ **********************************************************************************************************************/
+bool CedReplier::write(
+        const std::vector<uint8_t>& data)
+{
+    bool rv = false;
+    fastcdr::FastBuffer fastbuffer{reinterpret_cast<char*>(const_cast<uint8_t*>(data.data())), data.size()};
+    fastcdr::Cdr deserializer(fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1);
+
+    try
+    {
+        dds::SampleIdentity sample_identity;
+        sample_identity.deserialize(deserializer);
+
+        uint32_t requester;
+        uint64_t sequence;
+        if (CedRequester::from_sample_identity(sample_identity, requester, sequence))
+        {
+            size_t offset = deserializer.get_serialized_data_length();
+            service_->write(service_->replies_, data.data() + offset, data.size() - offset, requester, sequence);
+            rv = true;
+        }
+    }
+    catch(const std::exception&)
+    {
+        rv = false;
+    }
+    return rv;
+}
+
+bool CedReplier::read(
+        std::vector<uint8_t>& data,
+        std::chrono::milliseconds timeout)
+{
+    bool rv = false;
+    if (service_->read(service_->requests_, 0, sample_, last_read_, timeout))
+    {
+        dds::SampleIdentity sample_identity;
+        CedRequester::get_sample_identity(sample_.requester, sample_.sequence, sample_identity);
+
+        data.resize(sample_identity.getCdrSerializedSize() + sample_.data.size());
+        fastcdr::FastBuffer fastbuffer{reinterpret_cast<char*>(data.data()), data.size()};
+        fastcdr::Cdr serializer(fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1);
+
+        try
+        {
+            sample_identity.serialize(serializer);
+            serializer.serialize_array(sample_.data.data(), sample_.data.size());
+            rv = true;
+        }
+        catch(const std::exception&)
+        {
+            rv = false;
+        }
+    }
+    return rv;
+}
+
+bool CedReplier::match(
+        const std::string& service_name,
+        const std::string& request_type,
+        const std::string& reply_type) const
+{
+    return (service_name == service_->name()) && service_->match(request_type, reply_type);
+}
+
 } // namespace uxr
 } // namespace eprosima
@@ -25,6 +25,8 @@ CedMiddleware::CedMiddleware(uint32_t client_key)
     , subscribers_{}
     , datawriters_{}
     , datareaders_{}
+    , requesters_{}
+    , repliers_{}
     , topics_src_{}
     , write_access_{}
     , read_access_{}
@@ -313,6 +315,119 @@ bool CedMiddleware::create_datareader_by_bin(
     return rv;
 }
 
+static
+std::shared_ptr<CedGlobalService> create_service(
+        const std::shared_ptr<CedParticipant>& participant,
+        const std::string& service_name,
+        const std::string& request_type,
+        const std::string& reply_type)
+{
+    std::shared_ptr<CedGlobalService> service;
+    CedTopicManager::register_service(
+        service_name, participant->get_domain_id(), request_type, reply_type, service);
+    return service;
+}
+
+bool CedMiddleware::create_requester_by_ref(
+        uint16_t requester_id,
+        uint16_t participant_id,
+        const std::string& ref)
+{
+    bool rv = false;
+    auto it_participant = participants_.find(participant_id);
+    if ((participants_.end() != it_participant) && (requesters_.end() == requesters_.find(requester_id)))
+    {
+        std::shared_ptr<CedGlobalService> service =
+            create_service(it_participant->second, ref, std::string(), std::string());
+        rv = service
+            && requesters_.emplace(
+                requester_id,
+                std::make_shared<CedRequester>(it_participant->second, service)).second;
+    }
+    return rv;
+}
+
+bool CedMiddleware::create_requester_by_xml(
+        uint16_t requester_id,
+        uint16_t participant_id,
+        const std::string& xml)
+{
+    return create_requester_by_ref(requester_id, participant_id, xml);
+}
+
+bool CedMiddleware::create_requester_by_bin(
+        uint16_t requester_id,
+        uint16_t participant_id,
+        const dds::xrce::OBJK_Requester_Binary& requester_xrce)
+{
+    bool rv = false;
+    auto it_participant = participants_.find(participant_id);
+    if ((participants_.end() != it_participant) && (requesters_.end() == requesters_.find(requester_id)))
+    {
+        std::shared_ptr<CedGlobalService> service =
+            create_service(
+                it_participant->second,
+                requester_xrce.service_name(),
+                requester_xrce.request_type(),
+                requester_xrce.reply_type());
+        rv = service
+            && requesters_.emplace(
+                requester_id,
+                std::make_shared<CedRequester>(it_participant->second, service)).second;
+    }
+    return rv;
+}
+
+bool CedMiddleware::create_replier_by_ref(
+        uint16_t replier_id,
+        uint16_t participant_id,
+        const std::string& ref)
+{
+    bool rv = false;
+    auto it_participant = participants_.find(participant_id);
+    if ((participants_.end() != it_participant) && (repliers_.end() == repliers_.find(replier_id)))
+    {
+        std::shared_ptr<CedGlobalService> service =
+            create_service(it_participant->second, ref, std::string(), std::string());
+        rv = service
+            && repliers_.emplace(
+                replier_id,
+                std::make_shared<CedReplier>(it_participant->second, service)).second;
+    }
+    return rv;
+}
+
+bool CedMiddleware::create_replier_by_xml(
+        uint16_t replier_id,
+        uint16_t participant_id,
+        const std::string& xml)
+{
+    return create_replier_by_ref(replier_id, participant_id, xml);
+}
+
+bool CedMiddleware::create_replier_by_bin(
+        uint16_t replier_id,
+        uint16_t participant_id,
+        const dds::xrce::OBJK_Replier_Binary& replier_xrce)
+{
+    bool rv = false;
+    auto it_participant = participants_.find(participant_id);
+    if ((participants_.end() != it_participant) && (repliers_.end() == repliers_.find(replier_id)))
+    {
+        std::shared_ptr<CedGlobalService> service =
+            create_service(
+                it_participant->second,
+                replier_xrce.service_name(),
+                replier_xrce.request_type(),
+                replier_xrce.reply_type());
+        rv = service
+            && repliers_.emplace(
+                replier_id,
+                std::make_shared<CedReplier>(it_participant->second, service)).second;
+    }
+    return rv;
+}
+
 /**********************************************************************************************************************
  * Delete functions.
  **********************************************************************************************************************/
@@ -346,6 +461,16 @@ bool CedMiddleware::delete_datareader(uint16_t datareader_id)
     return (0 != datareaders_.erase(datareader_id));
 }
 
+bool CedMiddleware::delete_requester(uint16_t requester_id)
+{
+    return (0 != requesters_.erase(requester_id));
+}
+
+bool CedMiddleware::delete_replier(uint16_t replier_id)
+{
+    return (0 != repliers_.erase(replier_id));
+}
+
 /**********************************************************************************************************************
  * Write/Read functions.
  **********************************************************************************************************************/
@@ -358,7 +483,70 @@ bool CedMiddleware::write_data(
     if (datawriters_.end() != it)
     {
         uint8_t errcode;
-        rv = it->second->write(data, errcode);
+        rv = it->second->write(data.data(), data.size(), errcode);
+    }
+    return rv;
+}
+
+bool CedMiddleware::write_data(
+        uint16_t datawriter_id,
+        const uint8_t* buf,
+        size_t len)
+{
+    bool rv = false;
+    auto it = datawriters_.find(datawriter_id);
+    if (datawriters_.end() != it)
+    {
+        uint8_t errcode;
+        rv = it->second->write(buf, len, errcode);
+    }
+    return rv;
+}
+
+size_t CedMiddleware::write_batch(
+        uint16_t datawriter_id,
+        const Sample* samples,
+        size_t count)
+{
+    size_t rv = 0;
+    auto it = datawriters_.find(datawriter_id);
+    if (datawriters_.end() != it)
+    {
+        /* Each call writes at most one history and wakes the readers up before the next one. */
+        uint8_t errcode;
+        size_t written = 0;
+        do
+        {
+            written = it->second->write(samples + rv, count - rv, errcode);
+            rv += written;
+        } while ((0 < written) && (rv < count));
+    }
+    return rv;
+}
+
+bool CedMiddleware::write_request(
+        uint16_t requester_id,
+        uint32_t sequence_number,
+        const std::vector<uint8_t>& data)
+{
+    bool rv = false;
+    auto it = requesters_.find(requester_id);
+    if (requesters_.end() != it)
+    {
+        rv = it->second->write(sequence_number, data);
+    }
+    return rv;
+}
+
+bool CedMiddleware::write_reply(
+        uint16_t replier_id,
+        const std::vector<uint8_t>& data)
+{
+    bool rv = false;
+    auto it = repliers_.find(replier_id);
+    if (repliers_.end() != it)
+    {
+        rv = it->second->write(data);
     }
     return rv;
 }
@@ -378,6 +566,35 @@ bool CedMiddleware::read_data(
     return rv;
 }
 
+bool CedMiddleware::read_request(
+        uint16_t replier_id,
+        std::vector<uint8_t>& data,
+        std::chrono::milliseconds timeout)
+{
+    bool rv = false;
+    auto it = repliers_.find(replier_id);
+    if (repliers_.end() != it)
+    {
+        rv = it->second->read(data, timeout);
+    }
+    return rv;
+}
+
+bool CedMiddleware::read_reply(
+        uint16_t requester_id,
+        uint32_t& sequence_number,
+        std::vector<uint8_t>& data,
+        std::chrono::milliseconds timeout)
+{
+    bool rv = false;
+    auto it = requesters_.find(requester_id);
+    if (requesters_.end() != it)
+    {
+        rv = it->second->read(sequence_number, data, timeout);
+    }
+    return rv;
+}
+
 /**********************************************************************************************************************
  * Matched functions.
  **********************************************************************************************************************/
@@ -508,5 +725,77 @@ bool CedMiddleware::matched_datareader_from_bin(
     return rv;
 }
 
+bool CedMiddleware::matched_requester_from_ref(
+        uint16_t requester_id,
+        const std::string& ref) const
+{
+    bool rv = false;
+    auto it = requesters_.find(requester_id);
+    if (requesters_.end() != it)
+    {
+        rv = it->second->match(ref, std::string(), std::string());
+    }
+    return rv;
+}
+
+bool CedMiddleware::matched_requester_from_xml(
+        uint16_t requester_id,
+        const std::string& xml) const
+{
+    return matched_requester_from_ref(requester_id, xml);
+}
+
+bool CedMiddleware::matched_requester_from_bin(
+        uint16_t requester_id,
+        const dds::xrce::OBJK_Requester_Binary& requester_xrce) const
+{
+    bool rv = false;
+    auto it = requesters_.find(requester_id);
+    if (requesters_.end() != it)
+    {
+        rv = it->second->match(
+            requester_xrce.service_name(),
+            requester_xrce.request_type(),
+            requester_xrce.reply_type());
+    }
+    return rv;
+}
+
+bool CedMiddleware::matched_replier_from_ref(
+        uint16_t replier_id,
+        const std::string& ref) const
+{
+    bool rv = false;
+    auto it = repliers_.find(replier_id);
+    if (repliers_.end() != it)
+    {
+        rv = it->second->match(ref, std::string(), std::string());
+    }
+    return rv;
+}
+
+bool CedMiddleware::matched_replier_from_xml(
+        uint16_t replier_id,
+        const std::string& xml) const
+{
+    return matched_replier_from_ref(replier_id, xml);
+}
+
+bool CedMiddleware::matched_replier_from_bin(
+        uint16_t replier_id,
+        const dds::xrce::OBJK_Replier_Binary& replier_xrce) const
+{
+    bool rv = false;
+    auto it = repliers_.find(replier_id);
+    if (repliers_.end() != it)
+    {
+        rv = it->second->match(
+            replier_xrce.service_name(),
+            replier_xrce.request_type(),
+            replier_xrce.reply_type());
+    }
+    return rv;
+}
+
 } // namespace uxr
 } // namespace eprosima
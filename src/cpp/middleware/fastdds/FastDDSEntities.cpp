@@ -13,16 +13,60 @@
 // limitations under the License.
 
 #include <uxr/agent/middleware/fastdds/FastDDSEntities.hpp>
+#include <uxr/agent/middleware/fastdds/FastDDSQosCache.hpp>
+#include <uxr/agent/utils/ThreadSettings.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/WriteParams.hpp>
 #include <fastcdr/FastBuffer.h>
 #include <fastcdr/Cdr.h>
 
+#ifndef _WIN32
+#include <sched.h>
+#endif
+
 namespace eprosima {
 namespace uxr {
 
+/*
+ * Applies the middleware thread policy to the internal threads of a participant. Fast DDS takes the
+ * CPU set as a mask, so only the first 64 cores can be selected.
+ */
+static void set_thread_settings(
+        fastdds::dds::DomainParticipantQos& qos)
+{
+    const utils::ThreadPolicy policy = utils::ThreadSettings::get_policy(utils::ThreadKind::MIDDLEWARE);
+    if (policy.is_default())
+    {
+        return;
+    }
+
+    fastdds::rtps::ThreadSettings settings;
+    for (uint16_t cpu : policy.cpus)
+    {
+        if (64 > cpu)
+        {
+            settings.affinity |= uint64_t(1) << cpu;
+        }
+    }
+#ifndef _WIN32
+    if (utils::SchedulingPolicy::DEFAULT != policy.scheduling)
+    {
+        settings.scheduling_policy = (utils::SchedulingPolicy::FIFO == policy.scheduling) ? SCHED_FIFO : SCHED_RR;
+        settings.priority = policy.priority;
+    }
+#endif
+
+    qos.timed_events_thread(settings);
+    qos.builtin_controllers_sender_thread(settings);
+    qos.discovery_server_thread(settings);
+    qos.typelookup_service_thread(settings);
+    qos.security_log_thread(settings);
+    qos.transport().builtin_transports_reception_threads_ = settings;
+}
+
 static void set_qos_from_xrce_object(
         fastdds::dds::DomainParticipantQos& qos,
         const dds::xrce::OBJK_DomainParticipant_Binary& participant_xrce)
@@ -261,7 +305,16 @@ bool FastDDSParticipant::create_by_ref(
     bool rv = false;
     if (nullptr == ptr_)
     {
-        ptr_ = factory_->create_participant_with_profile(domain_id_, ref);
+        fastdds::dds::DomainParticipantQos qos = factory_->get_default_participant_qos();
+        if (utils::ThreadSettings::get_policy(utils::ThreadKind::MIDDLEWARE).is_default())
+        {
+            ptr_ = factory_->create_participant_with_profile(domain_id_, ref);
+        }
+        else if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_participant_qos_from_profile(factory_, ref, qos))
+        {
+            set_thread_settings(qos);
+            ptr_ = factory_->create_participant(domain_id_, qos);
+        }
         rv = (nullptr != ptr_);
     }
     return rv;
@@ -272,8 +325,9 @@ bool FastDDSParticipant::create_by_xml(
 {
     bool rv = false;
     fastdds::dds::DomainParticipantQos qos = factory_->get_default_participant_qos();
-    if (nullptr == ptr_ && (xml.size() == 0 || fastdds::dds::RETCODE_OK == factory_->get_participant_qos_from_xml(xml, qos)))
+    if (nullptr == ptr_ && (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_participant_qos_from_xml(factory_, xml, qos)))
     {
+        set_thread_settings(qos);
         ptr_ = factory_->create_participant(domain_id_, qos);
         rv = (nullptr != ptr_);
     }
@@ -288,6 +342,7 @@ bool FastDDSParticipant::create_by_bin(
     {
         fastdds::dds::DomainParticipantQos qos = factory_->get_default_participant_qos();
         set_qos_from_xrce_object(qos, participant_xrce);
+        set_thread_settings(qos);
         ptr_ = factory_->create_participant(domain_id_, qos);
         rv = (nullptr != ptr_);
     }
@@ -299,7 +354,7 @@ bool FastDDSParticipant::match_from_ref(
 {
     bool rv = false;
     fastdds::dds::DomainParticipantQos qos = factory_->get_default_participant_qos();
-    if (nullptr != ptr_ && fastdds::dds::RETCODE_OK == factory_->get_participant_qos_from_profile(ref, qos))
+    if (nullptr != ptr_ && fastdds::dds::RETCODE_OK == FastDDSQosCache::get_participant_qos_from_profile(factory_, ref, qos))
     {
         rv = (ptr_->get_qos().name() == qos.name());
     }
@@ -311,7 +366,7 @@ bool FastDDSParticipant::match_from_xml(
 {
     bool rv = false;
     fastdds::dds::DomainParticipantQos qos = factory_->get_default_participant_qos();
-    if (nullptr != ptr_ && (xml.size() == 0 || fastdds::dds::RETCODE_OK == factory_->get_participant_qos_from_xml(xml, qos)))
+    if (nullptr != ptr_ && (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_participant_qos_from_xml(factory_, xml, qos)))
     {
         rv = (ptr_->get_qos().name() == qos.name());
     }
@@ -547,7 +602,7 @@ bool FastDDSTopic::match_from_ref(
         fastdds::dds::TopicQos qos;
         std::string topic_name;
         std::string type_name;
-        if (fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_topic_qos_from_profile(ref, qos, topic_name, type_name))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_topic_qos_from_profile(participant_->get_ptr(), ref, qos, topic_name, type_name))
         {
             rv = (ptr_->get_qos() == qos) && (ptr_->get_name() == topic_name) && (type_->get_type_support()->get_name() == type_name);
         }
@@ -566,7 +621,7 @@ bool FastDDSTopic::match_from_xml(
         fastdds::dds::TopicQos qos = participant_->get_ptr()->get_default_topic_qos();
         std::string topic_name;
         std::string type_name;
-        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_topic_qos_from_xml(xml, qos, topic_name, type_name))
+        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_topic_qos_from_xml(participant_->get_ptr(), xml, qos, topic_name, type_name))
         {
             rv = (ptr_->get_qos() == qos) && (ptr_->get_name() == topic_name) && (type_->get_type_support()->get_name() == type_name);
         }
@@ -606,7 +661,7 @@ bool FastDDSPublisher::create_by_xml(
     if (nullptr == ptr_)
     {
         fastdds::dds::PublisherQos qos = participant_->get_ptr()->get_default_publisher_qos();
-        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_publisher_qos_from_xml(xml, qos))
+        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_publisher_qos_from_xml(participant_->get_ptr(), xml, qos))
         {
             ptr_ = participant_->create_publisher(qos);
             rv = (nullptr != ptr_);
@@ -675,7 +730,7 @@ bool FastDDSSubscriber::create_by_xml(
     if (nullptr == ptr_)
     {
         fastdds::dds::SubscriberQos qos = participant_->get_ptr()->get_default_subscriber_qos();
-        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_subscriber_qos_from_xml(xml, qos))
+        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_subscriber_qos_from_xml(participant_->get_ptr(), xml, qos))
         {
             ptr_ = participant_->create_subscriber(qos);
             rv = (nullptr != ptr_);
@@ -742,7 +797,7 @@ bool FastDDSDataWriter::create_by_ref(const std::string& ref)
     {
         fastdds::dds::DataWriterQos qos;
         std::string topic_name;
-        if (fastdds::dds::RETCODE_OK == publisher_->get_ptr()->get_datawriter_qos_from_profile(ref, qos, topic_name))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datawriter_qos_from_profile(publisher_->get_ptr(), ref, qos, topic_name))
         {
             topic_ = publisher_->get_participant()->find_local_topic(topic_name);
 
@@ -764,7 +819,7 @@ bool FastDDSDataWriter::create_by_xml(const std::string& xml)
         std::string topic_name;
         fastdds::dds::DataWriterQos qos = publisher_->get_ptr()->get_default_datawriter_qos();
 
-        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == publisher_->get_ptr()->get_datawriter_qos_from_xml(xml, qos, topic_name))
+        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datawriter_qos_from_xml(publisher_->get_ptr(), xml, qos, topic_name))
         {
             topic_ = publisher_->get_participant()->find_local_topic(topic_name);
 
@@ -803,7 +858,7 @@ bool FastDDSDataWriter::match_from_ref(const std::string& ref) const
     {
         fastdds::dds::DataWriterQos qos;
         std::string topic_name;
-        if (fastdds::dds::RETCODE_OK == publisher_->get_ptr()->get_datawriter_qos_from_profile(ref, qos, topic_name))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datawriter_qos_from_profile(publisher_->get_ptr(), ref, qos, topic_name))
         {
             rv = (ptr_->get_qos() == qos) && (topic_->get_name() == topic_name);
         }
@@ -820,7 +875,7 @@ bool FastDDSDataWriter::match_from_xml(const std::string& xml) const
     {
         fastdds::dds::DataWriterQos qos = publisher_->get_ptr()->get_default_datawriter_qos();
         std::string topic_name;
-        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == publisher_->get_ptr()->get_datawriter_qos_from_xml(xml, qos, topic_name))
+        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datawriter_qos_from_xml(publisher_->get_ptr(), xml, qos, topic_name))
         {
             rv = (ptr_->get_qos() == qos) && (topic_->get_name() == topic_name);
         }
@@ -871,7 +926,7 @@ bool FastDDSDataReader::create_by_ref(const std::string& ref)
         fastdds::dds::DataReaderQos qos;
         std::string topic_name;
 
-        if (fastdds::dds::RETCODE_OK == subscriber_->get_ptr()->get_datareader_qos_from_profile(ref, qos, topic_name))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datareader_qos_from_profile(subscriber_->get_ptr(), ref, qos, topic_name))
         {
             topic_ = subscriber_->get_participant()->find_local_topic(topic_name);
 
@@ -893,7 +948,7 @@ bool FastDDSDataReader::create_by_xml(const std::string& xml)
         std::string topic_name;
         fastdds::dds::DataReaderQos qos = subscriber_->get_ptr()->get_default_datareader_qos();
 
-        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == subscriber_->get_ptr()->get_datareader_qos_from_xml(xml, qos, topic_name))
+        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datareader_qos_from_xml(subscriber_->get_ptr(), xml, qos, topic_name))
         {
             topic_ = subscriber_->get_participant()->find_local_topic(topic_name);
 
@@ -933,7 +988,7 @@ bool FastDDSDataReader::match_from_ref(
     {
         fastdds::dds::DataReaderQos qos;
         std::string topic_name;
-        if (fastdds::dds::RETCODE_OK == subscriber_->get_ptr()->get_datareader_qos_from_profile(ref, qos, topic_name))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datareader_qos_from_profile(subscriber_->get_ptr(), ref, qos, topic_name))
         {
             rv = (ptr_->get_qos() == qos) && (topic_->get_name() == topic_name);
         }
@@ -951,7 +1006,7 @@ bool FastDDSDataReader::match_from_xml(
     {
         fastdds::dds::DataReaderQos qos = subscriber_->get_ptr()->get_default_datareader_qos();
         std::string topic_name;
-        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == subscriber_->get_ptr()->get_datareader_qos_from_xml(xml, qos, topic_name))
+        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_datareader_qos_from_xml(subscriber_->get_ptr(), xml, qos, topic_name))
         {
             rv = (ptr_->get_qos() == qos) && (topic_->get_name() == topic_name);
         }
@@ -1048,7 +1103,7 @@ bool FastDDSRequester::match_from_ref(const std::string& ref) const
 
     fastdds::dds::RequesterQos qos;
 
-    if(fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_requester_qos_from_profile(ref, qos))
+    if(fastdds::dds::RETCODE_OK == FastDDSQosCache::get_requester_qos_from_profile(participant_->get_ptr(), ref, qos))
     {
         rv = datawriter_ptr_->get_qos() == qos.writer_qos
             && datareader_ptr_->get_qos() == qos.reader_qos
@@ -1069,7 +1124,7 @@ bool FastDDSRequester::match_from_xml(const std::string& xml) const
     qos.writer_qos = publisher_ptr_->get_default_datawriter_qos();
     qos.reader_qos = subscriber_ptr_->get_default_datareader_qos();
 
-    if(xml.size() == 0 || fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_requester_qos_from_xml(xml, qos))
+    if(xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_requester_qos_from_xml(participant_->get_ptr(), xml, qos))
     {
         rv = datawriter_ptr_->get_qos() == qos.writer_qos
             && datareader_ptr_->get_qos() == qos.reader_qos
@@ -1109,7 +1164,7 @@ bool FastDDSRequester::write(
         {
             int64_t sequence = (int64_t)wparams.sample_identity().sequence_number().high << 32;
             sequence += wparams.sample_identity().sequence_number().low;
-            sequence_to_sequence_.emplace(sequence, sequence_number);
+            pending_requests_.insert(uint64_t(sequence), sequence_number);
         }
     }
     catch(const std::exception&)
@@ -1143,16 +1198,7 @@ bool FastDDSRequester::read(
             {
                 int64_t sequence = (int64_t)info.related_sample_identity.sequence_number().high << 32;
                 sequence += info.related_sample_identity.sequence_number().low;
-                auto it = sequence_to_sequence_.find(sequence);
-                if (it != sequence_to_sequence_.end())
-                {
-                    sequence_number = it->second;
-                    sequence_to_sequence_.erase(it);
-                }
-                else
-                {
-                    rv = false;
-                }
+                rv = pending_requests_.take(uint64_t(sequence), sequence_number);
             }
             else
             {
@@ -1220,7 +1266,7 @@ bool FastDDSReplier::match_from_ref(const std::string& ref) const
 
     fastdds::dds::ReplierQos qos;
 
-    if (fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_replier_qos_from_profile(ref, qos))
+    if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_replier_qos_from_profile(participant_->get_ptr(), ref, qos))
     {
         rv = datawriter_ptr_->get_qos() == qos.writer_qos
             && datareader_ptr_->get_qos() == qos.reader_qos
@@ -1241,7 +1287,7 @@ bool FastDDSReplier::match_from_xml(const std::string& xml) const
     qos.writer_qos = publisher_ptr_->get_default_datawriter_qos();
     qos.reader_qos = subscriber_ptr_->get_default_datareader_qos();
 
-    if (xml.size() == 0 || fastdds::dds::RETCODE_OK == participant_->get_ptr()->get_replier_qos_from_xml(xml, qos))
+    if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_replier_qos_from_xml(participant_->get_ptr(), xml, qos))
     {
         rv = datawriter_ptr_->get_qos() == qos.writer_qos
             && datareader_ptr_->get_qos() == qos.reader_qos
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <uxr/agent/middleware/fastdds/FastDDSMiddleware.hpp>
+#include <uxr/agent/middleware/fastdds/FastDDSQosCache.hpp>
 #include <uxr/agent/utils/Conversion.hpp>
 #include <uxr/agent/logger/Logger.hpp>
 
@@ -82,7 +83,7 @@ bool FastDDSMiddleware::create_participant_by_ref(
 
         auto factory = fastdds::dds::DomainParticipantFactory::get_instance();
 
-        if (fastdds::dds::RETCODE_OK == factory->get_participant_extended_qos_from_profile(ref, qos))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_participant_extended_qos_from_profile(factory, ref, qos))
         {
             participant_domain_id = static_cast<int16_t>(qos.domainId());
         }
@@ -223,7 +224,7 @@ bool FastDDSMiddleware::create_topic_by_ref(
 
         auto & participant = it_participant->second;
 
-        if (fastdds::dds::RETCODE_OK == participant->get_ptr()->get_topic_qos_from_profile(ref, qos, topic_name, type_name))
+        if (fastdds::dds::RETCODE_OK == FastDDSQosCache::get_topic_qos_from_profile(participant->get_ptr(), ref, qos, topic_name, type_name))
         {
             std::shared_ptr<FastDDSTopic> topic = create_topic(participant, qos, topic_name, type_name);
             if (topic)
@@ -253,7 +254,7 @@ bool FastDDSMiddleware::create_topic_by_xml(
         std::string topic_name;
         std::string type_name;
 
-        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == participant->get_ptr()->get_topic_qos_from_xml(xml, qos, topic_name, type_name))
+        if (xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_topic_qos_from_xml(participant->get_ptr(), xml, qos, topic_name, type_name))
         {
             std::shared_ptr<FastDDSTopic> topic = create_topic(participant, qos, topic_name, type_name);
             if (topic)
@@ -569,7 +570,7 @@ bool FastDDSMiddleware::create_requester_by_ref(
         std::shared_ptr<FastDDSParticipant>& participant = it_participant->second;
 
         fastdds::dds::RequesterQos qos;
-        if(fastdds::dds::RETCODE_OK == participant->get_ptr()->get_requester_qos_from_profile(ref, qos))
+        if(fastdds::dds::RETCODE_OK == FastDDSQosCache::get_requester_qos_from_profile(participant->get_ptr(), ref, qos))
         {
             std::shared_ptr<FastDDSRequester> requester = create_requester(participant, qos);
 
@@ -606,7 +607,7 @@ bool FastDDSMiddleware::create_requester_by_xml(
         std::shared_ptr<FastDDSParticipant>& participant = it_participant->second;
 
         fastdds::dds::RequesterQos qos;
-        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == participant->get_ptr()->get_requester_qos_from_xml(xml, qos))
+        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_requester_qos_from_xml(participant->get_ptr(), xml, qos))
         {
             std::shared_ptr<FastDDSRequester> requester = create_requester(participant, qos);
 
@@ -709,7 +710,7 @@ bool FastDDSMiddleware::create_replier_by_ref(
         std::shared_ptr<FastDDSParticipant>& participant = it_participant->second;
 
         fastdds::dds::ReplierQos qos;
-        if(fastdds::dds::RETCODE_OK == participant->get_ptr()->get_replier_qos_from_profile(ref, qos))
+        if(fastdds::dds::RETCODE_OK == FastDDSQosCache::get_replier_qos_from_profile(participant->get_ptr(), ref, qos))
         {
             std::shared_ptr<FastDDSReplier> replier = create_replier(participant, qos);
 
@@ -746,7 +747,7 @@ bool FastDDSMiddleware::create_replier_by_xml(
         std::shared_ptr<FastDDSParticipant>& participant = it_participant->second;
 
         fastdds::dds::ReplierQos qos;
-        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == participant->get_ptr()->get_replier_qos_from_xml(xml, qos))
+        if(xml.size() == 0 || fastdds::dds::RETCODE_OK == FastDDSQosCache::get_replier_qos_from_xml(participant->get_ptr(), xml, qos))
         {
             std::shared_ptr<FastDDSReplier> replier = create_replier(participant, qos);
 
@@ -1084,7 +1085,7 @@ bool FastDDSMiddleware::matched_participant_from_ref(
         fastdds::dds::DomainParticipantExtendedQos qos;
         auto factory = fastdds::dds::DomainParticipantFactory::get_instance();
         auto participant_domain_id = domain_id;
-        if(domain_id == UXR_CLIENT_DOMAIN_ID_TO_USE_FROM_REF && fastdds::dds::RETCODE_OK == factory->get_participant_extended_qos_from_profile(ref, qos))
+        if(domain_id == UXR_CLIENT_DOMAIN_ID_TO_USE_FROM_REF && fastdds::dds::RETCODE_OK == FastDDSQosCache::get_participant_extended_qos_from_profile(factory, ref, qos))
         {
             participant_domain_id = static_cast<int16_t>(qos.domainId());
         }
@@ -0,0 +1,368 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/middleware/fastdds/FastDDSQosCache.hpp>
+#include <uxr/agent/config.hpp>
+
+#include <fastdds/dds/domain/qos/ReplierQos.hpp>
+#include <fastdds/dds/domain/qos/RequesterQos.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace eprosima {
+namespace uxr {
+
+namespace {
+
+std::atomic<uint64_t> cache_generation{0};
+
+struct TopicDescriptor
+{
+    fastdds::dds::TopicQos qos;
+    std::string topic_name;
+    std::string type_name;
+};
+
+template<typename Qos>
+struct EndpointDescriptor
+{
+    Qos qos;
+    std::string topic_name;
+};
+
+/*
+ * Cache of a single entity kind. The key is the XML string or the profile name, prefixed so that
+ * a profile named like an XML string does not collide with it. Only successful parses are stored,
+ * and the cache is simply emptied when it fills up, since a fleet uses a handful of distinct strings.
+ */
+template<typename Descriptor>
+class QosCache
+{
+public:
+    template<typename Parse>
+    fastdds::dds::ReturnCode_t get(
+            char prefix,
+            const std::string& str,
+            Descriptor& descriptor,
+            Parse&& parse)
+    {
+        if (0 == QOS_CACHE_SIZE)
+        {
+            return parse(descriptor);
+        }
+
+        std::string key;
+        key.reserve(str.size() + 1);
+        key.push_back(prefix);
+        key.append(str);
+
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            refresh();
+            auto it = entries_.find(key);
+            if (entries_.end() != it)
+            {
+                descriptor = it->second;
+                return fastdds::dds::RETCODE_OK;
+            }
+        }
+
+        /* Parse outside the lock, concurrent misses on the same key just store the same result. */
+        fastdds::dds::ReturnCode_t rv = parse(descriptor);
+        if (fastdds::dds::RETCODE_OK == rv)
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            refresh();
+            if (QOS_CACHE_SIZE <= entries_.size())
+            {
+                entries_.clear();
+            }
+            entries_.emplace(std::move(key), descriptor);
+        }
+        return rv;
+    }
+
+private:
+    void refresh()
+    {
+        uint64_t generation = cache_generation.load(std::memory_order_acquire);
+        if (generation != generation_)
+        {
+            entries_.clear();
+            generation_ = generation;
+        }
+    }
+
+private:
+    std::mutex mtx_;
+    uint64_t generation_ = 0;
+    std::unordered_map<std::string, Descriptor> entries_;
+};
+
+const char xml_prefix = 'x';
+const char ref_prefix = 'r';
+
+QosCache<fastdds::dds::DomainParticipantQos> participant_cache;
+QosCache<fastdds::dds::DomainParticipantExtendedQos> participant_extended_cache;
+QosCache<TopicDescriptor> topic_cache;
+QosCache<fastdds::dds::PublisherQos> publisher_cache;
+QosCache<fastdds::dds::SubscriberQos> subscriber_cache;
+QosCache<EndpointDescriptor<fastdds::dds::DataWriterQos>> datawriter_cache;
+QosCache<EndpointDescriptor<fastdds::dds::DataReaderQos>> datareader_cache;
+QosCache<fastdds::dds::RequesterQos> requester_cache;
+QosCache<fastdds::dds::ReplierQos> replier_cache;
+
+} // namespace
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_participant_qos_from_xml(
+        fastdds::dds::DomainParticipantFactory* factory,
+        const std::string& xml,
+        fastdds::dds::DomainParticipantQos& qos)
+{
+    return participant_cache.get(xml_prefix, xml, qos,
+        [&](fastdds::dds::DomainParticipantQos& parsed)
+        {
+            return factory->get_participant_qos_from_xml(xml, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_participant_qos_from_profile(
+        fastdds::dds::DomainParticipantFactory* factory,
+        const std::string& ref,
+        fastdds::dds::DomainParticipantQos& qos)
+{
+    return participant_cache.get(ref_prefix, ref, qos,
+        [&](fastdds::dds::DomainParticipantQos& parsed)
+        {
+            return factory->get_participant_qos_from_profile(ref, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_participant_extended_qos_from_profile(
+        fastdds::dds::DomainParticipantFactory* factory,
+        const std::string& ref,
+        fastdds::dds::DomainParticipantExtendedQos& qos)
+{
+    return participant_extended_cache.get(ref_prefix, ref, qos,
+        [&](fastdds::dds::DomainParticipantExtendedQos& parsed)
+        {
+            return factory->get_participant_extended_qos_from_profile(ref, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_topic_qos_from_xml(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& xml,
+        fastdds::dds::TopicQos& qos,
+        std::string& topic_name,
+        std::string& type_name)
+{
+    TopicDescriptor descriptor{qos, topic_name, type_name};
+    fastdds::dds::ReturnCode_t rv = topic_cache.get(xml_prefix, xml, descriptor,
+        [&](TopicDescriptor& parsed)
+        {
+            return participant->get_topic_qos_from_xml(xml, parsed.qos, parsed.topic_name, parsed.type_name);
+        });
+    if (fastdds::dds::RETCODE_OK == rv)
+    {
+        qos = std::move(descriptor.qos);
+        topic_name = std::move(descriptor.topic_name);
+        type_name = std::move(descriptor.type_name);
+    }
+    return rv;
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_topic_qos_from_profile(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& ref,
+        fastdds::dds::TopicQos& qos,
+        std::string& topic_name,
+        std::string& type_name)
+{
+    TopicDescriptor descriptor{qos, topic_name, type_name};
+    fastdds::dds::ReturnCode_t rv = topic_cache.get(ref_prefix, ref, descriptor,
+        [&](TopicDescriptor& parsed)
+        {
+            return participant->get_topic_qos_from_profile(ref, parsed.qos, parsed.topic_name, parsed.type_name);
+        });
+    if (fastdds::dds::RETCODE_OK == rv)
+    {
+        qos = std::move(descriptor.qos);
+        topic_name = std::move(descriptor.topic_name);
+        type_name = std::move(descriptor.type_name);
+    }
+    return rv;
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_publisher_qos_from_xml(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& xml,
+        fastdds::dds::PublisherQos& qos)
+{
+    return publisher_cache.get(xml_prefix, xml, qos,
+        [&](fastdds::dds::PublisherQos& parsed)
+        {
+            return participant->get_publisher_qos_from_xml(xml, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_subscriber_qos_from_xml(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& xml,
+        fastdds::dds::SubscriberQos& qos)
+{
+    return subscriber_cache.get(xml_prefix, xml, qos,
+        [&](fastdds::dds::SubscriberQos& parsed)
+        {
+            return participant->get_subscriber_qos_from_xml(xml, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_datawriter_qos_from_xml(
+        fastdds::dds::Publisher* publisher,
+        const std::string& xml,
+        fastdds::dds::DataWriterQos& qos,
+        std::string& topic_name)
+{
+    EndpointDescriptor<fastdds::dds::DataWriterQos> descriptor{qos, topic_name};
+    fastdds::dds::ReturnCode_t rv = datawriter_cache.get(xml_prefix, xml, descriptor,
+        [&](EndpointDescriptor<fastdds::dds::DataWriterQos>& parsed)
+        {
+            return publisher->get_datawriter_qos_from_xml(xml, parsed.qos, parsed.topic_name);
+        });
+    if (fastdds::dds::RETCODE_OK == rv)
+    {
+        qos = std::move(descriptor.qos);
+        topic_name = std::move(descriptor.topic_name);
+    }
+    return rv;
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_datawriter_qos_from_profile(
+        fastdds::dds::Publisher* publisher,
+        const std::string& ref,
+        fastdds::dds::DataWriterQos& qos,
+        std::string& topic_name)
+{
+    EndpointDescriptor<fastdds::dds::DataWriterQos> descriptor{qos, topic_name};
+    fastdds::dds::ReturnCode_t rv = datawriter_cache.get(ref_prefix, ref, descriptor,
+        [&](EndpointDescriptor<fastdds::dds::DataWriterQos>& parsed)
+        {
+            return publisher->get_datawriter_qos_from_profile(ref, parsed.qos, parsed.topic_name);
+        });
+    if (fastdds::dds::RETCODE_OK == rv)
+    {
+        qos = std::move(descriptor.qos);
+        topic_name = std::move(descriptor.topic_name);
+    }
+    return rv;
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_datareader_qos_from_xml(
+        fastdds::dds::Subscriber* subscriber,
+        const std::string& xml,
+        fastdds::dds::DataReaderQos& qos,
+        std::string& topic_name)
+{
+    EndpointDescriptor<fastdds::dds::DataReaderQos> descriptor{qos, topic_name};
+    fastdds::dds::ReturnCode_t rv = datareader_cache.get(xml_prefix, xml, descriptor,
+        [&](EndpointDescriptor<fastdds::dds::DataReaderQos>& parsed)
+        {
+            return subscriber->get_datareader_qos_from_xml(xml, parsed.qos, parsed.topic_name);
+        });
+    if (fastdds::dds::RETCODE_OK == rv)
+    {
+        qos = std::move(descriptor.qos);
+        topic_name = std::move(descriptor.topic_name);
+    }
+    return rv;
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_datareader_qos_from_profile(
+        fastdds::dds::Subscriber* subscriber,
+        const std::string& ref,
+        fastdds::dds::DataReaderQos& qos,
+        std::string& topic_name)
+{
+    EndpointDescriptor<fastdds::dds::DataReaderQos> descriptor{qos, topic_name};
+    fastdds::dds::ReturnCode_t rv = datareader_cache.get(ref_prefix, ref, descriptor,
+        [&](EndpointDescriptor<fastdds::dds::DataReaderQos>& parsed)
+        {
+            return subscriber->get_datareader_qos_from_profile(ref, parsed.qos, parsed.topic_name);
+        });
+    if (fastdds::dds::RETCODE_OK == rv)
+    {
+        qos = std::move(descriptor.qos);
+        topic_name = std::move(descriptor.topic_name);
+    }
+    return rv;
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_requester_qos_from_xml(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& xml,
+        fastdds::dds::RequesterQos& qos)
+{
+    return requester_cache.get(xml_prefix, xml, qos,
+        [&](fastdds::dds::RequesterQos& parsed)
+        {
+            return participant->get_requester_qos_from_xml(xml, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_requester_qos_from_profile(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& ref,
+        fastdds::dds::RequesterQos& qos)
+{
+    return requester_cache.get(ref_prefix, ref, qos,
+        [&](fastdds::dds::RequesterQos& parsed)
+        {
+            return participant->get_requester_qos_from_profile(ref, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_replier_qos_from_xml(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& xml,
+        fastdds::dds::ReplierQos& qos)
+{
+    return replier_cache.get(xml_prefix, xml, qos,
+        [&](fastdds::dds::ReplierQos& parsed)
+        {
+            return participant->get_replier_qos_from_xml(xml, parsed);
+        });
+}
+
+fastdds::dds::ReturnCode_t FastDDSQosCache::get_replier_qos_from_profile(
+        fastdds::dds::DomainParticipant* participant,
+        const std::string& ref,
+        fastdds::dds::ReplierQos& qos)
+{
+    return replier_cache.get(ref_prefix, ref, qos,
+        [&](fastdds::dds::ReplierQos& parsed)
+        {
+            return participant->get_replier_qos_from_profile(ref, parsed);
+        });
+}
+
+void FastDDSQosCache::clear()
+{
+    cache_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+} // namespace uxr
+} // namespace eprosima
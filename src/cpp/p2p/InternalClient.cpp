@@ -13,12 +13,15 @@
 // limitations under the License.
 
 #include <uxr/agent/p2p/InternalClient.hpp>
+#include <uxr/agent/p2p/InternalClientManager.hpp>
 #include <uxr/agent/middleware/ced/CedEntities.hpp>
 #include <uxr/agent/Agent.hpp>
 #include <uxr/agent/logger/Logger.hpp>
 #include <ucdr/microcdr.h>
 
 #include <string>
+#include <cstring>
+#include <algorithm>
 #include <iostream>
 
 namespace eprosima {
@@ -26,17 +29,21 @@ namespace uxr {
 
 InternalClient::InternalClient(
         Agent& agent,
+        InternalClientManager& manager,
         const std::array<uint8_t, 4>& ip,
         uint16_t port,
         uint32_t remote_client_key,
         uint32_t local_client_key)
     : agent_(agent)
+    , manager_(manager)
     , ip_(ip)
     , port_{port}
     , domains_{}
     , topics_{}
-    , topic_counter_{0}
+    , unsubscribed_topics_{}
+    , bridged_topics_{}
     , transport_{}
+    , inbox_{}
     , remote_client_key_{remote_client_key}
     , local_client_key_{local_client_key}
     , session_{}
@@ -45,9 +52,51 @@ InternalClient::InternalClient(
     , out_stream_id_{}
     , in_stream_id_{}
     , running_cond_{false}
-    , thread_{}
 {}
 
+InternalClient::~InternalClient()
+{
+    stop();
+}
+
+static bool open_transport(
+        uxrCustomTransport* transport)
+{
+    (void) transport;
+    return true;
+}
+
+static bool close_transport(
+        uxrCustomTransport* transport)
+{
+    (void) transport;
+    return true;
+}
+
+static size_t write_transport(
+        uxrCustomTransport* transport,
+        const uint8_t* buf,
+        size_t len,
+        uint8_t* error)
+{
+    InternalClient* internal_client = reinterpret_cast<InternalClient*>(transport->args);
+    size_t rv = internal_client->get_manager().send_to(*internal_client, buf, len);
+    *error = (0 == rv) ? 1 : 0;
+    return rv;
+}
+
+static size_t read_transport(
+        uxrCustomTransport* transport,
+        uint8_t* buf,
+        size_t len,
+        int timeout,
+        uint8_t* error)
+{
+    (void) error;
+    InternalClient* internal_client = reinterpret_cast<InternalClient*>(transport->args);
+    return internal_client->get_manager().recv_from(*internal_client, buf, len, timeout);
+}
+
 static void on_topic(
         uxrSession* session,
         uxrObjectId object_id,
@@ -83,9 +132,10 @@ bool InternalClient::run()
                 remote_client_key_,
                 std::bind(&InternalClient::on_new_domain, this, std::placeholders::_1));
 
-    CedTopicManager::register_on_new_topic_cb(
+    CedTopicManager::register_on_topic_interest_cb(
                 remote_client_key_,
-                std::bind(&InternalClient::on_new_topic, this, std::placeholders::_1, std::placeholders::_2));
+                std::bind(&InternalClient::on_topic_interest, this,
+                    std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 
     std::string ip = std::to_string(ip_[0]) + ".";
     ip += std::to_string(ip_[1]) + ".";
@@ -95,10 +145,17 @@ bool InternalClient::run()
     std::string port = std::to_string(port_);
 
     Agent::OpResult result;
-    if (agent_.create_client(INTERNAL_CLIENT_KEY, 0x00, UXR_CONFIG_UDP_TRANSPORT_MTU, Middleware::Kind::CED, result))
+    if (agent_.create_client(INTERNAL_CLIENT_KEY, 0x00, UXR_CONFIG_CUSTOM_TRANSPORT_MTU, Middleware::Kind::CED, result))
     {
         /* Transport. */
-        if (uxr_init_udp_transport(&transport_, UXR_IPv4, ip.c_str(), port.c_str()))
+        uxr_set_custom_transport_callbacks(
+            &transport_,
+            false,
+            open_transport,
+            close_transport,
+            write_transport,
+            read_transport);
+        if (uxr_init_custom_transport(&transport_, this))
         {
             /* Session. */
             uxr_init_session(&session_, &transport_.comm, local_client_key_);
@@ -116,7 +173,6 @@ bool InternalClient::run()
                     ip, port);
 
                 running_cond_ = true;
-                thread_ = std::thread(&InternalClient::loop, this);
                 rv = true;
             }
             else
@@ -136,18 +192,61 @@ bool InternalClient::run()
         }
     }
 
+    if (!rv)
+    {
+        unregister_callbacks();
+    }
+
     return rv;
 }
 
 bool InternalClient::stop()
 {
-    /* Stop thread. */
-    running_cond_ = false;
-    if (thread_.joinable())
+    /* The CED callbacks hold this pointer, and must not outlive the client. */
+    unregister_callbacks();
+
+    bool rv = true;
+    if (running_cond_)
     {
-        thread_.join();
+        running_cond_ = false;
+        rv = uxr_close_custom_transport(&transport_);
     }
-    return true;
+    return rv;
+}
+
+void InternalClient::push_message(
+        const uint8_t* buf,
+        size_t len)
+{
+    /* Older datagrams are dropped, the reliable streams will recover them. */
+    if (inbox_.size() >= internal_client_history)
+    {
+        inbox_.pop_front();
+    }
+    inbox_.emplace_back(buf, buf + len);
+}
+
+bool InternalClient::pop_message(
+        uint8_t* buf,
+        size_t len,
+        size_t& message_len)
+{
+    bool rv = false;
+    if (!inbox_.empty())
+    {
+        const std::vector<uint8_t>& message = inbox_.front();
+        message_len = (std::min)(len, message.size());
+        std::memcpy(buf, message.data(), message_len);
+        inbox_.pop_front();
+        rv = true;
+    }
+    return rv;
+}
+
+void InternalClient::unregister_callbacks()
+{
+    CedTopicManager::unregister_on_new_domain_cb(remote_client_key_);
+    CedTopicManager::unregister_on_topic_interest_cb(remote_client_key_);
 }
 
 void InternalClient::set_callback()
@@ -258,27 +357,32 @@ void InternalClient::create_domain_entities()
 
 void InternalClient::create_topic_entities()
 {
-    /* Get domains. */
+    /* Get topics. */
     std::unique_lock<std::mutex> lock(mtx_);
     if (!topics_.empty())
     {
-        std::set<std::pair<int16_t, std::string>> created_topics = topics_;
+        std::set<std::pair<int16_t, std::string>> requested_topics;
+        requested_topics.swap(topics_);
         lock.unlock();
-        for (auto it = created_topics.begin(); it != created_topics.end(); )
+        for (const auto& topic : requested_topics)
         {
-            bool entities_created = false;
+            if (bridged_topics_.end() != bridged_topics_.find(topic))
+            {
+                continue;
+            }
 
-            /* Create local entities. */
+            /* Create local entities, under an id no other InternalClient uses for INTERNAL_CLIENT_KEY. */
             Agent::OpResult result;
-            const uint16_t internal_paraticipant_id = uint16_t(it->first);
-            const uint16_t internal_topic_id = topic_counter_;
-            const uint16_t internal_publisher_id = uint16_t(it->first);
-            const uint16_t internal_datawriter_id = topic_counter_;
+            const uint16_t entity_id = manager_.next_entity_id();
+            const uint16_t internal_paraticipant_id = uint16_t(topic.first);
+            const uint16_t internal_topic_id = entity_id;
+            const uint16_t internal_publisher_id = uint16_t(topic.first);
+            const uint16_t internal_datawriter_id = entity_id;
             if (agent_.create_topic_by_ref(
                         INTERNAL_CLIENT_KEY,
                         internal_topic_id,
                         internal_paraticipant_id,
-                        it->second.c_str(),
+                        topic.second.c_str(),
                         Agent::REUSE_MODE,
                         result)
                     &&
@@ -286,16 +390,16 @@ void InternalClient::create_topic_entities()
                         INTERNAL_CLIENT_KEY,
                         internal_datawriter_id,
                         internal_publisher_id,
-                        it->second.c_str(),
+                        topic.second.c_str(),
                         Agent::REUSE_MODE,
                         result))
             {
-                uxrObjectId external_participant_id = uxr_object_id(uint16_t(it->first), UXR_PARTICIPANT_ID);
-                uxrObjectId external_topic_id = uxr_object_id(uint16_t(topic_counter_), UXR_TOPIC_ID);
-                uxrObjectId external_subscriber_id = uxr_object_id(uint16_t(it->first), UXR_SUBSCRIBER_ID);
-                uxrObjectId external_datareader_id = uxr_object_id(uint16_t(topic_counter_), UXR_DATAREADER_ID);
+                uxrObjectId external_participant_id = uxr_object_id(uint16_t(topic.first), UXR_PARTICIPANT_ID);
+                uxrObjectId external_topic_id = uxr_object_id(entity_id, UXR_TOPIC_ID);
+                uxrObjectId external_subscriber_id = uxr_object_id(uint16_t(topic.first), UXR_SUBSCRIBER_ID);
+                uxrObjectId external_datareader_id = uxr_object_id(entity_id, UXR_DATAREADER_ID);
 
-                const char* ref = it->second.c_str();
+                const char* ref = topic.second.c_str();
 
                 uint16_t topic_request = uxr_buffer_create_topic_ref(
                             &session_,
@@ -329,7 +433,7 @@ void InternalClient::create_topic_entities()
                 {
                     if (UXR_STATUS_OK == status[0] && UXR_STATUS_OK == status[1])
                     {
-                        entities_created = true;
+                        bridged_topics_.emplace(topic, entity_id);
                     }
                 }
                 else
@@ -337,54 +441,97 @@ void InternalClient::create_topic_entities()
                     std::cerr << "--> ERROR: failed to create Topic Entities in InternalClient" << std::endl;
                 }
             }
-            if (entities_created)
+        }
+    }
+}
+
+void InternalClient::delete_topic_entities()
+{
+    /* Get topics. */
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (!unsubscribed_topics_.empty())
+    {
+        std::set<std::pair<int16_t, std::string>> unsubscribed_topics;
+        unsubscribed_topics.swap(unsubscribed_topics_);
+        lock.unlock();
+        for (const auto& topic : unsubscribed_topics)
+        {
+            auto it = bridged_topics_.find(topic);
+            if (bridged_topics_.end() == it)
             {
-                ++it;
-                ++topic_counter_;
+                continue;
             }
-            else
+
+            /* Delete remote entities, which stops the data flow. */
+            uint16_t datareader_request = uxr_buffer_delete_entity(
+                        &session_,
+                        out_stream_id_,
+                        uxr_object_id(it->second, UXR_DATAREADER_ID));
+            uint16_t topic_request = uxr_buffer_delete_entity(
+                        &session_,
+                        out_stream_id_,
+                        uxr_object_id(it->second, UXR_TOPIC_ID));
+
+            uint8_t status[2];
+            uint16_t request[2] = {datareader_request, topic_request};
+            if (!uxr_run_session_until_all_status(&session_, 1000, request, status, sizeof(status)))
             {
-                it = created_topics.erase(it);
+                std::cerr << "--> ERROR: failed to delete Topic Entities in InternalClient" << std::endl;
             }
-        }
 
-        lock.lock();
-        for (auto& t : topics_)
-        {
-            topics_.erase(t);
+            /* Delete local entities. */
+            Agent::OpResult result;
+            agent_.delete_datawriter(INTERNAL_CLIENT_KEY, it->second, result);
+            agent_.delete_topic(INTERNAL_CLIENT_KEY, it->second, result);
+
+            bridged_topics_.erase(it);
         }
-        lock.unlock();
     }
 }
-
-void InternalClient::loop()
+void InternalClient::spin()
 {
-
-    while (running_cond_)
+    if (running_cond_)
     {
         /* Create domain entities. */
         create_domain_entities();
 
-        /* Create topic entities. */
+        /* Create and delete topic entities following the local interest. */
         create_topic_entities();
+        delete_topic_entities();
 
-        /* Run session. */
-        uxr_run_session_time(&session_, 1000);
+        /* Run session, consuming the queued datagrams and sending the due heartbeats. */
+        uxr_run_session_time(&session_, 0);
     }
 }
 
 void InternalClient::on_new_domain(int16_t domain)
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-    domains_.insert(domain);
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        domains_.insert(domain);
+    }
+    manager_.notify();
 }
 
-void InternalClient::on_new_topic(
+void InternalClient::on_topic_interest(
         int16_t domain_id,
-        const std::string& topic_name)
+        const std::string& topic_name,
+        bool interest)
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-    topics_.emplace(std::make_pair(domain_id, topic_name));
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto topic = std::make_pair(domain_id, topic_name);
+        if (interest)
+        {
+            unsubscribed_topics_.erase(topic);
+            topics_.emplace(std::move(topic));
+        }
+        else if (0 == topics_.erase(topic))
+        {
+            unsubscribed_topics_.emplace(std::move(topic));
+        }
+    }
+    manager_.notify();
 }
 
 } // namespace eprosima
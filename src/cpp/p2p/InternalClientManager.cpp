@@ -14,12 +14,25 @@
 
 #include <uxr/agent/p2p/InternalClientManager.hpp>
 #include <uxr/agent/p2p/InternalClient.hpp>
+#include <uxr/agent/logger/Logger.hpp>
 
-#include <iostream>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
 
 namespace eprosima {
 namespace uxr {
 
+constexpr int InternalClientManager::idle_timeout;
+
 InternalClientManager& InternalClientManager::instance()
 {
     static InternalClientManager manager;
@@ -32,37 +45,296 @@ void InternalClientManager::set_local_address(
     local_client_key_ = port + (uint32_t(0xEA) << 24);
 }
 
-void InternalClientManager::create_client(
+bool InternalClientManager::create_client(
         Agent& agent,
         const std::array<uint8_t, 4>& ip,
         uint16_t port)
 {
+    bool rv = false;
     uint32_t remote_client_key = port + (uint32_t(ip[3]) << 16) + (uint32_t(0xEA) << 24);
     std::lock_guard<std::mutex> lock(mtx_);
     auto it = clients_.find(remote_client_key);
     if (clients_.end() == it)
     {
-        std::unique_ptr<InternalClient>
-                client(new InternalClient(agent, ip, port, remote_client_key, local_client_key_));
-        if (client->run())
+        if (running_cond_ || init())
         {
+            std::unique_ptr<InternalClient>
+                    client(new InternalClient(agent, *this, ip, port, remote_client_key, local_client_key_));
+            pending_clients_.push_back(client.get());
             clients_.emplace(remote_client_key, std::move(client));
+            notify();
+            rv = true;
         }
     }
+    return rv;
 }
 
 void InternalClientManager::delete_clients()
 {
-    std::lock_guard<std::mutex> lock(mtx_);
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (running_cond_)
+    {
+        running_cond_ = false;
+        notify();
+        lock.unlock();
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+        lock.lock();
+    }
+
     for (auto& c : clients_)
     {
         c.second->stop();
     }
     clients_.clear();
+    pending_clients_.clear();
+    running_clients_.clear();
+    peers_.clear();
+    fini();
+}
+
+void InternalClientManager::notify()
+{
+    if (-1 != event_fd_)
+    {
+        uint64_t value = 1;
+        ssize_t rv = ::write(event_fd_, &value, sizeof(value));
+        (void) rv;
+    }
+}
+
+uint16_t InternalClientManager::next_entity_id()
+{
+    return entity_counter_++;
+}
+
+size_t InternalClientManager::send_to(
+        InternalClient& client,
+        const uint8_t* buf,
+        size_t len)
+{
+    size_t rv = 0;
+
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(client.get_port());
+    memcpy(&address.sin_addr, client.get_ip().data(), sizeof(address.sin_addr));
+    ssize_t bytes_sent =
+            sendto(socket_fd_,
+                   buf,
+                   len,
+                   0,
+                   reinterpret_cast<struct sockaddr*>(&address),
+                   sizeof(address));
+    if (0 < bytes_sent)
+    {
+        rv = size_t(bytes_sent);
+    }
+
+    return rv;
 }
 
-InternalClientManager::InternalClientManager() = default;
+size_t InternalClientManager::recv_from(
+        InternalClient& client,
+        uint8_t* buf,
+        size_t len,
+        int timeout)
+{
+    size_t message_len = 0;
+    if (client.pop_message(buf, len, message_len) || (0 >= timeout))
+    {
+        return message_len;
+    }
+
+    /* Blocking read, issued by the session of the client while it waits for a status. */
+    struct pollfd poll_fd{socket_fd_, POLLIN, 0};
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    int remaining = timeout;
+    while (0 < remaining)
+    {
+        if (0 < poll(&poll_fd, 1, remaining) && read_socket(&client, buf, len, message_len))
+        {
+            break;
+        }
+        remaining = int(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now()).count());
+    }
+    return message_len;
+}
+
+InternalClientManager::InternalClientManager()
+    : mtx_{}
+    , local_client_key_{0}
+    , clients_{}
+    , pending_clients_{}
+    , running_clients_{}
+    , peers_{}
+    , entity_counter_{0}
+    , socket_fd_{-1}
+    , epoll_fd_{-1}
+    , event_fd_{-1}
+    , thread_{}
+    , running_cond_{false}
+    , buffer_{}
+{}
+
 InternalClientManager::~InternalClientManager() = default;
 
+bool InternalClientManager::init()
+{
+    bool rv = false;
+
+    socket_fd_ = socket(PF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    epoll_fd_ = epoll_create1(0);
+    event_fd_ = eventfd(0, EFD_NONBLOCK);
+    if ((-1 != socket_fd_) && (-1 != epoll_fd_) && (-1 != event_fd_))
+    {
+        struct epoll_event socket_event{};
+        socket_event.events = EPOLLIN;
+        socket_event.data.fd = socket_fd_;
+        struct epoll_event notify_event{};
+        notify_event.events = EPOLLIN;
+        notify_event.data.fd = event_fd_;
+        if ((0 == epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, socket_fd_, &socket_event))
+            && (0 == epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, event_fd_, &notify_event)))
+        {
+            running_cond_ = true;
+            thread_ = std::thread(&InternalClientManager::loop, this);
+            rv = true;
+        }
+    }
+
+    if (!rv)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("failed to init internal clients loop"),
+            "errno: {}",
+            errno);
+        fini();
+    }
+
+    return rv;
+}
+
+bool InternalClientManager::fini()
+{
+    bool rv = true;
+    for (int* fd : {&socket_fd_, &epoll_fd_, &event_fd_})
+    {
+        if (-1 != *fd)
+        {
+            rv = (0 == ::close(*fd)) && rv;
+            *fd = -1;
+        }
+    }
+    return rv;
+}
+
+void InternalClientManager::loop()
+{
+    struct epoll_event events[2];
+    while (running_cond_)
+    {
+        int nfds = epoll_wait(epoll_fd_, events, 2, idle_timeout);
+        bool socket_ready = false;
+        for (int i = 0; i < nfds; ++i)
+        {
+            if (event_fd_ == events[i].data.fd)
+            {
+                uint64_t value;
+                ssize_t rv = ::read(event_fd_, &value, sizeof(value));
+                (void) rv;
+            }
+            else
+            {
+                socket_ready = true;
+            }
+        }
+
+        if (!running_cond_)
+        {
+            break;
+        }
+
+        start_pending_clients();
+
+        /* Demultiplex every pending datagram into the inbox of its client. */
+        if (socket_ready)
+        {
+            size_t message_len;
+            read_socket(nullptr, nullptr, 0, message_len);
+        }
+
+        for (InternalClient* client : running_clients_)
+        {
+            client->spin();
+        }
+    }
+}
+
+void InternalClientManager::start_pending_clients()
+{
+    std::vector<InternalClient*> pending_clients;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        pending_clients.swap(pending_clients_);
+    }
+
+    for (InternalClient* client : pending_clients)
+    {
+        /* The peer is registered first so that the session handshake can be demultiplexed. */
+        uint64_t id = peer_id(client->get_ip(), client->get_port());
+        peers_[id] = client;
+        if (client->run())
+        {
+            running_clients_.push_back(client);
+        }
+        else
+        {
+            peers_.erase(id);
+        }
+    }
+}
+
+bool InternalClientManager::read_socket(
+        InternalClient* target,
+        uint8_t* buf,
+        size_t len,
+        size_t& message_len)
+{
+    struct sockaddr_in address;
+    socklen_t address_len = sizeof(address);
+    ssize_t bytes_received;
+    while (0 < (bytes_received = recvfrom(socket_fd_, buffer_.data(), buffer_.size(), 0,
+                                        reinterpret_cast<struct sockaddr*>(&address), &address_len)))
+    {
+        std::array<uint8_t, 4> ip;
+        memcpy(ip.data(), &address.sin_addr, ip.size());
+        auto it = peers_.find(peer_id(ip, ntohs(address.sin_port)));
+        if (peers_.end() != it)
+        {
+            if (nullptr != target && target == it->second)
+            {
+                message_len = (std::min)(len, size_t(bytes_received));
+                memmove(buf, buffer_.data(), message_len);
+                return true;
+            }
+            it->second->push_message(buffer_.data(), size_t(bytes_received));
+        }
+        address_len = sizeof(address);
+    }
+    return false;
+}
+
+uint64_t InternalClientManager::peer_id(
+        const std::array<uint8_t, 4>& ip,
+        uint16_t port)
+{
+    return (uint64_t(ip[0]) << 40) | (uint64_t(ip[1]) << 32) | (uint64_t(ip[2]) << 24)
+           | (uint64_t(ip[3]) << 16) | uint64_t(port);
+}
+
 } // namespace uxr
 } // namespace eprosima
@@ -0,0 +1,86 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/processor/InfoReplyCache.hpp>
+
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+
+namespace {
+
+/* Offsets within the INFO payload: request_id[2], object_id[2], status, implementation_status. */
+constexpr size_t request_id_offset = 0;
+constexpr size_t object_id_offset = 2;
+constexpr size_t implementation_status_offset = 5;
+
+} // anonymous namespace
+
+void InfoReplyCache::build(
+        const dds::xrce::ObjectInfo& object_info)
+{
+    dds::xrce::INFO_Payload info_payload;
+    info_payload.object_info(object_info);
+
+    dds::xrce::SubmessageHeader info_subheader;
+    info_subheader.submessage_id(dds::xrce::INFO);
+    info_subheader.flags(dds::xrce::FLAG_LITTLE_ENDIANNESS);
+    info_subheader.submessage_length(uint16_t(info_payload.getCdrSerializedSize()));
+
+    for (size_t i = 0; i < payloads_.size(); ++i)
+    {
+        dds::xrce::MessageHeader header;
+        header.session_id((0 == i) ? dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY : dds::xrce::SESSIONID_NONE_WITH_CLIENT_KEY);
+
+        const size_t payload_offset = header.getCdrSerializedSize() + info_subheader.getCdrSerializedSize();
+        OutputMessage message(header, payload_offset + info_payload.getCdrSerializedSize());
+        payloads_[i].clear();
+        if (message.append_submessage(dds::xrce::INFO, info_payload))
+        {
+            payloads_[i].assign(message.get_buf() + payload_offset, message.get_buf() + message.get_len());
+        }
+    }
+}
+
+bool InfoReplyCache::make_reply(
+        const dds::xrce::MessageHeader& header,
+        const dds::xrce::BaseObjectRequest& request,
+        uint8_t implementation_status,
+        OutputMessagePtr& message) const
+{
+    const std::vector<uint8_t>& payload = payloads_[layout_index(header)];
+    if (payload.empty())
+    {
+        return false;
+    }
+
+    const size_t message_size = header.getCdrSerializedSize() + dds::xrce::SubmessageHeader().getCdrSerializedSize() + payload.size();
+    message = std::make_shared<OutputMessage>(header, message_size);
+    if (!message->append_raw_payload(dds::xrce::INFO, payload.data(), payload.size(), dds::xrce::FLAG_LITTLE_ENDIANNESS))
+    {
+        message.reset();
+        return false;
+    }
+
+    uint8_t* info = message->get_buf() + message->get_len() - payload.size();
+    std::memcpy(info + request_id_offset, request.request_id().data(), request.request_id().size());
+    std::memcpy(info + object_id_offset, request.object_id().data(), request.object_id().size());
+    info[implementation_status_offset] = implementation_status;
+
+    return true;
+}
+
+} // namespace uxr
+} // namespace eprosima
@@ -24,6 +24,7 @@
 #include <uxr/agent/transport/endpoint/IPv4EndPoint.hpp>
 #include <uxr/agent/transport/endpoint/IPv6EndPoint.hpp>
 #include <uxr/agent/transport/endpoint/CanEndPoint.hpp>
+#include <uxr/agent/transport/endpoint/UnixEndPoint.hpp>
 #include <uxr/agent/transport/endpoint/SerialEndPoint.hpp>
 #include <uxr/agent/transport/endpoint/MultiSerialEndPoint.hpp>
 #include <uxr/agent/transport/endpoint/CustomEndPoint.hpp>
@@ -39,18 +40,31 @@ Processor<EndPoint>::Processor(
     : server_(server)
     , middleware_kind_{middleware_kind}
     , root_(root)
-{}
+    , info_cache_{}
+    , info_rate_limiter_{INFO_RATE_LIMIT, INFO_RATE_MAX_SOURCES}
+{
+    build_info_cache({}, info_cache_);
+}
 
 template<typename EndPoint>
 void Processor<EndPoint>::process_input_packet(
         InputPacket<EndPoint>&& input_packet)
 {
+    /* Reuse the classification made on reception instead of parsing the headers again. */
+    const MessageSummary summary = input_packet.message->get_summary();
+    if (!summary.valid)
+    {
+        return;
+    }
+
     dds::xrce::MessageHeader header = input_packet.message->get_header();
 
-    if ((header.session_id() == dds::xrce::SESSIONID_NONE_WITH_CLIENT_KEY) ||
-        (header.session_id() == dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY))
+    if ((summary.session_id == dds::xrce::SESSIONID_NONE_WITH_CLIENT_KEY) ||
+        (summary.session_id == dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY))
     {
-        if (input_packet.message->prepare_next_submessage())
+        if ((dds::xrce::CREATE_CLIENT == summary.first_submessage_id ||
+             dds::xrce::GET_INFO == summary.first_submessage_id) &&
+            input_packet.message->prepare_next_submessage())
         {
             switch (input_packet.message->get_subheader().submessage_id())
             {
@@ -93,10 +107,22 @@ void Processor<EndPoint>::process_input_packet(
 
         if (client)
         {
+#ifdef UAGENT_SNAPSHOT_PROFILE
+            /* A client restored from a snapshot resumes its session without CREATE_CLIENT. */
+            if ((128 > header.session_id()) &&
+                (client->get_session_id() == header.session_id()) &&
+                client->claim_restored_session())
+            {
+                server_.establish_session(
+                    input_packet.source,
+                    conversion::clientkey_to_raw(client_key),
+                    header.session_id());
+            }
+#endif
             client->update_state();
 
             Session& session = client->session();
-            dds::xrce::StreamId stream_id = input_packet.message->get_header().stream_id();
+            dds::xrce::StreamId stream_id = summary.stream_id;
             dds::xrce::SequenceNr sequence_nr = input_packet.message->get_header().sequence_nr();
             session.push_input_message(std::move(input_packet.message), stream_id, sequence_nr);
             while (session.pop_input_message(stream_id, input_packet.message))
@@ -135,7 +161,10 @@ void Processor<EndPoint>::process_input_packet(
         }
         else
         {
-            if (input_packet.message->prepare_next_submessage())
+            /* Only a client deletion or a ping is answered for unknown clients. */
+            if ((dds::xrce::DELETE_ID == summary.first_submessage_id ||
+                 dds::xrce::GET_INFO == summary.first_submessage_id) &&
+                input_packet.message->prepare_next_submessage())
             {
                 switch (input_packet.message->get_subheader().submessage_id())
                 {
@@ -550,18 +579,19 @@ bool Processor<EndPoint>::process_read_data_submessage(
 
             using namespace std::placeholders;
             Reader<bool>::WriteFn write_fn = std::bind(&Processor::read_data_callback, this, _1, _2, _3);
+            Reader<bool>::CreditFn credit_fn = std::bind(&Processor::read_credit_callback, this, _1, _2, _3);
             bool reading = false;
 
             switch (object_id[1] & 0x0F)
             {
                 case dds::xrce::OBJK_DATAREADER:
-                    reading = std::dynamic_pointer_cast<DataReader>(reader_object)->read(read_payload, write_fn, write_args);
+                    reading = std::dynamic_pointer_cast<DataReader>(reader_object)->read(read_payload, write_fn, write_args, credit_fn);
                     break;
                 case dds::xrce::OBJK_REQUESTER:
-                    reading = std::dynamic_pointer_cast<Requester>(reader_object)->read(read_payload, write_fn, write_args);
+                    reading = std::dynamic_pointer_cast<Requester>(reader_object)->read(read_payload, write_fn, write_args, credit_fn);
                     break;
                 case dds::xrce::OBJK_REPLIER:
-                    reading = std::dynamic_pointer_cast<Replier>(reader_object)->read(read_payload, write_fn, write_args);
+                    reading = std::dynamic_pointer_cast<Replier>(reader_object)->read(read_payload, write_fn, write_args, credit_fn);
                     break;
                 default:
                     break;
@@ -769,46 +799,16 @@ bool Processor<EndPoint>::process_get_info_submessage(
     dds::xrce::GET_INFO_Payload get_info_payload;
     input_packet.message->get_payload(get_info_payload);
 
-    dds::xrce::ObjectInfo object_info;
-    dds::xrce::ResultStatus result_status = root_.get_info(object_info);
-    if (dds::xrce::STATUS_OK == result_status.status())
-    {
-        result_status.implementation_status(1);
-
-        dds::xrce::AGENT_ActivityInfo agent_info;
-        agent_info.availability(1);
-
-        dds::xrce::ActivityInfoVariant info_variant;
-        info_variant.agent(agent_info);
-        object_info.activity(info_variant);
-
-        dds::xrce::INFO_Payload info_payload;
-        info_payload.related_request().request_id(get_info_payload.request_id());
-        info_payload.related_request().object_id(get_info_payload.object_id());
-        info_payload.result(result_status);
-        info_payload.object_info(object_info);
-
-        dds::xrce::SubmessageHeader info_subheader;
-        info_subheader.submessage_id(dds::xrce::INFO);
-        info_subheader.flags(dds::xrce::FLAG_LITTLE_ENDIANNESS);
-        info_subheader.submessage_length(uint16_t(info_payload.getCdrSerializedSize()));
-
-        OutputPacket<EndPoint> output_packet;
-        output_packet.destination = input_packet.source;
-
-        dds::xrce::MessageHeader header;
-        header.session_id(client.get_session_id());
-        header.client_key(client.get_client_key());
-
-        const size_t message_size =
-            header.getCdrSerializedSize() +
-            info_subheader.getCdrSerializedSize() +
-            info_payload.getCdrSerializedSize();
-
-        output_packet.message = OutputMessagePtr(new OutputMessage(header, message_size));
-        rv = output_packet.message->append_submessage(dds::xrce::INFO, info_payload);
+    dds::xrce::MessageHeader header;
+    header.session_id(client.get_session_id());
+    header.client_key(client.get_client_key());
 
+    OutputPacket<EndPoint> output_packet;
+    output_packet.destination = input_packet.source;
+    if (info_cache_.make_reply(header, get_info_payload, 1, output_packet.message))
+    {
         server_.push_output_packet(std::move(output_packet));
+        rv = true;
     }
 
     return rv;
@@ -844,6 +844,20 @@ bool Processor<EndPoint>::read_data_callback(
     return rv;
 }
 
+template<typename EndPoint>
+bool Processor<EndPoint>::read_credit_callback(
+        const WriteFnArgs& cb_args,
+        size_t data_size,
+        std::chrono::milliseconds timeout)
+{
+    dds::xrce::DATA_Payload_Data data_payload;
+    data_payload.request_id(cb_args.request_id);
+    data_payload.object_id(cb_args.object_id);
+    const size_t submessage_size = data_payload.getCdrSerializedSize() + data_size;
+
+    return cb_args.client->session().wait_output_credits(cb_args.stream_id, submessage_size, timeout);
+}
+
 template<typename EndPoint>
 bool Processor<EndPoint>::process_get_info_packet(
         InputPacket<EndPoint>&& input_packet,
@@ -851,49 +865,18 @@ bool Processor<EndPoint>::process_get_info_packet(
 {
     bool rv = false;
 
-    dds::xrce::GET_INFO_Payload get_info_payload;
-    input_packet.message->get_payload(get_info_payload);
-
-    dds::xrce::ObjectInfo object_info;
-    dds::xrce::ResultStatus result_status = root_.get_info(object_info);
-    if (dds::xrce::STATUS_OK == result_status.status())
+    if (info_rate_limiter_.allow(input_packet.source))
     {
-        uint32_t raw_client_key;
-        if (server_.get_client_key(input_packet.source, raw_client_key))
-        {
-            result_status.implementation_status(1);
-        }
-        else
+        dds::xrce::GET_INFO_Payload get_info_payload;
+        if (input_packet.message->get_payload(get_info_payload))
         {
-            result_status.implementation_status(0);
-        }
-
-        dds::xrce::AGENT_ActivityInfo agent_info;
-        agent_info.availability(1);
-
-        dds::xrce::ActivityInfoVariant info_variant;
-        info_variant.agent(agent_info);
-        object_info.activity(info_variant);
-
-        dds::xrce::INFO_Payload info_payload;
-        info_payload.related_request().request_id(get_info_payload.request_id());
-        info_payload.related_request().object_id(get_info_payload.object_id());
-        info_payload.result(result_status);
-        info_payload.object_info(object_info);
-
-        dds::xrce::SubmessageHeader info_subheader;
-        info_subheader.submessage_id(dds::xrce::INFO);
-        info_subheader.flags(dds::xrce::FLAG_LITTLE_ENDIANNESS);
-        info_subheader.submessage_length(uint16_t(info_payload.getCdrSerializedSize()));
-
-        const size_t message_size = input_packet.message->get_header().getCdrSerializedSize() +
-                                    info_subheader.getCdrSerializedSize() +
-                                    info_payload.getCdrSerializedSize();
+            uint32_t raw_client_key;
+            uint8_t implementation_status = server_.get_client_key(input_packet.source, raw_client_key) ? 1 : 0;
 
-        output_packet.destination = input_packet.source;
-        output_packet.message = OutputMessagePtr(new OutputMessage(input_packet.message->get_header(),
-                                                                    message_size));
-        rv = output_packet.message->append_submessage(dds::xrce::INFO, info_payload);
+            output_packet.destination = input_packet.source;
+            rv = info_cache_.make_reply(
+                input_packet.message->get_header(), get_info_payload, implementation_status, output_packet.message);
+        }
     }
 
     return rv;
@@ -902,7 +885,7 @@ bool Processor<EndPoint>::process_get_info_packet(
 template<typename EndPoint>
 bool Processor<EndPoint>::process_get_info_packet(
         InputPacket<IPv4EndPoint>&& input_packet,
-        std::vector<dds::xrce::TransportAddress>& address,
+        const InfoReplyCache& info_cache,
         OutputPacket<IPv4EndPoint>& output_packet) const
 {
     bool rv = false;
@@ -912,42 +895,11 @@ bool Processor<EndPoint>::process_get_info_packet(
         if (input_packet.message->get_subheader().submessage_id() == dds::xrce::GET_INFO)
         {
             dds::xrce::GET_INFO_Payload get_info_payload;
-            input_packet.message->get_payload(get_info_payload);
-
-            dds::xrce::ObjectInfo object_info;
-            dds::xrce::ResultStatus result_status = root_.get_info(object_info);
-            if (dds::xrce::STATUS_OK == result_status.status())
+            if (input_packet.message->get_payload(get_info_payload))
             {
-                dds::xrce::AGENT_ActivityInfo agent_info;
-                for (auto &a : address)
-                {
-                    agent_info.address_seq().push_back(a);
-                }
-                agent_info.availability(1);
-
-                dds::xrce::ActivityInfoVariant info_variant;
-                info_variant.agent(agent_info);
-                object_info.activity(info_variant);
-
-                dds::xrce::INFO_Payload info_payload;
-                info_payload.related_request().request_id(get_info_payload.request_id());
-                info_payload.related_request().object_id(get_info_payload.object_id());
-                info_payload.result(result_status);
-                info_payload.object_info(object_info);
-
-                dds::xrce::SubmessageHeader info_subheader;
-                info_subheader.submessage_id(dds::xrce::INFO);
-                info_subheader.flags(dds::xrce::FLAG_LITTLE_ENDIANNESS);
-                info_subheader.submessage_length(uint16_t(info_payload.getCdrSerializedSize()));
-
-                const size_t message_size = input_packet.message->get_header().getCdrSerializedSize() +
-                                            info_subheader.getCdrSerializedSize() +
-                                            info_payload.getCdrSerializedSize();
-
                 output_packet.destination = input_packet.source;
-                output_packet.message = OutputMessagePtr(new OutputMessage(input_packet.message->get_header(),
-                                                                           message_size));
-                rv = output_packet.message->append_submessage(dds::xrce::INFO, info_payload);
+                rv = info_cache.make_reply(
+                    input_packet.message->get_header(), get_info_payload, 0, output_packet.message);
             }
         }
     }
@@ -955,6 +907,51 @@ bool Processor<EndPoint>::process_get_info_packet(
     return rv;
 }
 
+template<typename EndPoint>
+bool Processor<EndPoint>::answer_get_info_packet(
+        InputPacket<EndPoint>& input_packet)
+{
+    const MessageSummary& summary = input_packet.message->get_summary();
+    if (((dds::xrce::SESSIONID_NONE_WITH_CLIENT_KEY != summary.session_id)
+            && (dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY != summary.session_id))
+            || !summary.valid
+            || (dds::xrce::GET_INFO != summary.first_submessage_id))
+    {
+        return false;
+    }
+
+    if (input_packet.message->prepare_next_submessage())
+    {
+        OutputPacket<EndPoint> output_packet;
+        if (process_get_info_packet(std::move(input_packet), output_packet))
+        {
+            server_.push_output_packet(std::move(output_packet));
+        }
+    }
+    return true;
+}
+
+template<typename EndPoint>
+void Processor<EndPoint>::build_info_cache(
+        const std::vector<dds::xrce::TransportAddress>& address,
+        InfoReplyCache& info_cache) const
+{
+    dds::xrce::ObjectInfo object_info;
+    dds::xrce::ResultStatus result_status = root_.get_info(object_info);
+    if (dds::xrce::STATUS_OK == result_status.status())
+    {
+        dds::xrce::AGENT_ActivityInfo agent_info;
+        agent_info.address_seq(address);
+        agent_info.availability(1);
+
+        dds::xrce::ActivityInfoVariant info_variant;
+        info_variant.agent(agent_info);
+        object_info.activity(info_variant);
+
+        info_cache.build(object_info);
+    }
+}
+
 template<typename EndPoint>
 void Processor<EndPoint>::check_heartbeats()
 {
@@ -1044,6 +1041,7 @@ void Processor<EndPoint>::check_heartbeats()
 template class Processor<IPv4EndPoint>;
 template class Processor<IPv6EndPoint>;
 template class Processor<CanEndPoint>;
+template class Processor<UnixEndPoint>;
 template class Processor<SerialEndPoint>;
 template class Processor<MultiSerialEndPoint>;
 template class Processor<CustomEndPoint>;
@@ -141,7 +141,8 @@ bool Replier::write(
 bool Replier::read(
         const dds::xrce::READ_DATA_Payload& read_data,
         Reader<bool>::WriteFn write_fn,
-        WriteFnArgs& write_args)
+        WriteFnArgs& write_args,
+        Reader<bool>::CreditFn credit_fn)
 {
     dds::xrce::DataDeliveryControl delivery_control;
     if (read_data.read_specification().has_delivery_control())
@@ -177,7 +178,7 @@ bool Replier::read(
 
     using namespace std::placeholders;
     return (reader_.stop_reading() &&
-            reader_.start_reading(delivery_control, std::bind(&Replier::read_fn, this, _1, _2, _3), false, write_fn, write_args));
+            reader_.start_reading(delivery_control, std::bind(&Replier::read_fn, this, _1, _2, _3), false, write_fn, write_args, credit_fn));
 }
 
 bool Replier::read_fn(
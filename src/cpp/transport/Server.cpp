@@ -17,15 +17,18 @@
 #include <uxr/agent/processor/Processor.hpp>
 #include <uxr/agent/Root.hpp>
 #include <uxr/agent/logger/Logger.hpp>
+#include <uxr/agent/utils/ThreadSettings.hpp>
 
 #include <uxr/agent/transport/endpoint/IPv4EndPoint.hpp>
 #include <uxr/agent/transport/endpoint/IPv6EndPoint.hpp>
 #include <uxr/agent/transport/endpoint/CanEndPoint.hpp>
+#include <uxr/agent/transport/endpoint/UnixEndPoint.hpp>
 #include <uxr/agent/transport/endpoint/SerialEndPoint.hpp>
 #include <uxr/agent/transport/endpoint/MultiSerialEndPoint.hpp>
 #include <uxr/agent/transport/endpoint/CustomEndPoint.hpp>
 
 #include <functional>
+#include <string>
 
 #define RECEIVE_TIMEOUT 1000   // Milliseconds
 
@@ -35,6 +38,7 @@ namespace uxr {
 extern template class Processor<IPv4EndPoint>;
 extern template class Processor<IPv6EndPoint>;
 extern template class Processor<CanEndPoint>;
+extern template class Processor<UnixEndPoint>;
 extern template class Processor<SerialEndPoint>;
 extern template class Processor<MultiSerialEndPoint>;
 extern template class Processor<CustomEndPoint>;
@@ -44,11 +48,25 @@ Server<EndPoint>::Server(Middleware::Kind middleware_kind)
     : processor_(new Processor<EndPoint>(*this, *root_, middleware_kind))
     , running_cond_(false)
     , input_scheduler_(SERVER_QUEUE_MAX_SIZE)
-    , output_scheduler_(SERVER_QUEUE_MAX_SIZE)
+    , output_scheduler_(SERVER_QUEUE_MAX_SIZE, SERVER_OUTPUT_QUANTUM)
+    , client_weights_mtx_{}
+    , client_weights_{}
+    , ingress_limiter_{0, INGRESS_RATE_MAX_SOURCES}
+    , overload_generation_{0}
     , transport_rc_{TransportRc::ok}
     , error_mtx_{}
     , error_cv_{}
-{}
+#ifdef UAGENT_CAPTURE_PROFILE
+    , capture_mtx_{}
+    , capture_storage_{}
+    , capture_{nullptr}
+#endif
+{
+    output_scheduler_.set_weight_function([this](const EndPoint& endpoint)
+    {
+        return get_output_weight(endpoint);
+    });
+}
 
 template<typename EndPoint>
 Server<EndPoint>::~Server()
@@ -74,11 +92,34 @@ bool Server<EndPoint>::start()
 
     /* Thread initialization. */
     running_cond_ = true;
-    error_handler_thread_ = std::thread(&Server::error_handler_loop, this);
-    receiver_thread_ = std::thread(&Server::receiver_loop, this);
-    sender_thread_ = std::thread(&Server::sender_loop, this);
-    processing_thread_ = std::thread(&Server::processing_loop, this);
-    heartbeat_thread_ = std::thread(&Server::heartbeat_loop, this);
+    error_handler_thread_ = std::thread([this]()
+    {
+        utils::ThreadSettings::apply(utils::ThreadKind::ERROR_HANDLER, "uxr-error");
+        error_handler_loop();
+    });
+    for (size_t i = 0; i < receiver_count(); ++i)
+    {
+        receiver_threads_.emplace_back([this, i]()
+        {
+            utils::ThreadSettings::apply(utils::ThreadKind::RECEIVER, "uxr-receiver-" + std::to_string(i));
+            receiver_loop(i);
+        });
+    }
+    sender_thread_ = std::thread([this]()
+    {
+        utils::ThreadSettings::apply(utils::ThreadKind::SENDER, "uxr-sender");
+        sender_loop();
+    });
+    processing_thread_ = std::thread([this]()
+    {
+        utils::ThreadSettings::apply(utils::ThreadKind::PROCESSING, "uxr-processing");
+        processing_loop();
+    });
+    heartbeat_thread_ = std::thread([this]()
+    {
+        utils::ThreadSettings::apply(utils::ThreadKind::HEARTBEAT, "uxr-heartbeat");
+        heartbeat_loop();
+    });
 
     return true;
 }
@@ -96,10 +137,14 @@ bool Server<EndPoint>::stop()
     error_cv_.notify_all();
 
     /* Join threads. */
-    if (receiver_thread_.joinable())
+    for (auto& receiver_thread : receiver_threads_)
     {
-        receiver_thread_.join();
+        if (receiver_thread.joinable())
+        {
+            receiver_thread.join();
+        }
     }
+    receiver_threads_.clear();
     if (sender_thread_.joinable())
     {
         sender_thread_.join();
@@ -117,6 +162,10 @@ bool Server<EndPoint>::stop()
         error_handler_thread_.join();
     }
 
+#ifdef UAGENT_CAPTURE_PROFILE
+    disable_capture();
+#endif
+
     /* Close servers. */
     bool rv = true;
 #ifdef UAGENT_DISCOVERY_PROFILE
@@ -173,32 +222,229 @@ bool Server<EndPoint>::disable_p2p()
 }
 #endif
 
+#ifdef UAGENT_CAPTURE_PROFILE
+template<typename EndPoint>
+const char* capture_interface_name();
+
+template<>
+const char* capture_interface_name<IPv4EndPoint>()
+{
+    return "IPv4";
+}
+
+template<>
+const char* capture_interface_name<IPv6EndPoint>()
+{
+    return "IPv6";
+}
+
+template<>
+const char* capture_interface_name<CanEndPoint>()
+{
+    return "CAN";
+}
+
+template<>
+const char* capture_interface_name<UnixEndPoint>()
+{
+    return "Unix";
+}
+
+template<>
+const char* capture_interface_name<SerialEndPoint>()
+{
+    return "Serial";
+}
+
+template<>
+const char* capture_interface_name<MultiSerialEndPoint>()
+{
+    return "MultiSerial";
+}
+
+template<>
+const char* capture_interface_name<CustomEndPoint>()
+{
+    return "Custom";
+}
+
+template<typename EndPoint>
+bool Server<EndPoint>::enable_capture(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(capture_mtx_);
+    if (!capture_storage_)
+    {
+        capture_storage_.reset(new PacketCapture());
+    }
+
+    bool rv = capture_storage_->open(path, capture_interface_name<EndPoint>());
+    if (rv)
+    {
+        capture_.store(capture_storage_.get(), std::memory_order_release);
+    }
+    return rv;
+}
+
+template<typename EndPoint>
+bool Server<EndPoint>::disable_capture()
+{
+    // The capture is kept alive, the I/O threads may still hold it.
+    std::lock_guard<std::mutex> lock(capture_mtx_);
+    return capture_storage_ && capture_storage_->close();
+}
+#endif
+
+template<typename EndPoint>
+void Server<EndPoint>::capture_packet(
+        const InputPacket<EndPoint>& input_packet)
+{
+#ifdef UAGENT_CAPTURE_PROFILE
+    PacketCapture* capture = capture_.load(std::memory_order_acquire);
+    if (nullptr != capture && capture->enabled())
+    {
+        capture->capture(
+            PacketCapture::Direction::INBOUND,
+            input_packet.source,
+            input_packet.message->get_buf(),
+            input_packet.message->get_len());
+    }
+#else
+    (void) input_packet;
+#endif
+}
+
+template<typename EndPoint>
+void Server<EndPoint>::capture_packet(
+        const OutputPacket<EndPoint>& output_packet)
+{
+#ifdef UAGENT_CAPTURE_PROFILE
+    PacketCapture* capture = capture_.load(std::memory_order_acquire);
+    if (nullptr != capture && capture->enabled())
+    {
+        capture->capture(
+            PacketCapture::Direction::OUTBOUND,
+            output_packet.destination,
+            output_packet.message->get_buf(),
+            output_packet.message->get_len());
+    }
+#else
+    (void) output_packet;
+#endif
+}
+
 template<typename EndPoint>
 void Server<EndPoint>::push_output_packet(
         OutputPacket<EndPoint>&& output_packet)
 {
     if (output_packet.message)
     {
-        output_scheduler_.push(std::move(output_packet), 0);
+        update_overload_limits();
+
+        /* Over the byte budget, best-effort messages are shed first; reliable and control messages are kept. */
+        const size_t bytes = output_packet.message->get_len();
+        const EndPoint destination = output_packet.destination;
+        const bool sheddable = is_sheddable_stream(output_packet.message->get_stream_id());
+        auto drops = output_scheduler_.push(destination, std::move(output_packet), bytes, sheddable);
+
+        utils::OverloadControl& overload_control = root_->get_overload_control();
+        overload_control.count(utils::ShedDecision::SHED_BEST_EFFORT, drops.sheddable);
+        overload_control.count(utils::ShedDecision::SHED_RELIABLE, drops.others);
+    }
+}
+
+template<typename EndPoint>
+void Server<EndPoint>::update_overload_limits()
+{
+    utils::OverloadControl& overload_control = root_->get_overload_control();
+    const uint32_t generation = overload_control.generation();
+    if (generation != overload_generation_.load(std::memory_order_relaxed))
+    {
+        overload_generation_.store(generation, std::memory_order_relaxed);
+        output_scheduler_.set_max_bytes(overload_control.max_queued_bytes());
+        ingress_limiter_.set_rate(overload_control.max_ingress_rate());
     }
 }
 
 template<typename EndPoint>
-void Server<EndPoint>::receiver_loop()
+void Server<EndPoint>::set_client_weight(
+        uint32_t client_key,
+        uint16_t weight)
 {
+    std::lock_guard<std::mutex> lock(client_weights_mtx_);
+    if (1 < weight)
+    {
+        client_weights_[client_key] = weight;
+    }
+    else
+    {
+        client_weights_.erase(client_key);
+    }
+}
+
+template<typename EndPoint>
+uint16_t Server<EndPoint>::get_output_weight(
+        const EndPoint& endpoint)
+{
+    std::lock_guard<std::mutex> lock(client_weights_mtx_);
+    for (const auto& client_weight : client_weights_)
+    {
+        EndPoint client_endpoint;
+        if (SessionManager<EndPoint>::get_endpoint(client_weight.first, client_endpoint) &&
+            !(client_endpoint < endpoint) && !(endpoint < client_endpoint))
+        {
+            return client_weight.second;
+        }
+    }
+    return 1;
+}
+
+template<typename EndPoint>
+void Server<EndPoint>::dispatch_input_packet(
+        InputPacket<EndPoint>&& input_packet)
+{
+    capture_packet(input_packet);
+
+    if (processor_->answer_get_info_packet(input_packet))
+    {
+        // Out of session pings are answered from the receiver thread.
+        return;
+    }
+
+    /* Lone HEARTBEAT and ACKNACK messages take the priority lane, as classified on reception. */
+    update_overload_limits();
+    utils::OverloadControl& overload_control = root_->get_overload_control();
+    const MessageSummary& summary = input_packet.message->get_summary();
+    if (summary.is_only(dds::xrce::HEARTBEAT) || summary.is_only(dds::xrce::ACKNACK))
+    {
+        if (!input_scheduler_.push(std::move(input_packet), 1))
+        {
+            overload_control.count(utils::ShedDecision::DROPPED_INPUT);
+        }
+    }
+    else if (!ingress_limiter_.allow(input_packet.source) && !is_reliable_stream(summary.stream_id))
+    {
+        /* Over the ingress rate only best-effort messages are shed, reliable ones are paced by their window. */
+        overload_control.count(utils::ShedDecision::SHED_INGRESS);
+    }
+    else if (!input_scheduler_.push(std::move(input_packet), 0))
+    {
+        overload_control.count(utils::ShedDecision::DROPPED_INPUT);
+    }
+}
+
+template<typename EndPoint>
+void Server<EndPoint>::receiver_loop(
+        size_t receiver)
+{
+    init_receiver(receiver);
+
     InputPacket<EndPoint> input_packet{};
     while (running_cond_)
     {
         TransportRc transport_rc = TransportRc::ok;
-        if (recv_message(input_packet, RECEIVE_TIMEOUT, transport_rc))
+        if (recv_message(input_packet, RECEIVE_TIMEOUT, transport_rc, receiver))
         {
-            if(input_packet.message->is_valid_xrce_message() && 1U == input_packet.message->count_submessages() && dds::xrce::HEARTBEAT == input_packet.message->get_submessage_id()){
-                input_scheduler_.push(std::move(input_packet), 1);
-            }
-            else
-            {
-                input_scheduler_.push(std::move(input_packet), 0);
-            }
+            dispatch_input_packet(std::move(input_packet));
         }
         else if(running_cond_)
         {
@@ -211,10 +457,13 @@ void Server<EndPoint>::receiver_loop()
             }
         }
     }
+
+    fini_receiver(receiver);
 }
 
 template<>
-void Server<MultiSerialEndPoint>::receiver_loop()
+void Server<MultiSerialEndPoint>::receiver_loop(
+        size_t /* receiver */)
 {
     std::vector<InputPacket<MultiSerialEndPoint>> input_packet;
 
@@ -225,7 +474,7 @@ void Server<MultiSerialEndPoint>::receiver_loop()
         {
             for (auto & element : input_packet)
             {
-                input_scheduler_.push(std::move(element), 0);
+                dispatch_input_packet(std::move(element));
             }
         }
         else if(running_cond_)
@@ -246,27 +495,126 @@ void Server<MultiSerialEndPoint>::receiver_loop()
 template<typename EndPoint>
 void Server<EndPoint>::sender_loop()
 {
+    if (sends_batches())
+    {
+        batch_sender_loop();
+        return;
+    }
+
     OutputPacket<EndPoint> output_packet{};
     while (running_cond_)
     {
         if (output_scheduler_.pop(output_packet))
         {
             TransportRc transport_rc = TransportRc::ok;
-            if (!send_message(output_packet, transport_rc))
+            if (send_message(output_packet, transport_rc))
+            {
+                capture_packet(output_packet);
+            }
+            else
+            {
+                if (TransportRc::server_error == transport_rc && running_cond_)
+                {
+                    std::unique_lock<std::mutex> lock(error_mtx_);
+                    transport_rc_ = transport_rc;
+                    const size_t bytes = output_packet.message->get_len();
+                    const EndPoint destination = output_packet.destination;
+                    const bool sheddable = is_sheddable_stream(output_packet.message->get_stream_id());
+                    output_scheduler_.push_front(destination, std::move(output_packet), bytes, sheddable);
+                    error_cv_.notify_one();
+                    error_cv_.wait(lock);
+                }
+            }
+        }
+    }
+}
+
+template<typename EndPoint>
+void Server<EndPoint>::batch_sender_loop()
+{
+    std::vector<OutputPacket<EndPoint>> output_packets;
+#ifdef UAGENT_CAPTURE_PROFILE
+    std::vector<OutputPacket<EndPoint>> sending_packets;
+#endif
+
+    while (running_cond_)
+    {
+        if (output_scheduler_.pop(output_packets, SERVER_BATCH_SIZE))
+        {
+#ifdef UAGENT_CAPTURE_PROFILE
+            // The sent packets leave the batch, so they are kept aside to be captured once sent.
+            if (nullptr != capture_.load(std::memory_order_acquire))
+            {
+                sending_packets.assign(output_packets.begin(), output_packets.end());
+            }
+#endif
+
+            TransportRc transport_rc = TransportRc::ok;
+            const bool sent_all = send_message(output_packets, transport_rc);
+
+#ifdef UAGENT_CAPTURE_PROFILE
+            const size_t sent = sending_packets.empty() ? 0 : (sending_packets.size() - output_packets.size());
+            for (size_t i = 0; i < sent; ++i)
             {
+                capture_packet(sending_packets[i]);
+            }
+            sending_packets.clear();
+#endif
+
+            if (!sent_all)
+            {
+                // Unsent packets are left in output_packets, and only a server error keeps them.
                 if (TransportRc::server_error == transport_rc && running_cond_)
                 {
                     std::unique_lock<std::mutex> lock(error_mtx_);
                     transport_rc_ = transport_rc;
-                    output_scheduler_.push_front(std::move(output_packet), 0);
+                    for (auto it = output_packets.rbegin(); it != output_packets.rend(); ++it)
+                    {
+                        const size_t bytes = it->message->get_len();
+                        const EndPoint destination = it->destination;
+                        const bool sheddable = is_sheddable_stream(it->message->get_stream_id());
+                        output_scheduler_.push_front(destination, std::move(*it), bytes, sheddable);
+                    }
                     error_cv_.notify_one();
                     error_cv_.wait(lock);
                 }
             }
+            output_packets.clear();
         }
     }
 }
 
+template<>
+void Server<CustomEndPoint>::receiver_loop(
+        size_t /* receiver */)
+{
+    std::vector<InputPacket<CustomEndPoint>> input_packets;
+
+    while (running_cond_)
+    {
+        TransportRc transport_rc = TransportRc::ok;
+        if (recv_message(input_packets, RECEIVE_TIMEOUT, transport_rc))
+        {
+            for (auto& input_packet : input_packets)
+            {
+                dispatch_input_packet(std::move(input_packet));
+            }
+        }
+        else if(running_cond_)
+        {
+            if (TransportRc::server_error == transport_rc)
+            {
+                std::unique_lock<std::mutex> lock(error_mtx_);
+                transport_rc_ = transport_rc;
+                error_cv_.notify_one();
+                error_cv_.wait(lock);
+            }
+        }
+
+        input_packets.clear();
+    }
+}
+
 template<typename EndPoint>
 void Server<EndPoint>::processing_loop()
 {
@@ -314,6 +662,7 @@ void Server<EndPoint>::error_handler_loop()
 template class Server<IPv4EndPoint>;
 template class Server<IPv6EndPoint>;
 template class Server<CanEndPoint>;
+template class Server<UnixEndPoint>;
 template class Server<SerialEndPoint>;
 template class Server<MultiSerialEndPoint>;
 template class Server<CustomEndPoint>;
@@ -17,6 +17,9 @@
 #include <uxr/agent/logger/Logger.hpp>
 
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 #include <net/if.h>
 #include <sys/ioctl.h>
@@ -27,14 +30,31 @@
 namespace eprosima {
 namespace uxr {
 
+constexpr size_t CanAgent::max_rx_frames;
+constexpr int CanAgent::tx_timeout;
+
 CanAgent::CanAgent(
         char const* dev,
         uint32_t can_id,
-        Middleware::Kind middleware_kind)
+        Middleware::Kind middleware_kind,
+        uint32_t can_mask)
     : Server<CanEndPoint>{middleware_kind}
     , dev_{dev}
     , can_id_{can_id}
+    , can_mask_{can_mask}
+    , rx_frames_{}
+    , rx_iovecs_{}
+    , rx_msgs_{}
+    , rx_count_{0}
+    , rx_index_{0}
 {
+    for (size_t i = 0; i < max_rx_frames; ++i)
+    {
+        rx_iovecs_[i].iov_base = &rx_frames_[i];
+        rx_iovecs_[i].iov_len = sizeof(struct canfd_frame);
+        rx_msgs_[i].msg_hdr.msg_iov = &rx_iovecs_[i];
+        rx_msgs_[i].msg_hdr.msg_iovlen = 1;
+    }
 }
 
 CanAgent::~CanAgent()
@@ -76,27 +96,40 @@ bool CanAgent::init()
                 reinterpret_cast<struct sockaddr*>(&address),
                 sizeof(address)))
         {
+            // Only accept extended data frames within the agent's CAN ID range
+            struct can_filter filter {};
+            filter.can_id = (can_id_ & can_mask_ & CAN_EFF_MASK) | CAN_EFF_FLAG;
+            filter.can_mask = (can_mask_ & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+
             // Enable CAN FD
-            if (-1 != setsockopt(poll_fd_.fd, SOL_CAN_RAW, CAN_RAW_FD_FRAMES,
+            if (-1 == setsockopt(poll_fd_.fd, SOL_CAN_RAW, CAN_RAW_FD_FRAMES,
                     &enable_canfd, sizeof(enable_canfd)))
+            {
+                UXR_AGENT_LOG_ERROR(
+                    UXR_DECORATE_RED("Enable CAN FD failed"),
+                    "device: {},errno: {}",
+                    dev_, errno);
+            }
+            else if (-1 == setsockopt(poll_fd_.fd, SOL_CAN_RAW, CAN_RAW_FILTER,
+                    &filter, sizeof(filter)))
+            {
+                UXR_AGENT_LOG_ERROR(
+                    UXR_DECORATE_RED("CAN filter setup failed"),
+                    "device: {}, errno: {}",
+                    dev_, errno);
+            }
+            else
             {
                 poll_fd_.events = POLLIN;
+                segmentation_.reset();
+                rx_count_ = 0;
+                rx_index_ = 0;
                 rv = true;
 
                 UXR_AGENT_LOG_INFO(
                     UXR_DECORATE_GREEN("running..."),
-                    "device: {}, fd: {}",
-                    dev_, poll_fd_.fd);
-
-
-                // TODO: add filter for micro-ROS devices
-            }
-            else
-            {
-                UXR_AGENT_LOG_ERROR(
-                    UXR_DECORATE_RED("Enable CAN FD failed"),
-                    "device: {},errno: {}",
-                    dev_, errno);
+                    "device: {}, fd: {}, id: 0x{:08X}, mask: 0x{:08X}",
+                    dev_, poll_fd_.fd, can_id_, can_mask_);
             }
         }
         else
@@ -152,25 +185,49 @@ bool CanAgent::recv_message(
         TransportRc& transport_rc)
 {
     bool rv = false;
-    struct canfd_frame frame = {};
 
-    int poll_rv = poll(&poll_fd_, 1, timeout);
-
-    if (0 < poll_rv)
+    if (rx_index_ == rx_count_)
     {
-        if (0 < read(poll_fd_.fd, &frame, sizeof(struct canfd_frame)))
-        {
-            // Omit EFF, RTR, ERR flags (Assume EFF on CAN FD)
-            uint32_t can_id = frame.can_id & CAN_ERR_MASK;
-            size_t len = frame.data[0];   // XRCE payload lenght
+        rx_count_ = 0;
+        rx_index_ = 0;
 
-            if (len > (CANFD_MTU - 1))
+        int poll_rv = poll(&poll_fd_, 1, timeout);
+        if (0 < poll_rv)
+        {
+            // Drain as many frames as available in a single system call
+            int recv_rv = recvmmsg(poll_fd_.fd, rx_msgs_.data(), max_rx_frames, MSG_DONTWAIT, nullptr);
+            if (0 < recv_rv)
+            {
+                rx_count_ = static_cast<size_t>(recv_rv);
+            }
+            else if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
             {
-                // Overflow MTU (63 bytes)
-                return false;
+                transport_rc = TransportRc::timeout_error;
             }
+            else
+            {
+                transport_rc = TransportRc::server_error;
+            }
+        }
+        else
+        {
+            transport_rc = (poll_rv == 0) ? TransportRc::timeout_error : TransportRc::server_error;
+        }
+    }
 
-            input_packet.message.reset(new InputMessage(&frame.data[1], len));
+    while (!rv && (rx_index_ < rx_count_))
+    {
+        const struct canfd_frame& frame = rx_frames_[rx_index_++];
+
+        // Omit EFF, RTR, ERR flags (Assume EFF on CAN FD)
+        uint32_t can_id = frame.can_id & CAN_ERR_MASK;
+        size_t frame_len = std::min<size_t>(frame.len, CANFD_MAX_DLEN);
+
+        const uint8_t* message = nullptr;
+        size_t len = 0;
+        if (segmentation_.reassemble(can_id, frame.data, frame_len, message, len))
+        {
+            input_packet.message.reset(new InputMessage(const_cast<uint8_t*>(message), len));
             input_packet.source = CanEndPoint(can_id);
             rv = true;
 
@@ -184,14 +241,6 @@ bool CanAgent::recv_message(
                     input_packet.message->get_len());
             }
         }
-        else
-        {
-            transport_rc = TransportRc::server_error;
-        }
-    }
-    else
-    {
-        transport_rc = (poll_rv == 0) ? TransportRc::timeout_error : TransportRc::server_error;
     }
 
     return rv;
@@ -201,53 +250,90 @@ bool CanAgent::send_message(
         OutputPacket<CanEndPoint> output_packet,
         TransportRc& transport_rc)
 {
-    bool rv = false;
-    struct canfd_frame frame = {};
-    struct pollfd poll_fd_write_;
     size_t packet_len = output_packet.message->get_len();
 
-    if (packet_len > (CANFD_MTU - 1))
+    if (!CanSegmentation::segment(output_packet.message->get_buf(), packet_len, tx_segments_))
     {
-        // Overflow MTU (63 bytes)
-        return 0;
+        // Overflow maximum segmented message size
+        return false;
     }
 
-    poll_fd_write_.fd = poll_fd_.fd;
-    poll_fd_write_.events = POLLOUT;
-    int poll_rv = poll(&poll_fd_write_, 1, 0);
+    const size_t frames_len = tx_segments_.size();
+    tx_frames_.resize(frames_len);
+    tx_iovecs_.resize(frames_len);
+    tx_msgs_.resize(frames_len);
 
-    if (0 < poll_rv)
+    for (size_t i = 0; i < frames_len; ++i)
     {
+        struct canfd_frame& frame = tx_frames_[i];
         frame.can_id = output_packet.destination.get_can_id() | CAN_EFF_FLAG;
-        frame.data[0] = (uint8_t) packet_len;   // XRCE payload lenght
-        frame.len = (uint8_t) (packet_len + 1);   // CAN frame DLC
+        frame.len = tx_segments_[i].len;   // CAN frame DLC
+        frame.flags = 0;
+        memcpy(frame.data, tx_segments_[i].data.data(), frame.len);
+
+        tx_iovecs_[i].iov_base = &frame;
+        tx_iovecs_[i].iov_len = sizeof(struct canfd_frame);
+        tx_msgs_[i] = {};
+        tx_msgs_[i].msg_hdr.msg_iov = &tx_iovecs_[i];
+        tx_msgs_[i].msg_hdr.msg_iovlen = 1;
+    }
 
-        memcpy(&frame.data[1], output_packet.message->get_buf(), packet_len);
+    // Block while the device queue is full instead of dropping, up to tx_timeout
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(tx_timeout);
+    size_t sent = 0;
+    while (sent < frames_len)
+    {
+        int send_rv = sendmmsg(poll_fd_.fd, &tx_msgs_[sent], static_cast<unsigned int>(frames_len - sent), MSG_DONTWAIT);
+        if (0 < send_rv)
+        {
+            sent += static_cast<size_t>(send_rv);
+            continue;
+        }
 
-        if (0 < ::write(poll_fd_.fd, &frame, sizeof(struct canfd_frame)))
+        if ((EAGAIN != errno) && (EWOULDBLOCK != errno) && (ENOBUFS != errno))
         {
-            rv = true;
+            // Write failed
+            transport_rc = TransportRc::server_error;
+            break;
+        }
 
-            uint32_t raw_client_key;
-            if (Server<CanEndPoint>::get_client_key(output_packet.destination, raw_client_key))
-            {
-                UXR_AGENT_LOG_MESSAGE(
-                    UXR_DECORATE_YELLOW("[** <<CAN>> **]"),
-                    raw_client_key,
-                    output_packet.message->get_buf(),
-                    packet_len);
-            }
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (0 >= remaining)
+        {
+            // Can device is busy
+            transport_rc = TransportRc::timeout_error;
+            break;
+        }
+
+        if (ENOBUFS == errno)
+        {
+            // The interface queue is full but the socket reports writable, back off briefly
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
         else
         {
-            // Write failed
-            transport_rc = TransportRc::server_error;
+            struct pollfd poll_fd_write{poll_fd_.fd, POLLOUT, 0};
+            if (0 > poll(&poll_fd_write, 1, static_cast<int>(remaining)))
+            {
+                transport_rc = TransportRc::server_error;
+                break;
+            }
         }
     }
-    else
+
+    bool rv = (sent == frames_len);
+    if (rv)
     {
-        // Can device is busy
-        transport_rc = TransportRc::server_error;
+        uint32_t raw_client_key;
+        if (Server<CanEndPoint>::get_client_key(output_packet.destination, raw_client_key))
+        {
+            UXR_AGENT_LOG_MESSAGE(
+                UXR_DECORATE_YELLOW("[** <<CAN>> **]"),
+                raw_client_key,
+                output_packet.message->get_buf(),
+                packet_len);
+        }
     }
 
     return rv;
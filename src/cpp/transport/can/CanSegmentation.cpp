@@ -0,0 +1,171 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/can/CanSegmentation.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+
+constexpr size_t CanSegmentation::frame_data_size;
+constexpr size_t CanSegmentation::single_frame_max_payload;
+constexpr size_t CanSegmentation::first_frame_payload;
+constexpr size_t CanSegmentation::consecutive_frame_payload;
+constexpr size_t CanSegmentation::max_message_size;
+
+bool CanSegmentation::segment(
+        const uint8_t* buf,
+        size_t len,
+        std::vector<Frame>& frames)
+{
+    frames.clear();
+
+    if (len <= single_frame_max_payload)
+    {
+        Frame frame{};
+        frame.data[0] = static_cast<uint8_t>(pci_single_frame | len);
+        std::memcpy(&frame.data[1], buf, len);
+        frame.len = static_cast<uint8_t>(len + 1);
+        frames.push_back(frame);
+        return true;
+    }
+
+    if (len > max_message_size)
+    {
+        return false;
+    }
+
+    frames.reserve(1 + (len - first_frame_payload + consecutive_frame_payload - 1) / consecutive_frame_payload);
+
+    Frame first_frame{};
+    first_frame.data[0] = pci_first_frame;
+    first_frame.data[1] = static_cast<uint8_t>(len >> 8);
+    first_frame.data[2] = static_cast<uint8_t>(len & 0xFF);
+    std::memcpy(&first_frame.data[3], buf, first_frame_payload);
+    first_frame.len = static_cast<uint8_t>(frame_data_size);
+    frames.push_back(first_frame);
+
+    size_t offset = first_frame_payload;
+    uint8_t sequence = 1;
+    while (offset < len)
+    {
+        const size_t chunk = std::min(consecutive_frame_payload, len - offset);
+        Frame frame{};
+        frame.data[0] = static_cast<uint8_t>(pci_consecutive_frame | (sequence & pci_value_mask));
+        std::memcpy(&frame.data[1], buf + offset, chunk);
+        frame.len = static_cast<uint8_t>(chunk + 1);
+        frames.push_back(frame);
+
+        offset += chunk;
+        ++sequence;
+    }
+
+    return true;
+}
+
+bool CanSegmentation::reassemble(
+        uint32_t can_id,
+        const uint8_t* data,
+        size_t len,
+        const uint8_t*& message,
+        size_t& message_len)
+{
+    if (0 == len)
+    {
+        return false;
+    }
+
+    const uint8_t pci = data[0];
+    switch (pci & pci_type_mask)
+    {
+        case pci_single_frame:
+        {
+            /* A single frame aborts any ongoing reassembly from the same CAN ID. */
+            reassembly_.erase(can_id);
+
+            const size_t payload_len = pci & pci_value_mask;
+            if (payload_len > len - 1)
+            {
+                return false;
+            }
+            message = &data[1];
+            message_len = payload_len;
+            return true;
+        }
+        case pci_first_frame:
+        {
+            if (len < frame_data_size)
+            {
+                reassembly_.erase(can_id);
+                return false;
+            }
+
+            const size_t total_len = (static_cast<size_t>(data[1]) << 8) | data[2];
+            if (total_len <= single_frame_max_payload)
+            {
+                reassembly_.erase(can_id);
+                return false;
+            }
+
+            Reassembly& reassembly = reassembly_[can_id];
+            reassembly.buffer.reserve(total_len);
+            reassembly.buffer.assign(&data[3], &data[3] + first_frame_payload);
+            reassembly.expected_len = total_len;
+            reassembly.next_sequence = 1;
+            return false;
+        }
+        case pci_consecutive_frame:
+        {
+            auto it = reassembly_.find(can_id);
+            if (it == reassembly_.end())
+            {
+                return false;
+            }
+
+            Reassembly& reassembly = it->second;
+            if ((pci & pci_value_mask) != (reassembly.next_sequence & pci_value_mask))
+            {
+                /* Lost frame, the whole message is discarded. */
+                reassembly_.erase(it);
+                return false;
+            }
+
+            const size_t chunk = std::min(
+                std::min(consecutive_frame_payload, len - 1),
+                reassembly.expected_len - reassembly.buffer.size());
+            reassembly.buffer.insert(reassembly.buffer.end(), &data[1], &data[1] + chunk);
+            ++reassembly.next_sequence;
+
+            if (reassembly.buffer.size() == reassembly.expected_len)
+            {
+                /* Keep the buffer alive until the next call, so the message can be read in place. */
+                completed_.swap(reassembly.buffer);
+                reassembly_.erase(it);
+                message = completed_.data();
+                message_len = completed_.size();
+                return true;
+            }
+            return false;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+} // namespace uxr
+} // namespace eprosima
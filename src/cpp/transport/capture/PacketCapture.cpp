@@ -0,0 +1,360 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/capture/PacketCapture.hpp>
+#include <uxr/agent/transport/endpoint/CustomEndPoint.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <functional>
+
+namespace eprosima {
+namespace uxr {
+
+static_assert((CAPTURE_QUEUE_SIZE & (CAPTURE_QUEUE_SIZE - 1)) == 0,
+        "CAPTURE_QUEUE_SIZE shall be a power of two.");
+
+constexpr uint16_t PacketCapture::link_type;
+constexpr size_t PacketCapture::endpoint_size;
+
+namespace {
+
+/* pcapng block types and option codes. */
+const uint32_t section_header_block = 0x0A0D0D0A;
+const uint32_t interface_description_block = 0x00000001;
+const uint32_t enhanced_packet_block = 0x00000006;
+const uint32_t byte_order_magic = 0x1A2B3C4D;
+const uint16_t opt_endofopt = 0;
+const uint16_t opt_comment = 1;
+const uint16_t shb_userappl = 4;
+const uint16_t if_name = 2;
+const uint16_t if_tsresol = 9;
+const uint16_t epb_flags = 2;
+
+/* Blocks are written in host byte order, as announced by the byte-order magic. */
+template<typename T>
+void put(
+        std::string& block,
+        T value)
+{
+    block.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void pad(
+        std::string& block)
+{
+    block.append((4 - (block.size() % 4)) % 4, '\0');
+}
+
+void put_option(
+        std::string& block,
+        uint16_t code,
+        const void* value,
+        size_t len)
+{
+    put<uint16_t>(block, code);
+    put<uint16_t>(block, uint16_t(len));
+    block.append(reinterpret_cast<const char*>(value), len);
+    pad(block);
+}
+
+void begin_block(
+        std::string& block,
+        uint32_t type)
+{
+    block.clear();
+    put<uint32_t>(block, type);
+    put<uint32_t>(block, 0); // Total length, patched by end_block.
+}
+
+void end_block(
+        std::string& block)
+{
+    put<uint16_t>(block, opt_endofopt);
+    put<uint16_t>(block, 0);
+    uint32_t total_len = uint32_t(block.size() + sizeof(uint32_t));
+    std::memcpy(&block[sizeof(uint32_t)], &total_len, sizeof(total_len));
+    put<uint32_t>(block, total_len);
+}
+
+} // namespace
+
+PacketCapture::PacketCapture()
+    : queue_(CAPTURE_QUEUE_SIZE)
+    , dropped_{0}
+    , enabled_{false}
+    , path_{}
+    , interface_name_{}
+    , file_size_{0}
+    , max_files_{0}
+    , file_index_{0}
+    , fd_{-1}
+    , map_{nullptr}
+    , offset_{0}
+    , block_{}
+    , endpoint_{}
+    , mtx_{}
+    , thread_{}
+    , running_cond_{false}
+{}
+
+PacketCapture::~PacketCapture()
+{
+    close();
+}
+
+bool PacketCapture::open(
+        const std::string& path,
+        const std::string& interface_name,
+        size_t file_size,
+        size_t max_files)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (running_cond_)
+    {
+        return false;
+    }
+
+    path_ = path;
+    interface_name_ = interface_name;
+    file_size_ = file_size;
+    max_files_ = max_files;
+    file_index_ = 0;
+    if (!open_file())
+    {
+        return false;
+    }
+
+    UXR_AGENT_LOG_INFO(
+        UXR_DECORATE_GREEN("capture started"),
+        "path: {}, interface: {}",
+        path_, interface_name_);
+
+    running_cond_ = true;
+    thread_ = std::thread(&PacketCapture::loop, this);
+    enabled_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+bool PacketCapture::close()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    enabled_.store(false, std::memory_order_relaxed);
+    running_cond_ = false;
+    if (!thread_.joinable())
+    {
+        return false;
+    }
+
+    thread_.join();
+    return close_file();
+}
+
+void PacketCapture::loop()
+{
+    while (running_cond_)
+    {
+        if (0 == flush())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    flush();
+}
+
+size_t PacketCapture::flush()
+{
+    size_t count = 0;
+    while (queue_.try_pop([this](Record& record){ write(record); }))
+    {
+        ++count;
+    }
+    return count;
+}
+
+void PacketCapture::write(
+        const Record& record)
+{
+    record.format(record, endpoint_);
+
+    uint64_t timestamp = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                record.timestamp.time_since_epoch()).count());
+    begin_block(block_, enhanced_packet_block);
+    put<uint32_t>(block_, 0); // Interface ID.
+    put<uint32_t>(block_, uint32_t(timestamp >> 32));
+    put<uint32_t>(block_, uint32_t(timestamp));
+    put<uint32_t>(block_, uint32_t(record.captured_len));
+    put<uint32_t>(block_, uint32_t(record.len));
+    block_.append(reinterpret_cast<const char*>(record.data.data()), record.captured_len);
+    pad(block_);
+    uint32_t flags = uint32_t(record.direction);
+    put_option(block_, epb_flags, &flags, sizeof(flags));
+    put_option(block_, opt_comment, endpoint_.data(), endpoint_.size());
+    end_block(block_);
+
+    if (!append(reinterpret_cast<const uint8_t*>(block_.data()), block_.size()))
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool PacketCapture::open_file()
+{
+    std::string path = path_;
+    std::string index = "-" + std::to_string(file_index_);
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of('/');
+    if ((std::string::npos != dot) && ((std::string::npos == slash) || (dot > slash)))
+    {
+        path.insert(dot, index);
+    }
+    else
+    {
+        path += index;
+    }
+
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (-1 == fd_ || 0 != ftruncate(fd_, off_t(file_size_)))
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("capture open error"),
+            "path: {}, errno: {}",
+            path, errno);
+        if (-1 != fd_)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        return false;
+    }
+
+    void* map = mmap(nullptr, file_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (MAP_FAILED == map)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("capture mmap error"),
+            "path: {}, errno: {}",
+            path, errno);
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    map_ = static_cast<uint8_t*>(map);
+    offset_ = 0;
+
+    /* Remove the oldest file. */
+    if ((0 != max_files_) && (file_index_ >= max_files_))
+    {
+        std::string old_path = path;
+        std::string old_index = "-" + std::to_string(file_index_ - max_files_);
+        old_path.replace(old_path.rfind(index), index.size(), old_index);
+        std::remove(old_path.c_str());
+    }
+
+    write_header();
+    return true;
+}
+
+bool PacketCapture::close_file()
+{
+    bool rv = true;
+    if (nullptr != map_)
+    {
+        rv = (0 == munmap(map_, file_size_));
+        map_ = nullptr;
+    }
+    if (-1 != fd_)
+    {
+        /* Drop the unused tail of the mapping. */
+        rv = (0 == ftruncate(fd_, off_t(offset_))) && rv;
+        rv = (0 == ::close(fd_)) && rv;
+        fd_ = -1;
+    }
+    offset_ = 0;
+    return rv;
+}
+
+bool PacketCapture::append(
+        const uint8_t* buf,
+        size_t len)
+{
+    if (nullptr == map_)
+    {
+        return false;
+    }
+
+    if ((offset_ + len) > file_size_)
+    {
+        ++file_index_;
+        if (!close_file() || !open_file() || ((offset_ + len) > file_size_))
+        {
+            return false;
+        }
+    }
+    std::memcpy(map_ + offset_, buf, len);
+    offset_ += len;
+    return true;
+}
+
+void PacketCapture::write_header()
+{
+    static const char application[] = "Micro XRCE-DDS Agent";
+
+    begin_block(block_, section_header_block);
+    put<uint32_t>(block_, byte_order_magic);
+    put<uint16_t>(block_, 1); // Major version.
+    put<uint16_t>(block_, 0); // Minor version.
+    put<int64_t>(block_, -1); // Section length not specified.
+    put_option(block_, shb_userappl, application, sizeof(application) - 1);
+    end_block(block_);
+    append(reinterpret_cast<const uint8_t*>(block_.data()), block_.size());
+
+    begin_block(block_, interface_description_block);
+    put<uint16_t>(block_, link_type);
+    put<uint16_t>(block_, 0); // Reserved.
+    put<uint32_t>(block_, uint32_t(CAPTURE_SNAPLEN));
+    put_option(block_, if_name, interface_name_.data(), interface_name_.size());
+    uint8_t tsresol = 9; // Nanoseconds.
+    put_option(block_, if_tsresol, &tsresol, sizeof(tsresol));
+    end_block(block_);
+    append(reinterpret_cast<const uint8_t*>(block_.data()), block_.size());
+}
+
+void PacketCapture::EndPointFormatter<CustomEndPoint>::store(
+        const CustomEndPoint& endpoint,
+        Record& record)
+{
+    size_t hash = std::hash<CustomEndPoint>()(endpoint);
+    std::memcpy(&record.endpoint, &hash, sizeof(hash));
+    record.format = &format;
+}
+
+void PacketCapture::EndPointFormatter<CustomEndPoint>::format(
+        const Record& record,
+        std::string& output)
+{
+    size_t hash;
+    std::memcpy(&hash, &record.endpoint, sizeof(hash));
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "hash: 0x%016zX", hash);
+    output = buf;
+}
+
+} // namespace uxr
+} // namespace eprosima
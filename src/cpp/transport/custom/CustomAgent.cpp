@@ -14,6 +14,7 @@
 
 #include <uxr/agent/transport/custom/CustomAgent.hpp>
 
+#include <algorithm>
 #include <functional>
 
 namespace eprosima {
@@ -55,14 +56,35 @@ CustomAgent::CustomAgent(
         FiniFunction& fini_function,
         SendMsgFunction& send_msg_function,
         RecvMsgFunction& recv_msg_function)
+    : CustomAgent(name, endpoint, middleware_kind, framing,
+        init_function, fini_function, send_msg_function, recv_msg_function,
+        SendMsgsFunction(), RecvMsgsFunction())
+{
+}
+
+CustomAgent::CustomAgent(
+        const std::string& name,
+        CustomEndPoint* endpoint,
+        Middleware::Kind middleware_kind,
+        bool framing,
+        InitFunction& init_function,
+        FiniFunction& fini_function,
+        SendMsgFunction& send_msg_function,
+        RecvMsgFunction& recv_msg_function,
+        SendMsgsFunction send_msgs_function,
+        RecvMsgsFunction recv_msgs_function)
     : Server<CustomEndPoint>(middleware_kind)
     , name_(name)
+    , recv_label_(UXR_COLOR_YELLOW "[==>> " + name + " <<==]" UXR_COLOR_RESET)
+    , send_label_(UXR_COLOR_YELLOW "[** <<" + name + ">> **]" UXR_COLOR_RESET)
     , recv_endpoint_(endpoint)
     , send_endpoint_(nullptr)
     , custom_init_func_(init_function)
     , custom_fini_func_(fini_function)
     , custom_send_msg_func_(send_msg_function)
     , custom_recv_msg_func_(recv_msg_function)
+    , custom_send_msgs_func_(std::move(send_msgs_function))
+    , custom_recv_msgs_func_(std::move(recv_msgs_function))
     , framing_(framing)
     , framing_io_(0x00,
         [&](
@@ -113,6 +135,14 @@ bool CustomAgent::init()
     {
         bool user_init_res = custom_init_func_();
 
+        if (user_init_res && !framing_ && custom_recv_msgs_func_ && !recv_buffers_)
+        {
+            // Endpoint members are known by now, so the reception slots can be laid out.
+            recv_endpoints_.assign(SERVER_BATCH_SIZE, *recv_endpoint_);
+            recv_buffers_.reset(new uint8_t[size_t(SERVER_BATCH_SIZE) * SERVER_BUFFER_SIZE]);
+            incoming_messages_.resize(SERVER_BATCH_SIZE);
+        }
+
         if (user_init_res)
         {
             UXR_AGENT_LOG_INFO(
@@ -214,14 +244,9 @@ bool CustomAgent::recv_message(
                     buffer_, static_cast<size_t>(recv_bytes)));
             input_packet.source = *recv_endpoint_;
 
-            uint32_t raw_client_key = 0u;
-            this->get_client_key(input_packet.source, raw_client_key);
-
-            std::stringstream ss;
-            ss << UXR_COLOR_YELLOW << "[==>> " << name_ << " <<==]" << UXR_COLOR_RESET;
-            UXR_AGENT_LOG_MESSAGE(
-                ss.str(),
-                raw_client_key,
+            log_message(
+                recv_label_,
+                input_packet.source,
                 input_packet.message->get_buf(),
                 input_packet.message->get_len());
         }
@@ -280,14 +305,9 @@ bool CustomAgent::send_message(
         bool success = (output_packet.message->get_len() == static_cast<size_t>(sent_bytes));
         if (success)
         {
-            uint32_t raw_client_key = 0u;
-            this->get_client_key(output_packet.destination, raw_client_key);
-
-            std::stringstream ss;
-            ss << UXR_COLOR_YELLOW << "[** <<" << name_ << ">> **]" << UXR_COLOR_RESET;
-            UXR_AGENT_LOG_MESSAGE(
-                ss.str(),
-                raw_client_key,
+            log_message(
+                send_label_,
+                output_packet.destination,
                 output_packet.message->get_buf(),
                 output_packet.message->get_len());
         }
@@ -322,6 +342,194 @@ bool CustomAgent::send_message(
     }
 }
 
+bool CustomAgent::recv_message(
+        std::vector<InputPacket<CustomEndPoint>>& input_packets,
+        int timeout,
+        TransportRc& transport_rc)
+{
+    if (framing_ || !custom_recv_msgs_func_)
+    {
+        InputPacket<CustomEndPoint> input_packet;
+        bool rv = recv_message(input_packet, timeout, transport_rc);
+        if (rv)
+        {
+            input_packets.push_back(std::move(input_packet));
+        }
+        return rv;
+    }
+
+    try
+    {
+        for (size_t i = 0; i < incoming_messages_.size(); ++i)
+        {
+            recv_endpoints_[i].reset();
+            incoming_messages_[i].source_endpoint = &recv_endpoints_[i];
+            incoming_messages_[i].buffer = recv_buffers_.get() + i * SERVER_BUFFER_SIZE;
+            incoming_messages_[i].buffer_length = SERVER_BUFFER_SIZE;
+            incoming_messages_[i].message_length = 0;
+        }
+
+        size_t received = custom_recv_msgs_func_(incoming_messages_, timeout, transport_rc);
+        received = std::min(received, incoming_messages_.size());
+
+        for (size_t i = 0; i < received; ++i)
+        {
+            IncomingMessage& incoming_message = incoming_messages_[i];
+            if ((0 == incoming_message.message_length)
+                    || (incoming_message.buffer_length < incoming_message.message_length))
+            {
+                continue;
+            }
+
+            // User must have filled all the members of the endpoint, a bad slot does not spoil the batch.
+            try
+            {
+                incoming_message.source_endpoint->check_non_empty_members();
+            }
+            catch (const std::exception& e)
+            {
+                UXR_AGENT_LOG_ERROR(
+                    UXR_DECORATE_RED("Message discarded from batch"),
+                    "custom {} agent, slot: {}, exception: {}",
+                    name_, i, e.what());
+                continue;
+            }
+
+            InputPacket<CustomEndPoint> input_packet;
+            input_packet.message.reset(
+                new eprosima::uxr::InputMessage(
+                    incoming_message.buffer, incoming_message.message_length));
+            input_packet.source = *incoming_message.source_endpoint;
+
+            log_message(
+                recv_label_,
+                input_packet.source,
+                input_packet.message->get_buf(),
+                input_packet.message->get_len());
+
+            input_packets.push_back(std::move(input_packet));
+        }
+
+        if (input_packets.empty()
+                && (TransportRc::ok != transport_rc)
+                && (TransportRc::timeout_error != transport_rc))
+        {
+            // Printing a trace for timeout_error would fill the log with too much messages.
+            std::stringstream ss;
+            ss << UXR_COLOR_RED << "Error while receiving messages: "
+               << transport_rc_to_str(transport_rc) << UXR_COLOR_RESET;
+            UXR_AGENT_LOG_ERROR(
+                ss.str(),
+                "{} agent error",
+                name_);
+        }
+
+        return !input_packets.empty();
+    }
+    catch (const std::exception& e)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("Error while receiving messages"),
+            "custom {} agent, exception: {}",
+            name_, e.what());
+        transport_rc = TransportRc::server_error;
+
+        return false;
+    }
+}
+
+bool CustomAgent::send_message(
+        std::vector<OutputPacket<CustomEndPoint>>& output_packets,
+        TransportRc& transport_rc)
+{
+    size_t sent = 0;
+
+    if (framing_ || !custom_send_msgs_func_)
+    {
+        for (; sent < output_packets.size(); ++sent)
+        {
+            if (!send_message(output_packets[sent], transport_rc))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        try
+        {
+            outgoing_messages_.clear();
+            for (const auto& output_packet : output_packets)
+            {
+                outgoing_messages_.push_back(OutgoingMessage{
+                    &output_packet.destination,
+                    output_packet.message->get_buf(),
+                    output_packet.message->get_len()});
+            }
+
+            sent = std::min(custom_send_msgs_func_(outgoing_messages_, transport_rc), output_packets.size());
+
+            for (size_t i = 0; i < sent; ++i)
+            {
+                log_message(
+                    send_label_,
+                    output_packets[i].destination,
+                    output_packets[i].message->get_buf(),
+                    output_packets[i].message->get_len());
+            }
+
+            if (sent < output_packets.size())
+            {
+                std::stringstream ss;
+                ss << UXR_COLOR_RED
+                   << "Error while sending messages: "
+                   << transport_rc_to_str(transport_rc)
+                   << ". Expected to send "
+                   << output_packets.size()
+                   << " messages, but sent "
+                   << sent
+                   << " instead"
+                   << UXR_COLOR_RESET;
+                UXR_AGENT_LOG_ERROR(
+                    ss.str(),
+                    "{} agent error",
+                    name_);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            UXR_AGENT_LOG_ERROR(
+                UXR_DECORATE_RED("Error while sending messages"),
+                "custom {} agent, exception: {}",
+                name_, e.what());
+        }
+    }
+
+    bool rv = (sent == output_packets.size());
+    output_packets.erase(output_packets.begin(), output_packets.begin() + sent);
+
+    return rv;
+}
+
+void CustomAgent::log_message(
+        const std::string& label,
+        const CustomEndPoint& endpoint,
+        const uint8_t* buffer,
+        size_t length)
+{
+    if (UXR_AGENT_LOG_MESSAGE_ENABLED())
+    {
+        uint32_t raw_client_key = 0u;
+        this->get_client_key(endpoint, raw_client_key);
+
+        UXR_AGENT_LOG_MESSAGE(
+            label.c_str(),
+            raw_client_key,
+            buffer,
+            length);
+    }
+}
+
 bool CustomAgent::handle_error(
         TransportRc transport_rc)
 {
@@ -14,6 +14,7 @@
 
 #include <uxr/agent/transport/discovery/DiscoveryServer.hpp>
 #include <uxr/agent/processor/Processor.hpp>
+#include <uxr/agent/config.hpp>
 
 #include <functional>
 
@@ -32,6 +33,8 @@ DiscoveryServer<EndPoint>::DiscoveryServer(
     , thread_{}
     , running_cond_{false}
     , processor_{processor}
+    , info_cache_{}
+    , rate_limiter_{INFO_RATE_LIMIT, INFO_RATE_MAX_SOURCES}
     , transport_addresses_{}
     , agent_port_{}
     , discovery_port_{}
@@ -57,11 +60,15 @@ void DiscoveryServer<EndPoint>::discovery_loop()
 {
     InputPacket<IPv4EndPoint> input_packet;
     OutputPacket<IPv4EndPoint> output_packet;
+
+    /* The INFO reply only depends on the transport addresses, so it is serialized once. */
+    processor_.build_info_cache(transport_addresses_, info_cache_);
+
     while (running_cond_)
     {
-        if (recv_message(input_packet, RECEIVE_TIMEOUT))
+        if (recv_message(input_packet, RECEIVE_TIMEOUT) && rate_limiter_.allow(input_packet.source))
         {
-            if (processor_.process_get_info_packet(std::move(input_packet), transport_addresses_, output_packet))
+            if (processor_.process_get_info_packet(std::move(input_packet), info_cache_, output_packet))
             {
                 send_message(std::move(output_packet));
             }
@@ -15,9 +15,15 @@
 #include <uxr/agent/transport/p2p/AgentDiscoverer.hpp>
 #include <uxr/agent/p2p/InternalClientManager.hpp>
 
+#include <algorithm>
+
 namespace eprosima {
 namespace uxr {
 
+constexpr std::chrono::milliseconds AgentDiscoverer::min_discovery_period;
+constexpr std::chrono::milliseconds AgentDiscoverer::max_discovery_period;
+constexpr int AgentDiscoverer::recv_timeout;
+
 AgentDiscoverer::AgentDiscoverer(
         Agent& agent)
     : agent_(agent)
@@ -87,26 +93,27 @@ void AgentDiscoverer::loop()
     OutputMessage output_message{header, message_size};
     output_message.append_submessage(dds::xrce::GET_INFO, payload);
     InputMessagePtr input_message;
+    InternalClientManager& manager = InternalClientManager::instance();
+    std::chrono::milliseconds period = min_discovery_period;
 
     while (running_cond_)
     {
         send_message(output_message);
-        bool message_received;
-        do
+        bool new_agent = false;
+        auto deadline = std::chrono::steady_clock::now() + period;
+        while (running_cond_ && (std::chrono::steady_clock::now() < deadline))
         {
-            message_received = recv_message(input_message, 0);
-            if (message_received)
+            if (recv_message(input_message, recv_timeout))
             {
                 dds::xrce::INFO_Payload info_payload;
                 input_message->prepare_next_submessage();
                 input_message->get_payload(info_payload);
                 dds::xrce::TransportAddressMedium address =
                         info_payload.object_info().activity().agent().address_seq()[0].medium_locator();
-                InternalClientManager& manager = InternalClientManager::instance();
-                manager.create_client(agent_, address.address(), address.port());
+                new_agent = manager.create_client(agent_, address.address(), address.port()) || new_agent;
             }
-        } while(message_received);
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        period = new_agent ? min_discovery_period : (std::min)(period * 2, max_discovery_period);
     }
 }
 
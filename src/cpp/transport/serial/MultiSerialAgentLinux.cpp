@@ -17,30 +17,94 @@
 #include <uxr/agent/logger/Logger.hpp>
 
 #include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#ifdef UAGENT_IO_URING_PROFILE
+#include <linux/io_uring.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 
 namespace eprosima {
 namespace uxr {
 
 MultiSerialAgent::MultiSerialAgent(
         uint8_t addr,
-        Middleware::Kind middleware_kind)
+        Middleware::Kind middleware_kind,
+        bool io_uring)
     : Server<MultiSerialEndPoint>{middleware_kind}
     , framing_io{}
+    , epoll_fd_{epoll_create1(EPOLL_CLOEXEC)}
+    , epoll_events_{}
     , addr_{addr}
-    , buffer_{0}
+#ifdef UAGENT_IO_URING_PROFILE
+    , use_io_uring_{io_uring}
+    , read_ring_{}
+    , write_ring_{}
+    , read_ring_fallback_{false}
+    , write_ring_fallback_{false}
+#else
+    , use_io_uring_{false}
+#endif
 {
-    FD_ZERO(&read_fds);
+    if (-1 == epoll_fd_)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("epoll error"),
+            "errno: {}",
+            errno);
+    }
+#ifndef UAGENT_IO_URING_PROFILE
+    if (io_uring)
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("io_uring not built, using read and write"),
+            "addr: {}",
+            addr_);
+    }
+#endif
+}
+
+MultiSerialAgent::~MultiSerialAgent()
+{
+    if (-1 != epoll_fd_)
+    {
+        ::close(epoll_fd_);
+    }
 }
 
 void MultiSerialAgent::insert_serial(int serial_fd)
 {
     utils::ExclusiveLockPriority lk(framing_mtx);
-    FD_SET(serial_fd, &read_fds);
+
+    /* Ports are serviced from a single thread, so reads shall never block. */
+    int flags = fcntl(serial_fd, F_GETFL, 0);
+    if ((-1 == flags) || (-1 == fcntl(serial_fd, F_SETFL, flags | O_NONBLOCK)))
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("non-blocking mode not set"),
+            "fd: {}, errno: {}",
+            serial_fd, errno);
+    }
+
     FramingIO aux_framing_io(addr_,
-        std::bind(&MultiSerialAgent::write_data, this, (uint8_t) serial_fd, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-        std::bind(&MultiSerialAgent::read_data, this, (uint8_t) serial_fd, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
-    
-    framing_io.insert(std::pair<int, FramingIO>(serial_fd, aux_framing_io));
+        std::bind(&MultiSerialAgent::write_data, this, serial_fd, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+        std::bind(&MultiSerialAgent::read_data, this, serial_fd, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
+
+    framing_io.erase(serial_fd);
+    framing_io.emplace(serial_fd, SerialPort(std::move(aux_framing_io)));
+
+    struct epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = serial_fd;
+    if (-1 == epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, serial_fd, &event))
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("epoll add error"),
+            "fd: {}, errno: {}",
+            serial_fd, errno);
+    }
 }
 
 bool MultiSerialAgent::remove_serial(int serial_fd)
@@ -48,7 +112,7 @@ bool MultiSerialAgent::remove_serial(int serial_fd)
     bool rv = false;
     utils::ExclusiveLockPriority lk(framing_mtx);
 
-    FD_CLR(serial_fd, &read_fds);
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, serial_fd, nullptr);
     framing_io.erase(serial_fd);
 
     if (0 == ::close(serial_fd))
@@ -75,62 +139,132 @@ bool MultiSerialAgent::recv_message(
         int timeout,
         TransportRc& transport_rc)
 {
-    struct timeval timeout_;
-    timeout_.tv_sec = timeout / 1000;
-    timeout_.tv_usec = (timeout % 1000) * 1000;
-
-    bool rv = false;
-
-    utils::SharedLockPriority lk(framing_mtx);
-    fd_set fds = read_fds;
-    int ret = select(framing_io.rbegin()->first+1, &fds, NULL, NULL, &timeout_);
+    /* Ports capped on the previous call are read again right away, so epoll must not block meanwhile. */
+    std::vector<int> capped_fds;
+    capped_fds.swap(capped_fds_);
+    int ready_fds = epoll_wait(epoll_fd_, epoll_events_, max_epoll_events, capped_fds.empty() ? timeout : 0);
 
-    if (0 < ret)
+    if (!capped_fds.empty())
     {
-        for (auto it = framing_io.begin(); it != framing_io.end(); it++)
+        utils::SharedLockPriority lk(framing_mtx);
+        for (int serial_fd : capped_fds)
         {
-            if (FD_ISSET(it->first, &fds))
+            if (read_port(serial_fd, input_packet, transport_rc))
             {
-                uint8_t remote_addr = 0x00;
-                ssize_t bytes_read = 0;
-                int timeout_ms = timeout_.tv_sec*1000 + timeout_.tv_usec/1000;
+                capped_fds_.push_back(serial_fd);
+            }
+        }
+    }
 
-                do
+    if (0 < ready_fds)
+    {
+        utils::SharedLockPriority lk(framing_mtx);
+#ifdef UAGENT_IO_URING_PROFILE
+        if (use_io_uring_)
+        {
+            /* A capped port still holds input from an earlier batch, it is only read once that is consumed. */
+            std::vector<int> serial_fds;
+            for (int i = 0; i < ready_fds; ++i)
+            {
+                int serial_fd = epoll_events_[i].data.fd;
+                if ((epoll_events_[i].events & EPOLLIN) &&
+                    (capped_fds_.end() == std::find(capped_fds_.begin(), capped_fds_.end(), serial_fd)))
                 {
-                    bytes_read = it->second.read_framed_msg(
-                        buffer_, sizeof (buffer_), remote_addr, timeout_ms, transport_rc);
-                }
-                while ((0 == bytes_read) && (0 < timeout_ms));
-
-                if (0 < bytes_read)
-                {
-                    struct InputPacket<MultiSerialEndPoint> aux_pack{};
-                    aux_pack.message.reset(new InputMessage(buffer_, static_cast<size_t>(bytes_read)));
-                    aux_pack.source = MultiSerialEndPoint(it->first, remote_addr);
-                    rv = true;
-
-                    uint32_t raw_client_key;
-                    if (Server<MultiSerialEndPoint>::get_client_key(aux_pack.source, raw_client_key))
-                    {
-                        UXR_MULTIAGENT_LOG_MESSAGE(
-                            UXR_DECORATE_YELLOW("[==>> SER <<==]"),
-                            raw_client_key,
-                            it->first,
-                            aux_pack.message->get_buf(),
-                            aux_pack.message->get_len());
-                    }
-
-                    input_packet.push_back(std::move(aux_pack));
+                    serial_fds.push_back(serial_fd);
                 }
             }
+            read_ports(serial_fds, transport_rc);
+        }
+#endif
+        for (int i = 0; i < ready_fds; ++i)
+        {
+            int serial_fd = epoll_events_[i].data.fd;
+            if ((epoll_events_[i].events & EPOLLIN) &&
+                (capped_fds_.end() == std::find(capped_fds_.begin(), capped_fds_.end(), serial_fd)) &&
+                read_port(serial_fd, input_packet, transport_rc))
+            {
+                capped_fds_.push_back(serial_fd);
+            }
+            if (epoll_events_[i].events & (EPOLLERR | EPOLLHUP))
+            {
+                transport_rc = TransportRc::server_error;
+                push_error_fd(serial_fd);
+            }
         }
     }
     else
     {
-        transport_rc = (ret == 0) ? TransportRc::timeout_error : TransportRc::server_error;
+        transport_rc = ((0 == ready_fds) || (EINTR == errno))
+            ? TransportRc::timeout_error
+            : TransportRc::server_error;
     }
 
-    return rv;
+    return !input_packet.empty();
+}
+
+bool MultiSerialAgent::read_port(
+        int serial_fd,
+        std::vector<InputPacket<MultiSerialEndPoint>>& input_packet,
+        TransportRc& transport_rc)
+{
+    std::map<int, SerialPort>::iterator it = framing_io.find(serial_fd);
+    if (it == framing_io.end())
+    {
+        // Port removed while waiting.
+        return false;
+    }
+
+    /*
+     * Drain up to max_frames_per_event complete frames from this port. A partially received frame
+     * keeps its state in the port's FramingIO and is resumed on the next readiness event, so a
+     * slow port never stalls the others. Returns whether the cap was hit, in which case the port
+     * must be read again without waiting for epoll.
+     */
+    size_t bytes_read = 0;
+    size_t frames_read = 0;
+    do
+    {
+        uint8_t remote_addr = 0x00;
+        int timeout_ms = 0;
+        bytes_read = it->second.framing_io.read_framed_msg(
+            it->second.buffer.get(), SERVER_BUFFER_SIZE, remote_addr, timeout_ms, transport_rc);
+
+        if (0 < bytes_read)
+        {
+            struct InputPacket<MultiSerialEndPoint> aux_pack{};
+            aux_pack.message.reset(new InputMessage(it->second.buffer.get(), bytes_read));
+            aux_pack.source = MultiSerialEndPoint(serial_fd, remote_addr);
+
+            uint32_t raw_client_key;
+            if (Server<MultiSerialEndPoint>::get_client_key(aux_pack.source, raw_client_key))
+            {
+                UXR_MULTIAGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[==>> SER <<==]"),
+                    raw_client_key,
+                    serial_fd,
+                    aux_pack.message->get_buf(),
+                    aux_pack.message->get_len());
+            }
+
+            input_packet.push_back(std::move(aux_pack));
+            ++frames_read;
+        }
+    }
+    while ((0 < bytes_read) && (frames_read < max_frames_per_event));
+
+#ifdef UAGENT_IO_URING_PROFILE
+    /* Input left by a discarded frame is framed again before the port is read anew. */
+    return (0 < bytes_read) || (it->second.input_pos < it->second.input_len);
+#else
+    return (0 < bytes_read);
+#endif
+}
+
+void MultiSerialAgent::push_error_fd(
+        int serial_fd)
+{
+    std::unique_lock<std::mutex> lk(error_mtx);
+    error_fd.push_back(serial_fd);
 }
 
 bool MultiSerialAgent::send_message(
@@ -141,7 +275,7 @@ bool MultiSerialAgent::send_message(
     int client_fd = output_packet.destination.get_fd();
 
     utils::SharedLockPriority lk(framing_mtx);
-    std::map<int, FramingIO>::iterator it = framing_io.find(client_fd);
+    std::map<int, SerialPort>::iterator it = framing_io.find(client_fd);
 
     if (it == framing_io.end())
     {
@@ -150,9 +284,11 @@ bool MultiSerialAgent::send_message(
     }
 
     ssize_t bytes_written =
-            it->second.write_framed_msg(
-                output_packet.message->get_buf(),
-                output_packet.message->get_len(),
+            it->second.framing_io.write_framed_msg(
+                output_packet.message->get_head_buf(),
+                output_packet.message->get_head_len(),
+                output_packet.message->get_payload_buf(),
+                output_packet.message->get_payload_len(),
                 output_packet.destination.get_addr(),
                 transport_rc);
 
@@ -162,7 +298,8 @@ bool MultiSerialAgent::send_message(
         rv = true;
 
         uint32_t raw_client_key;
-        if (Server<MultiSerialEndPoint>::get_client_key(output_packet.destination, raw_client_key))
+        if (UXR_AGENT_LOG_MESSAGE_ENABLED() &&
+            Server<MultiSerialEndPoint>::get_client_key(output_packet.destination, raw_client_key))
         {
             UXR_MULTIAGENT_LOG_MESSAGE(
                 UXR_DECORATE_YELLOW("[** <<SER>> **]"),
@@ -175,62 +312,363 @@ bool MultiSerialAgent::send_message(
     return rv;
 }
 
-ssize_t MultiSerialAgent::read_data(
-        uint8_t serial_fd,
-        uint8_t* buf,
-        size_t len,
-        int timeout,
+bool MultiSerialAgent::send_message(
+        std::vector<OutputPacket<MultiSerialEndPoint>>& output_packets,
         TransportRc& transport_rc)
 {
-    // Modify timeout?
-    ssize_t bytes_read = 0;
-    pollfd read_file = {serial_fd, POLLIN, 0};
+    bool rv = true;
+#ifdef UAGENT_IO_URING_PROFILE
+    utils::SharedLockPriority lk(framing_mtx);
 
-    int poll_rv = poll(&read_file, 1, timeout);
+    /* Every frame is gathered in the output of its port, then each port is written once. */
+    std::vector<int> serial_fds;
+    for (auto& output_packet : output_packets)
+    {
+        int client_fd = output_packet.destination.get_fd();
+        std::map<int, SerialPort>::iterator it = framing_io.find(client_fd);
+        if (it == framing_io.end())
+        {
+            // Destination client not found on active ports
+            continue;
+        }
+
+        const bool first = it->second.output.empty();
+        it->second.framing_io.write_framed_msg(
+            output_packet.message->get_head_buf(),
+            output_packet.message->get_head_len(),
+            output_packet.message->get_payload_buf(),
+            output_packet.message->get_payload_len(),
+            output_packet.destination.get_addr(),
+            transport_rc);
+        if (first && !it->second.output.empty())
+        {
+            serial_fds.push_back(client_fd);
+        }
+
+        uint32_t raw_client_key;
+        if (UXR_AGENT_LOG_MESSAGE_ENABLED() &&
+            Server<MultiSerialEndPoint>::get_client_key(output_packet.destination, raw_client_key))
+        {
+            UXR_MULTIAGENT_LOG_MESSAGE(
+                UXR_DECORATE_YELLOW("[** <<SER>> **]"),
+                raw_client_key,
+                output_packet.destination.get_fd(),
+                output_packet.message->get_buf(),
+                output_packet.message->get_len());
+        }
+    }
+
+    /* A port that fails is closed by the error handler, its packets are not kept for it. */
+    rv = write_ports(serial_fds, transport_rc);
+#else
+    (void) transport_rc;
+#endif
+    output_packets.clear();
+    return rv;
+}
 
-    if(read_file.revents & (POLLERR+POLLHUP))
+#ifdef UAGENT_IO_URING_PROFILE
+bool MultiSerialAgent::prepare_ring(
+        util::IoUring& ring,
+        bool& fallback)
+{
+    if (!ring.is_init() && !fallback)
     {
-        transport_rc = TransportRc::server_error;;
+        fallback = !ring.init(max_epoll_events, 2 * max_epoll_events);
+        if (fallback)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("io_uring not available, using read and write"),
+                "addr: {}",
+                addr_);
+        }
     }
-    else if (0 < poll_rv)
+    return !fallback;
+}
+
+bool MultiSerialAgent::submit_ring(
+        util::IoUring& ring,
+        bool& fallback,
+        unsigned count)
+{
+    /* The operations complete at once on the non-blocking ports, so all of them are waited for. */
+    bool rv = ring.submit(count, -1);
+    if (!rv)
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("io_uring error, using read and write"),
+            "addr: {}, errno: {}",
+            addr_, errno);
+        ring.fini();
+        fallback = true;
+    }
+    return rv;
+}
+
+void MultiSerialAgent::read_ports(
+        const std::vector<int>& serial_fds,
+        TransportRc& transport_rc)
+{
+    const bool from_ring = prepare_ring(read_ring_, read_ring_fallback_);
+
+    /* At most max_epoll_events ports are ready, as many as the ring takes at once. */
+    std::vector<int> read_fds;
+    std::vector<SerialPort*> ports;
+    std::vector<int32_t> results;
+    unsigned queued = 0;
+    for (int serial_fd : serial_fds)
+    {
+        std::map<int, SerialPort>::iterator it = framing_io.find(serial_fd);
+        if (it == framing_io.end())
+        {
+            // Port removed while waiting.
+            continue;
+        }
+
+        SerialPort& port = it->second;
+        port.input_pos = 0;
+        port.input_len = 0;
+        struct io_uring_sqe* sqe = from_ring
+            ? read_ring_.get_sqe(IORING_OP_READ, serial_fd, uint64_t(ports.size()))
+            : nullptr;
+        if (nullptr != sqe)
+        {
+            sqe->addr = reinterpret_cast<uint64_t>(port.input.get());
+            sqe->len = uint32_t(SERVER_BUFFER_SIZE);
+            results.push_back(-EAGAIN);
+            ++queued;
+        }
+        else
+        {
+            ssize_t bytes_read = ::read(serial_fd, port.input.get(), SERVER_BUFFER_SIZE);
+            results.push_back((0 > bytes_read) ? -errno : int32_t(bytes_read));
+        }
+        read_fds.push_back(serial_fd);
+        ports.push_back(&port);
+    }
+
+    if ((0 < queued) && submit_ring(read_ring_, read_ring_fallback_, queued))
+    {
+        util::IoUring::Completion completion;
+        while (read_ring_.pop(completion))
+        {
+            results[size_t(completion.user_data)] = completion.res;
+        }
+    }
+
+    for (size_t i = 0; i < ports.size(); ++i)
     {
-        bytes_read = read(serial_fd, buf, len);
-        if (0 > bytes_read)
+        if (0 < results[i])
+        {
+            ports[i]->input_len = size_t(results[i]);
+        }
+        else if ((0 > results[i]) && (-EAGAIN != results[i]) && (-EINTR != results[i]))
         {
             transport_rc = TransportRc::server_error;
+            push_error_fd(read_fds[i]);
         }
     }
-    else
+}
+
+bool MultiSerialAgent::write_ports(
+        const std::vector<int>& serial_fds,
+        TransportRc& transport_rc)
+{
+    bool rv = true;
+    const bool from_ring = prepare_ring(write_ring_, write_ring_fallback_);
+
+    struct PendingWrite
+    {
+        int serial_fd;
+        std::vector<uint8_t>* output;
+        size_t written;
+        int32_t result;
+    };
+    std::vector<PendingWrite> pending;
+    for (int serial_fd : serial_fds)
+    {
+        pending.push_back(PendingWrite{serial_fd, &framing_io.at(serial_fd).output, 0, 0});
+    }
+
+    while (!pending.empty())
+    {
+        /* One write per port, the ring submitting up to max_epoll_events of them at once. */
+        const size_t count = std::min(pending.size(), size_t(max_epoll_events));
+        size_t queued = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            PendingWrite& write = pending[i];
+            struct io_uring_sqe* sqe = from_ring
+                ? write_ring_.get_sqe(IORING_OP_WRITE, write.serial_fd, uint64_t(i))
+                : nullptr;
+            if (nullptr != sqe)
+            {
+                sqe->addr = reinterpret_cast<uint64_t>(write.output->data() + write.written);
+                sqe->len = uint32_t(write.output->size() - write.written);
+                write.result = -EAGAIN;
+                ++queued;
+            }
+            else
+            {
+                ssize_t bytes_written = ::write(
+                    write.serial_fd, write.output->data() + write.written, write.output->size() - write.written);
+                write.result = (0 > bytes_written) ? -errno : int32_t(bytes_written);
+            }
+        }
+
+        if ((0 < queued) && submit_ring(write_ring_, write_ring_fallback_, unsigned(queued)))
+        {
+            util::IoUring::Completion completion;
+            while (write_ring_.pop(completion))
+            {
+                pending[size_t(completion.user_data)].result = completion.res;
+            }
+        }
+
+        /* Ports whose output queue is full wait for it to drain, once, as write_data does. */
+        std::vector<struct pollfd> full_fds;
+        std::vector<PendingWrite> next;
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            PendingWrite& write = pending[i];
+            if (i >= count)
+            {
+                next.push_back(write);
+            }
+            else if (0 < write.result)
+            {
+                write.written += size_t(write.result);
+                if (write.written < write.output->size())
+                {
+                    next.push_back(write);
+                }
+            }
+            else if ((0 == write.result) || (-EAGAIN == write.result) || (-EINTR == write.result))
+            {
+                full_fds.push_back(pollfd{write.serial_fd, POLLOUT, 0});
+                next.push_back(write);
+            }
+            else
+            {
+                rv = false;
+                transport_rc = TransportRc::server_error;
+                push_error_fd(write.serial_fd);
+            }
+        }
+
+        if (!full_fds.empty() && (0 >= poll(full_fds.data(), full_fds.size(), 100)))
+        {
+            /* Nothing drained, the remaining frames of those ports are dropped. */
+            next.erase(
+                std::remove_if(next.begin(), next.end(),
+                [&](const PendingWrite& write)
+                {
+                    return full_fds.end() != std::find_if(full_fds.begin(), full_fds.end(),
+                    [&](const struct pollfd& full_fd)
+                    {
+                        return full_fd.fd == write.serial_fd;
+                    });
+                }),
+                next.end());
+        }
+        pending.swap(next);
+    }
+
+    for (int serial_fd : serial_fds)
     {
-        transport_rc = (poll_rv == 0) ? TransportRc::timeout_error : TransportRc::server_error;
+        framing_io.at(serial_fd).output.clear();
     }
+    return rv;
+}
+#endif
 
-    if (transport_rc == TransportRc::server_error)
+ssize_t MultiSerialAgent::read_data(
+        int serial_fd,
+        uint8_t* buf,
+        size_t len,
+        int /* timeout */,
+        TransportRc& transport_rc)
+{
+#ifdef UAGENT_IO_URING_PROFILE
+    if (use_io_uring_)
+    {
+        /* The framing takes the input of the last batch read, and waits for the next one once it is consumed. */
+        ssize_t rv = 0;
+        std::map<int, SerialPort>::iterator it = framing_io.find(serial_fd);
+        if (it != framing_io.end())
+        {
+            SerialPort& port = it->second;
+            rv = ssize_t(std::min(len, port.input_len - port.input_pos));
+            memcpy(buf, port.input.get() + port.input_pos, size_t(rv));
+            port.input_pos += size_t(rv);
+        }
+        if (0 == rv)
+        {
+            transport_rc = TransportRc::timeout_error;
+        }
+        return rv;
+    }
+#endif
+
+    /* The port is non-blocking and only read when epoll reports it readable. */
+    ssize_t bytes_read = ::read(serial_fd, buf, len);
+    if (0 > bytes_read)
     {
-        std::unique_lock<std::mutex> lk(error_mtx);
-        error_fd.push_back(serial_fd);
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno))
+        {
+            transport_rc = TransportRc::timeout_error;
+        }
+        else
+        {
+            transport_rc = TransportRc::server_error;
+            push_error_fd(serial_fd);
+        }
+        bytes_read = 0;
     }
 
     return bytes_read;
 }
 
 ssize_t MultiSerialAgent::write_data(
-        uint8_t serial_fd,
+        int serial_fd,
         uint8_t* buf,
         size_t len,
         TransportRc& transport_rc)
 {
+#ifdef UAGENT_IO_URING_PROFILE
+    if (use_io_uring_)
+    {
+        /* Frames are gathered per port and written with the rest of the batch. */
+        std::map<int, SerialPort>::iterator it = framing_io.find(serial_fd);
+        if (it == framing_io.end())
+        {
+            return 0;
+        }
+        it->second.output.insert(it->second.output.end(), buf, buf + len);
+        return ssize_t(len);
+    }
+#endif
+
     size_t rv = 0;
     ssize_t bytes_written = ::write(serial_fd, buf, len);
     if (0 < bytes_written)
     {
         rv = size_t(bytes_written);
     }
+    else if ((0 > bytes_written) && ((EAGAIN == errno) || (EWOULDBLOCK == errno)))
+    {
+        /* Output queue full: wait for the port to drain before retrying. */
+        pollfd write_file = {serial_fd, POLLOUT, 0};
+        if (0 < poll(&write_file, 1, 100))
+        {
+            bytes_written = ::write(serial_fd, buf, len);
+            rv = (0 < bytes_written) ? size_t(bytes_written) : 0;
+        }
+    }
     else
     {
         transport_rc = TransportRc::server_error;
-        std::unique_lock<std::mutex> lk(error_mtx);
-        error_fd.push_back(serial_fd);
+        push_error_fd(serial_fd);
     }
     return rv;
 }
@@ -16,8 +16,13 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <poll.h>
+#include <libgen.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
 #include <thread>
 #include <vector>
+#include <set>
 #include <algorithm>
 
 namespace eprosima {
@@ -28,8 +33,10 @@ MultiTermiosAgent::MultiTermiosAgent(
         int open_flags,
         termios const& termios_attrs,
         uint8_t addr,
-        Middleware::Kind middleware_kind)
-    : MultiSerialAgent(addr, middleware_kind)
+        Middleware::Kind middleware_kind,
+        bool io_uring)
+    : MultiSerialAgent(addr, middleware_kind, io_uring)
+    , wakeup_fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
     , exitSignal(false)
     , devs_{}
     , initialized_devs_{}
@@ -55,14 +62,92 @@ MultiTermiosAgent::~MultiTermiosAgent()
             "exception: {}",
             e.what());
     }
+
+    if (-1 != wakeup_fd_)
+    {
+        ::close(wakeup_fd_);
+    }
+}
+
+void MultiTermiosAgent::watch_devices(
+        int inotify_fd,
+        bool& watching_all)
+{
+    std::set<std::string> dirs;
+    for (const auto& dev : devs_)
+    {
+        std::vector<char> path(dev.second.begin(), dev.second.end());
+        path.push_back('\0');
+        dirs.insert(dirname(path.data()));
+    }
+
+    watching_all = (-1 != inotify_fd);
+    for (const auto& dir : dirs)
+    {
+        if ((-1 == inotify_fd) ||
+            (-1 == inotify_add_watch(inotify_fd, dir.c_str(), IN_CREATE | IN_ATTRIB | IN_MOVED_TO)))
+        {
+            UXR_AGENT_LOG_DEBUG(
+                UXR_DECORATE_YELLOW("device directory not watched"),
+                "directory: {}, errno: {}",
+                dir, errno);
+            watching_all = false;
+        }
+    }
+}
+
+void MultiTermiosAgent::wait_devices(
+        int inotify_fd,
+        int timeout)
+{
+    pollfd poll_fds[2] = {{inotify_fd, POLLIN, 0}, {wakeup_fd_, POLLIN, 0}};
+    if (0 < poll(poll_fds, 2, timeout))
+    {
+        /* Drain pending notifications, any of them triggers a new scan of the missing devices. */
+        uint8_t events[4096];
+        if (poll_fds[0].revents & POLLIN)
+        {
+            while (0 < ::read(inotify_fd, events, sizeof(events)))
+            {}
+        }
+        if (poll_fds[1].revents & POLLIN)
+        {
+            uint64_t counter;
+            while (0 < ::read(wakeup_fd_, &counter, sizeof(counter)))
+            {}
+        }
+    }
+}
+
+void MultiTermiosAgent::wake_init_multiport()
+{
+    init_serial_cv.notify_all();
+    if (-1 != wakeup_fd_)
+    {
+        uint64_t counter = 1;
+        ssize_t rv = ::write(wakeup_fd_, &counter, sizeof(counter));
+        (void) rv;
+    }
 }
 
 void MultiTermiosAgent::init_multiport()
 {
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();;
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
     bool wake_main = false;
     exitSignal = false;
-    
+
+    /*
+     * Device arrival is notified by inotify on the devices' parent directories (e.g. /dev).
+     * If some directory cannot be watched, fall back to periodically polling the devices.
+     */
+    int inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    bool watching_all = false;
+    {
+        std::unique_lock<std::mutex> lk(devs_mtx);
+        watch_devices(inotify_fd, watching_all);
+    }
+    const int wait_timeout = watching_all ? 1000 : 10;
+
     do
     {
         std::unique_lock<std::mutex> lk(devs_mtx);
@@ -147,11 +232,9 @@ void MultiTermiosAgent::init_multiport()
         {
             if (!wake_main && initialized_devs_.size())
             {
-                init_serial_cv.notify_one();
+                init_serial_cv.notify_all();
                 wake_main = true;
             }
-            
-            std::this_thread::sleep_for((std::chrono::milliseconds) 10);
 
             if (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - begin).count())
             {
@@ -164,11 +247,15 @@ void MultiTermiosAgent::init_multiport()
                     "Waiting for devices: {}",
                     aux_str);
             }
+
+            lk.unlock();
+            wait_devices(inotify_fd, wait_timeout);
+            continue;
         }
         else if (!exitSignal)
         {
             // All ports handled, notify main thread
-            init_serial_cv.notify_one();
+            init_serial_cv.notify_all();
 
             // Wait for more ports
             init_serial_cv.wait(lk);
@@ -177,17 +264,20 @@ void MultiTermiosAgent::init_multiport()
         lk.unlock();
 
     } while (!exitSignal);
+
+    if (-1 != inotify_fd)
+    {
+        ::close(inotify_fd);
+    }
 }
 
 bool MultiTermiosAgent::init()
 {
     init_serial = std::thread(&MultiTermiosAgent::init_multiport, this);
 
-    std::mutex temp_mtx;
-    std::unique_lock<std::mutex> lk(temp_mtx);
-
     // Wait for initialized port
-    init_serial_cv.wait(lk);
+    std::unique_lock<std::mutex> lk(devs_mtx);
+    init_serial_cv.wait(lk, [&](){ return !initialized_devs_.empty() || devs_.empty(); });
 
     return (framing_io.size() > 0) ? true : false;
 }
@@ -199,7 +289,7 @@ bool MultiTermiosAgent::fini()
     if (init_serial.joinable())
     {
         exitSignal = true;
-        init_serial_cv.notify_one();
+        wake_init_multiport();
         init_serial.join();
     }
 
@@ -276,7 +366,7 @@ bool MultiTermiosAgent::handle_error(
         }
 
         // Wake serial init thread
-        init_serial_cv.notify_one();        
+        wake_init_multiport();
     }
 
     // TODO: handle close errors
@@ -121,8 +121,10 @@ bool SerialAgent::send_message(
     bool rv = false;
     ssize_t bytes_written =
             framing_io_.write_framed_msg(
-                output_packet.message->get_buf(),
-                output_packet.message->get_len(),
+                output_packet.message->get_head_buf(),
+                output_packet.message->get_head_len(),
+                output_packet.message->get_payload_buf(),
+                output_packet.message->get_payload_len(),
                 output_packet.destination.get_addr(),
                 transport_rc);
     if ((0 < bytes_written) && (
@@ -131,7 +133,8 @@ bool SerialAgent::send_message(
         rv = true;
 
         uint32_t raw_client_key;
-        if (Server<SerialEndPoint>::get_client_key(output_packet.destination, raw_client_key))
+        if (UXR_AGENT_LOG_MESSAGE_ENABLED() &&
+            Server<SerialEndPoint>::get_client_key(output_packet.destination, raw_client_key))
         {
             UXR_AGENT_LOG_MESSAGE(
                 UXR_DECORATE_YELLOW("[** <<SER>> **]"),
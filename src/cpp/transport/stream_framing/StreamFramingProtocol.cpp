@@ -47,6 +47,19 @@ size_t FramingIO::write_framed_msg(
         uint8_t remote_addr,
         TransportRc& transport_rc)
 {
+    return write_framed_msg(buf, len, nullptr, 0, remote_addr, transport_rc);
+}
+
+size_t FramingIO::write_framed_msg(
+        const uint8_t* head,
+        size_t head_len,
+        const uint8_t* payload,
+        size_t payload_len,
+        uint8_t remote_addr,
+        TransportRc& transport_rc)
+{
+    const size_t len = head_len + payload_len;
+
     /* Buffer being flag. */
     write_buffer_[0] = framing_begin_flag;
     write_buffer_pos_ = 1;
@@ -64,7 +77,9 @@ size_t FramingIO::write_framed_msg(
     bool cond = true;
     while (written_len < len && cond)
     {
-        octet = static_cast<uint8_t>(*(buf + written_len));
+        octet = (written_len < head_len)
+            ? *(head + written_len)
+            : *(payload + (written_len - head_len));
         if (add_next_octet(octet))
         {
             update_crc(crc, octet);
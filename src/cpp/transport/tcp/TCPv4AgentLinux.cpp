@@ -19,18 +19,29 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <arpa/inet.h>
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
 #include <signal.h>
+#ifdef UAGENT_IO_URING_PROFILE
+#include <sys/eventfd.h>
+#endif
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 namespace eprosima {
 namespace uxr {
 
 const uint8_t max_attemps = 16;
 
+#ifdef UAGENT_IO_URING_PROFILE
+/* Registered receive buffers of the ring, a power of two. */
+const uint16_t io_uring_buffer_count = 64;
+#endif
+
 #ifdef UAGENT_DISCOVERY_PROFILE
 extern template class DiscoveryServer<IPv4EndPoint>;
 extern template class DiscoveryServerLinux<IPv4EndPoint>;
@@ -38,7 +49,8 @@ extern template class DiscoveryServerLinux<IPv4EndPoint>;
 
 TCPv4Agent::TCPv4Agent(
         uint16_t agent_port,
-        Middleware::Kind middleware_kind)
+        Middleware::Kind middleware_kind,
+        bool io_uring)
     : Server<IPv4EndPoint>{middleware_kind}
     , TCPServerBase{}
     , connections_{}
@@ -51,6 +63,12 @@ TCPv4Agent::TCPv4Agent(
     , listener_thread_{}
     , running_cond_{false}
     , messages_queue_{}
+    , use_io_uring_{io_uring}
+#ifdef UAGENT_IO_URING_PROFILE
+    , ring_{}
+    , wake_fd_{io_uring ? eventfd(0, EFD_CLOEXEC) : -1}
+    , arm_pending_{false}
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
     , discovery_server_{*processor_}
 #endif
@@ -69,6 +87,12 @@ TCPv4Agent::~TCPv4Agent()
             "exception: {}",
             e.what());
     }
+#ifdef UAGENT_IO_URING_PROFILE
+    if (-1 != wake_fd_)
+    {
+        ::close(wake_fd_);
+    }
+#endif
 }
 
 bool TCPv4Agent::init()
@@ -125,6 +149,16 @@ bool TCPv4Agent::init()
             /* Init listener. */
             if (-1 != listen(listener_poll_.fd, TCP_MAX_BACKLOG_CONNECTIONS))
             {
+#ifndef UAGENT_IO_URING_PROFILE
+                if (use_io_uring_)
+                {
+                    UXR_AGENT_LOG_WARN(
+                        UXR_DECORATE_YELLOW("io_uring not built, using poll"),
+                        "port: {}",
+                        agent_port_);
+                    use_io_uring_ = false;
+                }
+#endif
                 running_cond_ = true;
                 listener_thread_ = std::thread(&TCPv4Agent::listener_loop, this);
                 rv = true;
@@ -277,18 +311,44 @@ bool TCPv4Agent::send_message(
 
         msg_size_buf[0] = uint8_t(0x00FF & output_packet.message->get_len());
         msg_size_buf[1] = uint8_t((0xFF00 & output_packet.message->get_len()) >> 8);
+
+        /* Gather the size, the message header and the shared payload of fragments in a single write. */
+        struct iovec iov[3];
+        iov[0].iov_base = msg_size_buf;
+        iov[0].iov_len = 2;
+        iov[1].iov_base = const_cast<uint8_t*>(output_packet.message->get_head_buf());
+        iov[1].iov_len = output_packet.message->get_head_len();
+        iov[2].iov_base = const_cast<uint8_t*>(output_packet.message->get_payload_buf());
+        iov[2].iov_len = output_packet.message->get_payload_len();
+
+        const size_t frame_len = 2 + output_packet.message->get_len();
+        struct iovec* pending = iov;
+        size_t pending_count = (0 == iov[2].iov_len) ? 2 : 3;
         uint8_t n_attemps = 0;
-        uint16_t bytes_sent = 0;
+        size_t bytes_sent = 0;
 
-        /* Send message size. */
-        bool size_sent = false;
+        /* Send message size and payload. */
+        bool payload_sent = false;
         do
         {
-            size_t send_rv = send_data(connection, msg_size_buf, 2, transport_rc);
+            size_t send_rv = send_data(connection, pending, pending_count, transport_rc);
             if (0 < send_rv)
             {
-                bytes_sent += uint16_t(send_rv);
-                size_sent = (bytes_sent == 2);
+                bytes_sent += send_rv;
+                payload_sent = (bytes_sent == frame_len);
+
+                /* Skip the segments already sent. */
+                while (!payload_sent && send_rv >= pending->iov_len)
+                {
+                    send_rv -= pending->iov_len;
+                    ++pending;
+                    --pending_count;
+                }
+                if (!payload_sent)
+                {
+                    pending->iov_base = static_cast<uint8_t*>(pending->iov_base) + send_rv;
+                    pending->iov_len -= send_rv;
+                }
             }
             else
             {
@@ -299,50 +359,22 @@ bool TCPv4Agent::send_message(
             }
             ++n_attemps;
         }
-        while (!size_sent && n_attemps < max_attemps);
-
-        /* Send message payload. */
-        bool payload_sent = false;
-        if (size_sent)
-        {
-            n_attemps = 0;
-            bytes_sent = 0;
-            do
-            {
-                size_t send_rv =
-                    send_data(
-                        connection,
-                        output_packet.message->get_buf() + bytes_sent,
-                        output_packet.message->get_len() - bytes_sent,
-                        transport_rc);
-                if (0 < send_rv)
-                {
-                    bytes_sent += uint16_t(send_rv);
-                    payload_sent = (bytes_sent == uint16_t(output_packet.message->get_len()));
-                }
-                else
-                {
-                    if (TransportRc::ok != transport_rc)
-                    {
-                        break;
-                    }
-                }
-                ++n_attemps;
-            }
-            while (!payload_sent && n_attemps < max_attemps);
-        }
+        while (!payload_sent && n_attemps < max_attemps);
 
         if (payload_sent)
         {
             rv = true;
 
-            uint32_t raw_client_key = 0u;
-            Server<IPv4EndPoint>::get_client_key(output_packet.destination, raw_client_key);
-            UXR_AGENT_LOG_MESSAGE(
-                UXR_DECORATE_YELLOW("[** <<TCP>> **]"),
-                raw_client_key,
-                output_packet.message->get_buf(),
-                output_packet.message->get_len());
+            if (UXR_AGENT_LOG_MESSAGE_ENABLED())
+            {
+                uint32_t raw_client_key = 0u;
+                Server<IPv4EndPoint>::get_client_key(output_packet.destination, raw_client_key);
+                UXR_AGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[** <<TCP>> **]"),
+                    raw_client_key,
+                    output_packet.message->get_buf(),
+                    output_packet.message->get_len());
+            }
         }
 
         if (TransportRc::connection_error == transport_rc)
@@ -360,6 +392,14 @@ bool TCPv4Agent::handle_error(
     return fini() && init();
 }
 
+void TCPv4Agent::fini_receiver(
+        size_t /* receiver */)
+{
+#ifdef UAGENT_IO_URING_PROFILE
+    ring_.fini();
+#endif
+}
+
 bool TCPv4Agent::open_connection(
         int fd,
         struct sockaddr_in& sockaddr)
@@ -374,11 +414,26 @@ bool TCPv4Agent::open_connection(
         connection.endpoint = IPv4EndPoint(sockaddr.sin_addr.s_addr, sockaddr.sin_port);
         connection.active = true;
         init_input_buffer(connection.input_buffer);
+#ifdef UAGENT_IO_URING_PROFILE
+        {
+            std::lock_guard<std::mutex> conn_lock(connection.mtx);
+            ++connection.generation;
+        }
+#endif
 
         endpoint_to_connection_map_[connection.endpoint] = connection.id;
         active_connections_.insert(id);
         free_connections_.pop_front();
         rv = true;
+
+#ifdef UAGENT_IO_URING_PROFILE
+        /* The receiver thread owns the ring, so it is the one arming the new connection. */
+        if (use_io_uring_)
+        {
+            arm_pending_ = true;
+            eventfd_write(wake_fd_, 1);
+        }
+#endif
     }
     return rv;
 }
@@ -393,6 +448,11 @@ bool TCPv4Agent::close_connection(
     {
         lock.unlock();
         std::unique_lock<std::mutex> conn_lock(connection.mtx);
+        if (use_io_uring_)
+        {
+            /* An armed io_uring receive keeps the socket open, the shutdown ends it. */
+            ::shutdown(connection.poll_fd->fd, SHUT_RDWR);
+        }
         if (0 == ::close(connection.poll_fd->fd))
         {
             connection.poll_fd->fd = -1;
@@ -422,6 +482,13 @@ bool TCPv4Agent::read_message(
         int timeout,
         TransportRc& transport_rc)
 {
+#ifdef UAGENT_IO_URING_PROFILE
+    if (use_io_uring_ && prepare_ring())
+    {
+        return read_ring_message(timeout, transport_rc);
+    }
+#endif
+
     std::unique_lock<std::mutex> lock(connections_mtx_);
     if (active_connections_.empty())
     {
@@ -472,6 +539,161 @@ bool TCPv4Agent::read_message(
     return rv;
 }
 
+#ifdef UAGENT_IO_URING_PROFILE
+bool TCPv4Agent::prepare_ring()
+{
+    if (ring_.is_init())
+    {
+        return true;
+    }
+
+    bool rv = (-1 != wake_fd_) && ring_.init(wake_fd_, SERVER_BUFFER_SIZE, io_uring_buffer_count);
+    if (rv)
+    {
+        /* Connections opened before the ring are armed on its first wait. */
+        for (auto& conn : connections_)
+        {
+            conn.ring_generation = 0;
+        }
+        arm_pending_ = true;
+    }
+    else
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("io_uring not available, using poll"),
+            "port: {}",
+            agent_port_);
+        use_io_uring_ = false;
+    }
+    return rv;
+}
+
+bool TCPv4Agent::read_ring_message(
+        int timeout,
+        TransportRc& transport_rc)
+{
+    if (arm_pending_.exchange(false))
+    {
+        arm_connections();
+    }
+
+    /* Every completion already queued is framed, the wait is only for the first one. */
+    bool rv = false;
+    util::IoUringStreamReceiver::Chunk chunk;
+    int receive_rv = ring_.receive(timeout, chunk);
+    while (0 < receive_rv)
+    {
+        rv = read_chunk(chunk) || rv;
+        receive_rv = ring_.receive(0, chunk);
+    }
+
+    if (0 > receive_rv)
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("io_uring error, using poll"),
+            "port: {}, errno: {}",
+            agent_port_, errno);
+        ring_.fini();
+        use_io_uring_ = false;
+    }
+
+    if (!rv)
+    {
+        transport_rc = TransportRc::timeout_error;
+    }
+    return rv;
+}
+
+void TCPv4Agent::arm_connections()
+{
+    std::unique_lock<std::mutex> lock(connections_mtx_);
+    const std::vector<uint32_t> active_connections(active_connections_.begin(), active_connections_.end());
+    lock.unlock();
+
+    for (uint32_t id : active_connections)
+    {
+        TCPv4ConnectionLinux& connection = connections_[size_t(id)];
+        std::lock_guard<std::mutex> conn_lock(connection.mtx);
+        if (connection.active && (connection.generation != connection.ring_generation))
+        {
+            if (ring_.add(connection.poll_fd->fd, (uint64_t(connection.generation) << 32) | id))
+            {
+                connection.ring_generation = connection.generation;
+            }
+            else
+            {
+                arm_pending_ = true;
+            }
+        }
+    }
+}
+
+bool TCPv4Agent::read_chunk(
+        const util::IoUringStreamReceiver::Chunk& chunk)
+{
+    bool rv = false;
+    const size_t id = size_t(uint32_t(chunk.stream));
+    const uint32_t generation = uint32_t(chunk.stream >> 32);
+    if (id < connections_.size())
+    {
+        TCPv4ConnectionLinux& connection = connections_[id];
+        std::unique_lock<std::mutex> conn_lock(connection.mtx);
+        bool current = connection.active && (generation == connection.generation);
+        conn_lock.unlock();
+
+        TransportRc transport_rc = TransportRc::ok;
+        if (current && (0 < chunk.len))
+        {
+            connection.ring_data = chunk.data;
+            connection.ring_len = chunk.len;
+            uint16_t bytes_read = 0;
+            do
+            {
+                bytes_read = read_data(connection, transport_rc);
+                if ((TransportRc::ok == transport_rc) && (0 < bytes_read))
+                {
+                    InputPacket<IPv4EndPoint> input_packet;
+                    input_packet.message.reset(new InputMessage(connection.input_buffer.buffer.data(), bytes_read));
+                    input_packet.source = connection.endpoint;
+                    messages_queue_.push(std::move(input_packet));
+                    rv = true;
+                }
+            }
+            while ((TransportRc::ok == transport_rc) && (0 < bytes_read));
+            connection.ring_data = nullptr;
+            connection.ring_len = 0;
+        }
+
+        if (current && !chunk.armed)
+        {
+            /* A receive that ran out of buffers goes on, one that saw the end of the stream does not. */
+            if ((0 < chunk.result) || (-ENOBUFS == chunk.result))
+            {
+                conn_lock.lock();
+                if (!connection.active || (generation != connection.generation) ||
+                    !ring_.add(connection.poll_fd->fd, chunk.stream))
+                {
+                    connection.ring_generation = 0;
+                    arm_pending_ = true;
+                }
+                conn_lock.unlock();
+            }
+            else
+            {
+                transport_rc = TransportRc::connection_error;
+            }
+        }
+
+        if (current && (TransportRc::connection_error == transport_rc))
+        {
+            close_connection(connection);
+        }
+    }
+    ring_.release(chunk);
+    return rv;
+}
+#endif
+
 void TCPv4Agent::listener_loop()
 {
     while (running_cond_)
@@ -514,6 +736,25 @@ size_t TCPv4Agent::recv_data(
 {
     size_t rv = 0;
     std::lock_guard<std::mutex> lock(connection.mtx);
+#ifdef UAGENT_IO_URING_PROFILE
+    if (connection.active && use_io_uring_)
+    {
+        /* The data comes from the completion being handled, once consumed it waits for the next. */
+        rv = std::min(len, connection.ring_len);
+        if (0 < rv)
+        {
+            memcpy(buffer, connection.ring_data, rv);
+            connection.ring_data += rv;
+            connection.ring_len -= rv;
+            transport_rc = TransportRc::ok;
+        }
+        else
+        {
+            transport_rc = TransportRc::timeout_error;
+        }
+    }
+    else
+#endif
     if (connection.active)
     {
         int poll_rv = poll(connection.poll_fd, 1, 0);
@@ -572,5 +813,36 @@ size_t TCPv4Agent::send_data(
     return rv;
 }
 
+size_t TCPv4Agent::send_data(
+        TCPv4ConnectionLinux& connection,
+        struct iovec* iov,
+        size_t iovcnt,
+        TransportRc& transport_rc)
+{
+    size_t rv = 0;
+    std::lock_guard<std::mutex> lock(connection.mtx);
+    if (connection.active)
+    {
+        struct msghdr msg{};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovcnt;
+        ssize_t bytes_sent = sendmsg(connection.poll_fd->fd, &msg, 0);
+        if (-1 != bytes_sent)
+        {
+            rv = size_t(bytes_sent);
+            transport_rc = TransportRc::ok;
+        }
+        else
+        {
+            transport_rc = TransportRc::connection_error;
+        }
+    }
+    else
+    {
+        transport_rc = TransportRc::connection_error;
+    }
+    return rv;
+}
+
 } // namespace uxr
 } // namespace eprosima
@@ -15,19 +15,29 @@
 #include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
 #include <uxr/agent/transport/util/InterfaceLinux.hpp>
 #include <uxr/agent/utils/Conversion.hpp>
+#include <uxr/agent/utils/ThreadSettings.hpp>
 #include <uxr/agent/logger/Logger.hpp>
 
+#include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <algorithm>
 #include <cstring>
 #include <cerrno>
 
 namespace eprosima {
 namespace uxr {
 
+#ifdef UAGENT_IO_URING_PROFILE
+/* Registered receive buffers of each ring, a power of two. */
+const uint16_t io_uring_buffer_count = 32;
+#endif
+
 #ifdef UAGENT_DISCOVERY_PROFILE
 extern template class DiscoveryServer<IPv4EndPoint>; // Explicit instantiation declaration.
 extern template class DiscoveryServerLinux<IPv4EndPoint>; // Explicit instantiation declaration.
@@ -35,11 +45,22 @@ extern template class DiscoveryServerLinux<IPv4EndPoint>; // Explicit instantiat
 
 UDPv4Agent::UDPv4Agent(
         uint16_t agent_port,
-        Middleware::Kind middleware_kind)
+        Middleware::Kind middleware_kind,
+        size_t socket_count,
+        bool io_uring)
     : Server<IPv4EndPoint>{middleware_kind}
-    , poll_fd_{-1, 0, 0}
-    , buffer_{0}
+    , poll_fds_(std::max(socket_count, size_t(1)), pollfd{-1, 0, 0})
+    , buffers_(poll_fds_.size())
     , agent_port_{agent_port}
+    , endpoint_shards_(poll_fds_.size())
+    , use_io_uring_{io_uring}
+    , receive_syscalls_{0}
+#ifdef UAGENT_IO_URING_PROFILE
+    , rings_(poll_fds_.size())
+    , ring_generations_(poll_fds_.size(), 0)
+    , ring_fallbacks_(poll_fds_.size(), 0)
+    , socket_generation_{0}
+#endif
 #ifdef UAGENT_DISCOVERY_PROFILE
     , discovery_server_{*processor_}
 #endif
@@ -65,12 +86,34 @@ UDPv4Agent::~UDPv4Agent()
 
 bool UDPv4Agent::init()
 {
-    bool rv = false;
-
-    poll_fd_.fd = socket(PF_INET, SOCK_DGRAM, 0);
+    bool rv = true;
+    const int reuse_port = 1;
 
-    if (-1 != poll_fd_.fd)
+    for (auto& poll_fd : poll_fds_)
     {
+        poll_fd.fd = socket(PF_INET, SOCK_DGRAM, 0);
+        if (-1 == poll_fd.fd)
+        {
+            UXR_AGENT_LOG_ERROR(
+                UXR_DECORATE_RED("socket error"),
+                "port: {}, errno: {}",
+                agent_port_, errno);
+            rv = false;
+            break;
+        }
+
+        /* Several sockets share the port, the kernel spreads the client flows among them. */
+        if ((1 < poll_fds_.size()) &&
+            (-1 == setsockopt(poll_fd.fd, SOL_SOCKET, SO_REUSEPORT, &reuse_port, sizeof(reuse_port))))
+        {
+            UXR_AGENT_LOG_ERROR(
+                UXR_DECORATE_RED("socket option error"),
+                "port: {}, errno: {}",
+                agent_port_, errno);
+            rv = false;
+            break;
+        }
+
         struct sockaddr_in address{};
 
         address.sin_family = AF_INET;
@@ -78,35 +121,52 @@ bool UDPv4Agent::init()
         address.sin_addr.s_addr = INADDR_ANY;
         memset(address.sin_zero, '\0', sizeof(address.sin_zero));
 
-        if (-1 != bind(poll_fd_.fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
-        {
-            poll_fd_.events = POLLIN;
-            rv = true;
-
-            UXR_AGENT_LOG_DEBUG(
-                UXR_DECORATE_GREEN("port opened"),
-                "port: {}",
-                agent_port_);
-
-            UXR_AGENT_LOG_INFO(
-                UXR_DECORATE_GREEN("running..."),
-                "port: {}",
-                agent_port_);
-        }
-        else
+        if (-1 == bind(poll_fd.fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
         {
             UXR_AGENT_LOG_ERROR(
                 UXR_DECORATE_RED("bind error"),
                 "port: {}, errno: {}",
                 agent_port_, errno);
+            rv = false;
+            break;
         }
+        poll_fd.events = POLLIN;
+    }
+
+    if (rv)
+    {
+#ifdef UAGENT_IO_URING_PROFILE
+        ++socket_generation_;
+#else
+        if (use_io_uring_)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("io_uring not built, using poll"),
+                "port: {}",
+                agent_port_);
+            use_io_uring_ = false;
+        }
+#endif
+        UXR_AGENT_LOG_DEBUG(
+            UXR_DECORATE_GREEN("port opened"),
+            "port: {}, sockets: {}",
+            agent_port_, poll_fds_.size());
+
+        UXR_AGENT_LOG_INFO(
+            UXR_DECORATE_GREEN("running..."),
+            "port: {}",
+            agent_port_);
     }
     else
     {
-        UXR_AGENT_LOG_ERROR(
-            UXR_DECORATE_RED("socket error"),
-            "port: {}, errno: {}",
-            agent_port_, errno);
+        for (auto& poll_fd : poll_fds_)
+        {
+            if (-1 != poll_fd.fd)
+            {
+                ::close(poll_fd.fd);
+                poll_fd.fd = -1;
+            }
+        }
     }
 
     return rv;
@@ -114,28 +174,39 @@ bool UDPv4Agent::init()
 
 bool UDPv4Agent::fini()
 {
-    if (-1 == poll_fd_.fd)
+    if (-1 == poll_fds_.front().fd)
     {
         return true;
     }
 
-    bool rv = false;
-    if (0 == ::close(poll_fd_.fd))
+    bool rv = true;
+    for (auto& poll_fd : poll_fds_)
+    {
+        if (-1 == poll_fd.fd)
+        {
+            continue;
+        }
+        if (0 == ::close(poll_fd.fd))
+        {
+            poll_fd.fd = -1;
+        }
+        else
+        {
+            rv = false;
+            UXR_AGENT_LOG_ERROR(
+                UXR_DECORATE_RED("socket error"),
+                "port: {}, errno: {}",
+                agent_port_, errno);
+        }
+    }
+
+    if (rv)
     {
-        poll_fd_.fd = -1;
-        rv = true;
         UXR_AGENT_LOG_INFO(
             UXR_DECORATE_GREEN("server stopped"),
             "port: {}",
             agent_port_);
     }
-    else
-    {
-        UXR_AGENT_LOG_ERROR(
-            UXR_DECORATE_RED("socket error"),
-            "port: {}, errno: {}",
-            agent_port_, errno);
-    }
     return rv;
 }
 
@@ -175,29 +246,110 @@ bool UDPv4Agent::recv_message(
         InputPacket<IPv4EndPoint>& input_packet,
         int timeout,
         TransportRc& transport_rc)
+{
+    return recv_message(input_packet, timeout, transport_rc, 0);
+}
+
+void UDPv4Agent::init_receiver(
+        size_t receiver)
+{
+    /* Each socket is drained from its own core, taken from the receiver CPU set if there is one. */
+    if (1 < poll_fds_.size())
+    {
+        const std::vector<uint16_t> cpus = utils::ThreadSettings::get_policy(utils::ThreadKind::RECEIVER).cpus;
+        const unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+        const size_t core = cpus.empty() ? (receiver % cores) : cpus[receiver % cpus.size()];
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(core, &cpu_set);
+        if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set))
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("receiver affinity error"),
+                "receiver: {}, core: {}",
+                receiver, core);
+        }
+    }
+}
+
+void UDPv4Agent::fini_receiver(
+        size_t receiver)
+{
+#ifdef UAGENT_IO_URING_PROFILE
+    /* The ring holds the socket while its receive is armed, so it goes before the socket is closed. */
+    rings_[receiver].fini();
+    ring_generations_[receiver] = 0;
+#else
+    (void) receiver;
+#endif
+}
+
+bool UDPv4Agent::recv_message(
+        InputPacket<IPv4EndPoint>& input_packet,
+        int timeout,
+        TransportRc& transport_rc,
+        size_t receiver)
 {
     bool rv = false;
     struct sockaddr_in client_addr{};
     socklen_t client_addr_len = sizeof(struct sockaddr_in);
 
-    int poll_rv = poll(&poll_fd_, 1, timeout);
-    if (0 < poll_rv)
+    uint8_t* buffer = buffers_[receiver].data();
+    ssize_t bytes_received = -1;
+    int wait_rv = 0;
+
+#ifdef UAGENT_IO_URING_PROFILE
+    util::IoUringReceiver::Datagram datagram;
+    const bool from_ring = use_io_uring_ && (0 == ring_fallbacks_[receiver]) && prepare_ring(receiver);
+    if (from_ring)
+    {
+        const uint64_t enter_count = rings_[receiver].get_enter_count();
+        wait_rv = rings_[receiver].receive(timeout, datagram);
+        receive_syscalls_ += rings_[receiver].get_enter_count() - enter_count;
+        if (0 < wait_rv)
+        {
+            memcpy(&client_addr, datagram.source, sizeof(client_addr));
+            buffer = const_cast<uint8_t*>(datagram.data);
+            bytes_received = ssize_t(datagram.len);
+        }
+    }
+#else
+    const bool from_ring = false;
+#endif
+
+    if (!from_ring)
+    {
+        struct pollfd& poll_fd = poll_fds_[receiver];
+        wait_rv = poll(&poll_fd, 1, timeout);
+        ++receive_syscalls_;
+        if (0 < wait_rv)
+        {
+            ++receive_syscalls_;
+            bytes_received =
+                    recvfrom(poll_fd.fd,
+                             buffer,
+                             SERVER_BUFFER_SIZE,
+                             0,
+                             reinterpret_cast<struct sockaddr*>(&client_addr),
+                             &client_addr_len);
+        }
+    }
+
+    if (0 < wait_rv)
     {
-        ssize_t bytes_received =
-                recvfrom(poll_fd_.fd,
-                         buffer_,
-                         sizeof(buffer_),
-                         0,
-                         reinterpret_cast<struct sockaddr*>(&client_addr),
-                         &client_addr_len);
         if (-1 != bytes_received)
         {
-            input_packet.message.reset(new InputMessage(buffer_, size_t(bytes_received)));
+            input_packet.message.reset(new InputMessage(buffer, size_t(bytes_received)));
             uint32_t addr = client_addr.sin_addr.s_addr;
             uint16_t port = client_addr.sin_port;
             input_packet.source = IPv4EndPoint(addr, port);
             rv = true;
 
+            if (1 < poll_fds_.size())
+            {
+                track_endpoint(receiver, input_packet.source);
+            }
+
             uint32_t raw_client_key = 0u;
             Server<IPv4EndPoint>::get_client_key(input_packet.source, raw_client_key);
             UXR_AGENT_LOG_MESSAGE(
@@ -213,12 +365,55 @@ bool UDPv4Agent::recv_message(
     }
     else
     {
-        transport_rc = (0 == poll_rv) ? TransportRc::timeout_error : TransportRc::server_error;
+        transport_rc = (0 == wait_rv) ? TransportRc::timeout_error : TransportRc::server_error;
     }
 
+#ifdef UAGENT_IO_URING_PROFILE
+    if (from_ring)
+    {
+        if (0 < wait_rv)
+        {
+            rings_[receiver].release(datagram);
+        }
+        else if (0 > wait_rv)
+        {
+            /* Lets the socket go before the error handler reopens it. */
+            fini_receiver(receiver);
+        }
+    }
+#endif
+
     return rv;
 }
 
+#ifdef UAGENT_IO_URING_PROFILE
+bool UDPv4Agent::prepare_ring(
+        size_t receiver)
+{
+    const uint32_t generation = socket_generation_;
+    if (generation == ring_generations_[receiver])
+    {
+        return true;
+    }
+
+    rings_[receiver].fini();
+    bool rv = rings_[receiver].init(poll_fds_[receiver].fd, SERVER_BUFFER_SIZE, io_uring_buffer_count);
+    if (rv)
+    {
+        ring_generations_[receiver] = generation;
+    }
+    else
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("io_uring not available, using poll"),
+            "port: {}, receiver: {}",
+            agent_port_, receiver);
+        ring_fallbacks_[receiver] = 1;
+    }
+    return rv;
+}
+#endif
+
 bool UDPv4Agent::send_message(
         OutputPacket<IPv4EndPoint> output_packet,
         TransportRc& transport_rc)
@@ -231,26 +426,35 @@ bool UDPv4Agent::send_message(
     client_addr.sin_port = output_packet.destination.get_port();
     client_addr.sin_addr.s_addr = output_packet.destination.get_addr();
 
-    ssize_t bytes_sent =
-        sendto(
-            poll_fd_.fd,
-            output_packet.message->get_buf(),
-            output_packet.message->get_len(),
-            0,
-            reinterpret_cast<struct sockaddr*>(&client_addr),
-            sizeof(client_addr));
+    /* Fragments are gathered from their header and the shared payload. */
+    struct iovec iov[2];
+    iov[0].iov_base = const_cast<uint8_t*>(output_packet.message->get_head_buf());
+    iov[0].iov_len = output_packet.message->get_head_len();
+    iov[1].iov_base = const_cast<uint8_t*>(output_packet.message->get_payload_buf());
+    iov[1].iov_len = output_packet.message->get_payload_len();
+
+    struct msghdr msg{};
+    msg.msg_name = &client_addr;
+    msg.msg_namelen = sizeof(client_addr);
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (0 == iov[1].iov_len) ? 1 : 2;
+
+    ssize_t bytes_sent = sendmsg(poll_fds_[get_socket(output_packet.destination)].fd, &msg, 0);
     if (-1 != bytes_sent)
     {
         if (size_t(bytes_sent) == output_packet.message->get_len())
         {
             rv = true;
-            uint32_t raw_client_key = 0u;
-            Server<IPv4EndPoint>::get_client_key(output_packet.destination, raw_client_key);
-            UXR_AGENT_LOG_MESSAGE(
-                UXR_DECORATE_YELLOW("[** <<UDP>> **]"),
-                raw_client_key,
-                output_packet.message->get_buf(),
-                output_packet.message->get_len());
+            if (UXR_AGENT_LOG_MESSAGE_ENABLED())
+            {
+                uint32_t raw_client_key = 0u;
+                Server<IPv4EndPoint>::get_client_key(output_packet.destination, raw_client_key);
+                UXR_AGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[** <<UDP>> **]"),
+                    raw_client_key,
+                    output_packet.message->get_buf(),
+                    output_packet.message->get_len());
+            }
         }
     }
     else
@@ -261,6 +465,53 @@ bool UDPv4Agent::send_message(
     return rv;
 }
 
+void UDPv4Agent::track_endpoint(
+        size_t receiver,
+        const IPv4EndPoint& source)
+{
+    using LastSeen = std::pair<const IPv4EndPoint, std::chrono::steady_clock::time_point>;
+
+    const auto now = std::chrono::steady_clock::now();
+    EndPointShard& shard = endpoint_shards_[receiver];
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.last_seen.find(source);
+    if (shard.last_seen.end() != it)
+    {
+        it->second = now;
+    }
+    else
+    {
+        if (UDP_TRACKED_ENDPOINTS <= shard.last_seen.size())
+        {
+            /* The least recently seen endpoint makes room, so active clients keep their socket. */
+            shard.last_seen.erase(std::min_element(shard.last_seen.begin(), shard.last_seen.end(),
+                    [](const LastSeen& lhs, const LastSeen& rhs) { return lhs.second < rhs.second; }));
+        }
+        shard.last_seen.emplace(source, now);
+    }
+}
+
+size_t UDPv4Agent::get_socket(
+        const IPv4EndPoint& destination)
+{
+    size_t rv = 0;
+    if (1 < poll_fds_.size())
+    {
+        std::chrono::steady_clock::time_point newest{};
+        for (size_t i = 0; i < endpoint_shards_.size(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(endpoint_shards_[i].mtx);
+            auto it = endpoint_shards_[i].last_seen.find(destination);
+            if ((endpoint_shards_[i].last_seen.end() != it) && (newest < it->second))
+            {
+                newest = it->second;
+                rv = i;
+            }
+        }
+    }
+    return rv;
+}
+
 bool UDPv4Agent::handle_error(
         TransportRc /*transport_rc*/)
 {
@@ -0,0 +1,259 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/unix/UnixDatagramAgentLinux.hpp>
+#include <uxr/agent/transport/util/UnixSocketLinux.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+
+UnixDatagramAgent::UnixDatagramAgent(
+        const std::string& path,
+        Middleware::Kind middleware_kind)
+    : Server<UnixEndPoint>{middleware_kind}
+    , path_{path}
+    , poll_fd_{-1, 0, 0}
+    , buffer_{}
+{}
+
+UnixDatagramAgent::~UnixDatagramAgent()
+{
+    try
+    {
+        stop();
+    }
+    catch (std::exception& e)
+    {
+        UXR_AGENT_LOG_CRITICAL(
+            UXR_DECORATE_RED("error stopping server"),
+            "exception: {}",
+            e.what());
+    }
+}
+
+bool UnixDatagramAgent::init()
+{
+    bool rv = false;
+    struct sockaddr_un address{};
+    socklen_t address_len = 0;
+
+    if (!util::to_unix_address(util::to_unix_path(path_), address, address_len))
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("invalid socket path"),
+            "path: {}",
+            path_);
+        return false;
+    }
+
+    poll_fd_.fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (-1 != poll_fd_.fd)
+    {
+        util::remove_stale_socket(util::to_unix_path(path_));
+        if (-1 != bind(poll_fd_.fd, reinterpret_cast<struct sockaddr*>(&address), address_len))
+        {
+            poll_fd_.events = POLLIN;
+            rv = true;
+
+            UXR_AGENT_LOG_INFO(
+                UXR_DECORATE_GREEN("running..."),
+                "path: {}",
+                path_);
+        }
+        else
+        {
+            UXR_AGENT_LOG_ERROR(
+                UXR_DECORATE_RED("bind error"),
+                "path: {}, errno: {}",
+                path_, errno);
+            ::close(poll_fd_.fd);
+            poll_fd_.fd = -1;
+        }
+    }
+    else
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("socket error"),
+            "path: {}, errno: {}",
+            path_, errno);
+    }
+
+    return rv;
+}
+
+bool UnixDatagramAgent::fini()
+{
+    if (-1 == poll_fd_.fd)
+    {
+        return true;
+    }
+
+    bool rv = false;
+    if (0 == ::close(poll_fd_.fd))
+    {
+        util::remove_stale_socket(util::to_unix_path(path_));
+        UXR_AGENT_LOG_INFO(
+            UXR_DECORATE_GREEN("server stopped"),
+            "path: {}",
+            path_);
+        rv = true;
+    }
+    else
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("socket error"),
+            "path: {}, errno: {}",
+            path_, errno);
+    }
+
+    poll_fd_.fd = -1;
+    return rv;
+}
+
+bool UnixDatagramAgent::recv_message(
+        InputPacket<UnixEndPoint>& input_packet,
+        int timeout,
+        TransportRc& transport_rc)
+{
+    bool rv = false;
+    struct sockaddr_un client_addr{};
+    socklen_t client_addr_len = sizeof(client_addr);
+
+    int poll_rv = poll(&poll_fd_, 1, timeout);
+    if (0 < poll_rv)
+    {
+        ssize_t bytes_received =
+                recvfrom(poll_fd_.fd,
+                         buffer_.data(),
+                         buffer_.size(),
+                         0,
+                         reinterpret_cast<struct sockaddr*>(&client_addr),
+                         &client_addr_len);
+        if (-1 != bytes_received)
+        {
+            std::string client_path = util::from_unix_address(client_addr, client_addr_len);
+            if (client_path.empty())
+            {
+                /* An unbound client socket has no address to reply to. */
+                transport_rc = TransportRc::connection_error;
+                UXR_AGENT_LOG_DEBUG(
+                    UXR_DECORATE_YELLOW("unnamed client dropped"),
+                    "path: {}, len: {}",
+                    path_, bytes_received);
+            }
+            else
+            {
+                input_packet.message.reset(new InputMessage(buffer_.data(), size_t(bytes_received)));
+                input_packet.source = UnixEndPoint(client_path);
+                rv = true;
+
+                uint32_t raw_client_key = 0u;
+                Server<UnixEndPoint>::get_client_key(input_packet.source, raw_client_key);
+                UXR_AGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[==>> UNIX <<==]"),
+                    raw_client_key,
+                    input_packet.message->get_buf(),
+                    input_packet.message->get_len());
+            }
+        }
+        else
+        {
+            transport_rc = TransportRc::server_error;
+        }
+    }
+    else
+    {
+        transport_rc = (0 == poll_rv) ? TransportRc::timeout_error : TransportRc::server_error;
+    }
+
+    return rv;
+}
+
+bool UnixDatagramAgent::send_message(
+        OutputPacket<UnixEndPoint> output_packet,
+        TransportRc& transport_rc)
+{
+    bool rv = false;
+    struct sockaddr_un client_addr{};
+    socklen_t client_addr_len = 0;
+    if (!util::to_unix_address(output_packet.destination.get_path(), client_addr, client_addr_len))
+    {
+        transport_rc = TransportRc::connection_error;
+        return false;
+    }
+
+    /* Fragments are gathered from their header and the shared payload. */
+    struct iovec iov[2];
+    iov[0].iov_base = const_cast<uint8_t*>(output_packet.message->get_head_buf());
+    iov[0].iov_len = output_packet.message->get_head_len();
+    iov[1].iov_base = const_cast<uint8_t*>(output_packet.message->get_payload_buf());
+    iov[1].iov_len = output_packet.message->get_payload_len();
+
+    struct msghdr msg{};
+    msg.msg_name = &client_addr;
+    msg.msg_namelen = client_addr_len;
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (0 == iov[1].iov_len) ? 1 : 2;
+
+    /* Unlike UDP a full client queue blocks the sender, so the message is dropped instead. */
+    ssize_t bytes_sent = sendmsg(poll_fd_.fd, &msg, MSG_DONTWAIT);
+    if (-1 != bytes_sent)
+    {
+        if (size_t(bytes_sent) == output_packet.message->get_len())
+        {
+            rv = true;
+            if (UXR_AGENT_LOG_MESSAGE_ENABLED())
+            {
+                uint32_t raw_client_key = 0u;
+                Server<UnixEndPoint>::get_client_key(output_packet.destination, raw_client_key);
+                UXR_AGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[** <<UNIX>> **]"),
+                    raw_client_key,
+                    output_packet.message->get_buf(),
+                    output_packet.message->get_len());
+            }
+        }
+    }
+    else if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+    {
+        transport_rc = TransportRc::timeout_error;
+    }
+    else if ((ECONNREFUSED == errno) || (ENOENT == errno))
+    {
+        transport_rc = TransportRc::connection_error;
+    }
+    else
+    {
+        transport_rc = TransportRc::server_error;
+    }
+
+    return rv;
+}
+
+bool UnixDatagramAgent::handle_error(
+        TransportRc /*transport_rc*/)
+{
+    return fini() && init();
+}
+
+} // namespace uxr
+} // namespace eprosima
@@ -0,0 +1,357 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/unix/UnixStreamAgentLinux.hpp>
+#include <uxr/agent/transport/util/UnixSocketLinux.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+
+constexpr size_t UnixStreamAgent::max_connections;
+
+UnixStreamAgent::UnixStreamAgent(
+        const std::string& path,
+        Middleware::Kind middleware_kind)
+    : Server<UnixEndPoint>{middleware_kind}
+    , path_{path}
+    , poll_fds_(max_connections + 1, pollfd{-1, 0, 0})
+    , endpoints_(max_connections + 1)
+    , endpoint_to_connection_map_{}
+    , connections_mtx_{}
+    , next_connection_{0}
+    , accepted_connections_{0}
+    , buffer_{}
+{}
+
+UnixStreamAgent::~UnixStreamAgent()
+{
+    try
+    {
+        stop();
+    }
+    catch (std::exception& e)
+    {
+        UXR_AGENT_LOG_CRITICAL(
+            UXR_DECORATE_RED("error stopping server"),
+            "exception: {}",
+            e.what());
+    }
+}
+
+bool UnixStreamAgent::init()
+{
+    bool rv = false;
+    struct sockaddr_un address{};
+    socklen_t address_len = 0;
+
+    if (!util::to_unix_address(util::to_unix_path(path_), address, address_len))
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("invalid socket path"),
+            "path: {}",
+            path_);
+        return false;
+    }
+
+    struct pollfd& listener = poll_fds_.front();
+    listener.fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (-1 != listener.fd)
+    {
+        util::remove_stale_socket(util::to_unix_path(path_));
+        if ((-1 != bind(listener.fd, reinterpret_cast<struct sockaddr*>(&address), address_len)) &&
+            (-1 != listen(listener.fd, int(max_connections))))
+        {
+            listener.events = POLLIN;
+            for (size_t i = 1; i < poll_fds_.size(); ++i)
+            {
+                poll_fds_[i] = pollfd{-1, POLLIN, 0};
+            }
+            next_connection_ = 0;
+            rv = true;
+
+            UXR_AGENT_LOG_INFO(
+                UXR_DECORATE_GREEN("running..."),
+                "path: {}",
+                path_);
+        }
+        else
+        {
+            UXR_AGENT_LOG_ERROR(
+                UXR_DECORATE_RED("bind error"),
+                "path: {}, errno: {}",
+                path_, errno);
+            ::close(listener.fd);
+            listener.fd = -1;
+        }
+    }
+    else
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("socket error"),
+            "path: {}, errno: {}",
+            path_, errno);
+    }
+
+    return rv;
+}
+
+bool UnixStreamAgent::fini()
+{
+    struct pollfd& listener = poll_fds_.front();
+    if (-1 == listener.fd)
+    {
+        return true;
+    }
+
+    for (size_t i = 1; i < poll_fds_.size(); ++i)
+    {
+        close_connection(i);
+    }
+
+    bool rv = false;
+    if (0 == ::close(listener.fd))
+    {
+        util::remove_stale_socket(util::to_unix_path(path_));
+        UXR_AGENT_LOG_INFO(
+            UXR_DECORATE_GREEN("server stopped"),
+            "path: {}",
+            path_);
+        rv = true;
+    }
+    else
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("socket error"),
+            "path: {}, errno: {}",
+            path_, errno);
+    }
+
+    listener.fd = -1;
+    return rv;
+}
+
+bool UnixStreamAgent::recv_message(
+        InputPacket<UnixEndPoint>& input_packet,
+        int timeout,
+        TransportRc& transport_rc)
+{
+    bool rv = false;
+
+    int poll_rv = poll(poll_fds_.data(), nfds_t(poll_fds_.size()), timeout);
+    if (0 < poll_rv)
+    {
+        const short listener_events = poll_fds_.front().revents;
+        if (0 != (listener_events & (POLLERR | POLLNVAL)))
+        {
+            transport_rc = TransportRc::server_error;
+            return false;
+        }
+        if (0 != (listener_events & POLLIN))
+        {
+            accept_connection();
+        }
+
+        /* One message per call, starting after the last connection served so that none is starved. */
+        for (size_t i = 0; !rv && (i < max_connections); ++i)
+        {
+            const size_t connection = 1 + (next_connection_ + i) % max_connections;
+            struct pollfd& poll_fd = poll_fds_[connection];
+            if ((-1 == poll_fd.fd) || (0 == poll_fd.revents))
+            {
+                continue;
+            }
+
+            ssize_t bytes_received = recv(poll_fd.fd, buffer_.data(), buffer_.size(), MSG_DONTWAIT);
+            if (0 < bytes_received)
+            {
+                input_packet.message.reset(new InputMessage(buffer_.data(), size_t(bytes_received)));
+                input_packet.source = endpoints_[connection];
+                next_connection_ = connection % max_connections;
+                rv = true;
+
+                uint32_t raw_client_key = 0u;
+                Server<UnixEndPoint>::get_client_key(input_packet.source, raw_client_key);
+                UXR_AGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[==>> UNIX <<==]"),
+                    raw_client_key,
+                    input_packet.message->get_buf(),
+                    input_packet.message->get_len());
+            }
+            else if ((0 == bytes_received) || ((EAGAIN != errno) && (EWOULDBLOCK != errno)))
+            {
+                close_connection(connection);
+            }
+        }
+
+        if (!rv)
+        {
+            transport_rc = TransportRc::timeout_error;
+        }
+    }
+    else
+    {
+        transport_rc = (0 == poll_rv) ? TransportRc::timeout_error : TransportRc::server_error;
+    }
+
+    return rv;
+}
+
+bool UnixStreamAgent::send_message(
+        OutputPacket<UnixEndPoint> output_packet,
+        TransportRc& transport_rc)
+{
+    bool rv = false;
+
+    /* Fragments are gathered from their header and the shared payload. */
+    struct iovec iov[2];
+    iov[0].iov_base = const_cast<uint8_t*>(output_packet.message->get_head_buf());
+    iov[0].iov_len = output_packet.message->get_head_len();
+    iov[1].iov_base = const_cast<uint8_t*>(output_packet.message->get_payload_buf());
+    iov[1].iov_len = output_packet.message->get_payload_len();
+
+    struct msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (0 == iov[1].iov_len) ? 1 : 2;
+
+    std::unique_lock<std::mutex> lock(connections_mtx_);
+    auto it = endpoint_to_connection_map_.find(output_packet.destination);
+    if (endpoint_to_connection_map_.end() == it)
+    {
+        transport_rc = TransportRc::connection_error;
+        return false;
+    }
+
+    /* A closed or stalled peer is left to the receiver, which drops the connection on hang-up. */
+    ssize_t bytes_sent = sendmsg(poll_fds_[it->second].fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    lock.unlock();
+
+    if (-1 != bytes_sent)
+    {
+        if (size_t(bytes_sent) == output_packet.message->get_len())
+        {
+            rv = true;
+            if (UXR_AGENT_LOG_MESSAGE_ENABLED())
+            {
+                uint32_t raw_client_key = 0u;
+                Server<UnixEndPoint>::get_client_key(output_packet.destination, raw_client_key);
+                UXR_AGENT_LOG_MESSAGE(
+                    UXR_DECORATE_YELLOW("[** <<UNIX>> **]"),
+                    raw_client_key,
+                    output_packet.message->get_buf(),
+                    output_packet.message->get_len());
+            }
+        }
+    }
+    else
+    {
+        transport_rc = ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+            ? TransportRc::timeout_error
+            : TransportRc::connection_error;
+    }
+
+    return rv;
+}
+
+bool UnixStreamAgent::handle_error(
+        TransportRc /*transport_rc*/)
+{
+    return fini() && init();
+}
+
+void UnixStreamAgent::accept_connection()
+{
+    int fd = accept4(poll_fds_.front().fd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (-1 == fd)
+    {
+        return;
+    }
+
+    struct ucred credentials{};
+    socklen_t credentials_len = sizeof(credentials);
+    if (-1 == getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &credentials_len))
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("peer credentials error"),
+            "path: {}, errno: {}",
+            path_, errno);
+        ::close(fd);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(connections_mtx_);
+    size_t connection = 1;
+    while ((connection < poll_fds_.size()) && (-1 != poll_fds_[connection].fd))
+    {
+        ++connection;
+    }
+    if (poll_fds_.size() == connection)
+    {
+        lock.unlock();
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("connection refused"),
+            "path: {}, pid: {}, connections: {}",
+            path_, credentials.pid, max_connections);
+        ::close(fd);
+        return;
+    }
+
+    const UnixEndPoint endpoint(
+        uint32_t(credentials.pid), uint32_t(credentials.uid), uint32_t(credentials.gid), ++accepted_connections_);
+    poll_fds_[connection] = pollfd{fd, POLLIN, 0};
+    endpoints_[connection] = endpoint;
+    endpoint_to_connection_map_[endpoint] = connection;
+    lock.unlock();
+
+    UXR_AGENT_LOG_DEBUG(
+        UXR_DECORATE_GREEN("connection opened"),
+        "path: {}, pid: {}, uid: {}, connection: {}",
+        path_, credentials.pid, credentials.uid, endpoint.get_connection());
+}
+
+void UnixStreamAgent::close_connection(
+        size_t connection)
+{
+    std::lock_guard<std::mutex> lock(connections_mtx_);
+    struct pollfd& poll_fd = poll_fds_[connection];
+    if (-1 == poll_fd.fd)
+    {
+        return;
+    }
+
+    ::close(poll_fd.fd);
+    poll_fd.fd = -1;
+    poll_fd.revents = 0;
+
+    auto it = endpoint_to_connection_map_.find(endpoints_[connection]);
+    if ((endpoint_to_connection_map_.end() != it) && (connection == it->second))
+    {
+        endpoint_to_connection_map_.erase(it);
+    }
+
+    UXR_AGENT_LOG_DEBUG(
+        UXR_DECORATE_GREEN("connection closed"),
+        "path: {}, pid: {}",
+        path_, endpoints_[connection].get_pid());
+}
+
+} // namespace uxr
+} // namespace eprosima
@@ -0,0 +1,514 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/util/IoUringLinux.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace eprosima {
+namespace uxr {
+namespace util {
+
+namespace {
+
+/* Submissions of the receivers: the receive of the socket and the wake up read. */
+const unsigned receiver_entries = 4;
+
+/* User data of the wake up read, the streams use any other value. */
+const uint64_t wake_stream = UINT64_MAX;
+
+void* map_memory(
+        size_t size,
+        int fd,
+        off_t offset)
+{
+    void* ptr = (-1 == fd)
+        ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+        : mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    return (MAP_FAILED == ptr) ? nullptr : ptr;
+}
+
+void unmap_memory(
+        void*& ptr,
+        size_t& size)
+{
+    if (nullptr != ptr)
+    {
+        munmap(ptr, size);
+        ptr = nullptr;
+        size = 0;
+    }
+}
+
+} // namespace
+
+IoUring::~IoUring()
+{
+    fini();
+}
+
+bool IoUring::init(
+        unsigned entries,
+        unsigned completion_entries)
+{
+    if (-1 != ring_fd_)
+    {
+        return false;
+    }
+
+    struct io_uring_params params{};
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = completion_entries;
+    ring_fd_ = int(syscall(__NR_io_uring_setup, entries, &params));
+    if (-1 == ring_fd_)
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("io_uring setup error"),
+            "errno: {}",
+            errno);
+        return false;
+    }
+    sq_entries_ = params.sq_entries;
+
+    /* Waiting with a timeout needs the extended arguments of io_uring_enter. */
+    bool rv = (0 != (params.features & IORING_FEAT_EXT_ARG));
+    if (rv)
+    {
+        sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        if (0 != (params.features & IORING_FEAT_SINGLE_MMAP))
+        {
+            sq_size_ = std::max(sq_size_, cq_size_);
+            cq_size_ = 0;
+        }
+        sq_ptr_ = map_memory(sq_size_, ring_fd_, IORING_OFF_SQ_RING);
+        cq_ptr_ = (0 == cq_size_) ? sq_ptr_ : map_memory(cq_size_, ring_fd_, IORING_OFF_CQ_RING);
+        sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+        sqes_ = static_cast<struct io_uring_sqe*>(map_memory(sqes_size_, ring_fd_, IORING_OFF_SQES));
+        rv = (nullptr != sq_ptr_) && (nullptr != cq_ptr_) && (nullptr != sqes_);
+    }
+
+    if (rv)
+    {
+        uint8_t* sq = static_cast<uint8_t*>(sq_ptr_);
+        uint8_t* cq = static_cast<uint8_t*>(cq_ptr_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+    else
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("io_uring init error"),
+            "features: {:#x}, errno: {}",
+            params.features, errno);
+        fini();
+    }
+    return rv;
+}
+
+bool IoUring::init_buffers(
+        size_t buffer_size,
+        uint16_t buffer_count)
+{
+    if ((-1 == ring_fd_) || (nullptr != buf_ring_) || (0 == buffer_count) ||
+        (0 != (buffer_count & (buffer_count - 1))))
+    {
+        return false;
+    }
+
+    buffer_size_ = buffer_size;
+    buffer_count_ = buffer_count;
+    buf_ring_size_ = buffer_count * sizeof(struct io_uring_buf);
+    buf_ring_ = static_cast<struct io_uring_buf_ring*>(map_memory(buf_ring_size_, -1, 0));
+    buffers_size_ = buffer_count * buffer_size_;
+    buffers_ = static_cast<uint8_t*>(map_memory(buffers_size_, -1, 0));
+    bool rv = (nullptr != buf_ring_) && (nullptr != buffers_);
+
+    if (rv)
+    {
+        struct io_uring_buf_reg reg{};
+        reg.ring_addr = reinterpret_cast<uint64_t>(buf_ring_);
+        reg.ring_entries = buffer_count;
+        reg.bgid = buffer_group;
+        rv = (0 == syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1));
+    }
+
+    if (rv)
+    {
+        for (uint16_t i = 0; i < buffer_count; ++i)
+        {
+            add_buffer(i);
+        }
+    }
+    else
+    {
+        UXR_AGENT_LOG_ERROR(
+            UXR_DECORATE_RED("io_uring buffers error"),
+            "errno: {}",
+            errno);
+        fini();
+    }
+    return rv;
+}
+
+void IoUring::fini()
+{
+    void* sqes = sqes_;
+    void* buf_ring = buf_ring_;
+    void* buffers = buffers_;
+    unmap_memory(sqes, sqes_size_);
+    unmap_memory(buf_ring, buf_ring_size_);
+    unmap_memory(buffers, buffers_size_);
+    if (cq_ptr_ != sq_ptr_)
+    {
+        unmap_memory(cq_ptr_, cq_size_);
+    }
+    unmap_memory(sq_ptr_, sq_size_);
+    if (-1 != ring_fd_)
+    {
+        ::close(ring_fd_);
+    }
+
+    ring_fd_ = -1;
+    sq_entries_ = 0;
+    cq_ptr_ = nullptr;
+    sqes_ = nullptr;
+    buf_ring_ = nullptr;
+    buffers_ = nullptr;
+    buffer_count_ = 0;
+    buf_ring_tail_ = 0;
+}
+
+struct io_uring_sqe* IoUring::get_sqe(
+        uint8_t opcode,
+        int fd,
+        uint64_t user_data)
+{
+    if ((*sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) && !submit(0, -1))
+    {
+        return nullptr;
+    }
+
+    const unsigned tail = *sq_tail_;
+    const unsigned index = tail & *sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->user_data = user_data;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    return sqe;
+}
+
+bool IoUring::submit(
+        unsigned min_complete,
+        int timeout)
+{
+    const unsigned to_submit = *sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if ((0 == to_submit) && (0 == min_complete))
+    {
+        return true;
+    }
+
+    unsigned flags = 0;
+    struct __kernel_timespec ts{};
+    struct io_uring_getevents_arg arg{};
+    void* argp = nullptr;
+    size_t argsz = 0;
+    if (0 < min_complete)
+    {
+        flags |= IORING_ENTER_GETEVENTS;
+        if (0 <= timeout)
+        {
+            ts.tv_sec = timeout / 1000;
+            ts.tv_nsec = (timeout % 1000) * 1000000;
+            arg.ts = reinterpret_cast<uint64_t>(&ts);
+            flags |= IORING_ENTER_EXT_ARG;
+            argp = &arg;
+            argsz = sizeof(arg);
+        }
+    }
+    ++enter_count_;
+    const long rv = syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete, flags, argp, argsz);
+    return (-1 != rv) || (ETIME == errno) || (EINTR == errno);
+}
+
+bool IoUring::pop(
+        Completion& completion)
+{
+    const unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    const struct io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+    completion.user_data = cqe.user_data;
+    completion.res = cqe.res;
+    completion.flags = cqe.flags;
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint8_t* IoUring::get_buffer(
+        uint16_t buffer_id) const
+{
+    return buffers_ + buffer_id * buffer_size_;
+}
+
+void IoUring::add_buffer(
+        uint16_t buffer_id)
+{
+    /* Entries start at the ring address. In C++ the flexible array of the header sits past an empty struct. */
+    struct io_uring_buf* buf =
+            reinterpret_cast<struct io_uring_buf*>(buf_ring_) + (buf_ring_tail_ & (buffer_count_ - 1));
+    buf->addr = reinterpret_cast<uint64_t>(get_buffer(buffer_id));
+    buf->len = uint32_t(buffer_size_);
+    buf->bid = buffer_id;
+    ++buf_ring_tail_;
+    __atomic_store_n(&buf_ring_->tail, buf_ring_tail_, __ATOMIC_RELEASE);
+}
+
+IoUringReceiver::~IoUringReceiver()
+{
+    fini();
+}
+
+bool IoUringReceiver::init(
+        int fd,
+        size_t buffer_size,
+        uint16_t buffer_count)
+{
+    /* Each buffer holds at most one pending completion. */
+    bool rv = !ring_.is_init() && ring_.init(receiver_entries, 2u * buffer_count);
+
+    /* Each buffer starts with the recvmsg header and the source address, then the payload. */
+    rv = rv && ring_.init_buffers(
+        sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_storage) + buffer_size, buffer_count);
+
+    if (rv)
+    {
+        socket_fd_ = fd;
+        msg_ = msghdr{};
+        msg_.msg_namelen = sizeof(struct sockaddr_storage);
+        rv = arm();
+        if (!rv)
+        {
+            fini();
+        }
+    }
+    return rv;
+}
+
+void IoUringReceiver::fini()
+{
+    ring_.fini();
+    socket_fd_ = -1;
+    armed_ = false;
+}
+
+int IoUringReceiver::receive(
+        int timeout,
+        Datagram& datagram)
+{
+    for (;;)
+    {
+        IoUring::Completion cqe;
+        if (!ring_.pop(cqe))
+        {
+            /* A multishot receive stops when it runs out of buffers or fails, and is armed again here. */
+            if ((!armed_ && !arm()) || !ring_.submit(1, timeout))
+            {
+                return -1;
+            }
+            if (!ring_.pop(cqe))
+            {
+                return 0;
+            }
+        }
+
+        if (0 == (cqe.flags & IORING_CQE_F_MORE))
+        {
+            armed_ = false;
+        }
+
+        if (0 == (cqe.flags & IORING_CQE_F_BUFFER))
+        {
+            if ((0 > cqe.res) && (-ENOBUFS != cqe.res))
+            {
+                errno = -cqe.res;
+                return -1;
+            }
+            continue;
+        }
+
+        const uint16_t buffer_id = uint16_t(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        uint8_t* buffer = ring_.get_buffer(buffer_id);
+        const struct io_uring_recvmsg_out* out = reinterpret_cast<const struct io_uring_recvmsg_out*>(buffer);
+        if ((0 > cqe.res) || (0 != (out->flags & MSG_TRUNC)))
+        {
+            ring_.add_buffer(buffer_id);
+            continue;
+        }
+
+        datagram.source = reinterpret_cast<const struct sockaddr*>(buffer + sizeof(*out));
+        datagram.data = buffer + sizeof(*out) + msg_.msg_namelen + msg_.msg_controllen;
+        datagram.len = out->payloadlen;
+        datagram.buffer_id = buffer_id;
+        return 1;
+    }
+}
+
+void IoUringReceiver::release(
+        const Datagram& datagram)
+{
+    ring_.add_buffer(datagram.buffer_id);
+}
+
+bool IoUringReceiver::arm()
+{
+    struct io_uring_sqe* sqe = ring_.get_sqe(IORING_OP_RECVMSG, socket_fd_, 0);
+    if (nullptr == sqe)
+    {
+        return false;
+    }
+    sqe->addr = reinterpret_cast<uint64_t>(&msg_);
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = IoUring::buffer_group;
+
+    armed_ = ring_.submit(0, -1);
+    return armed_;
+}
+
+IoUringStreamReceiver::~IoUringStreamReceiver()
+{
+    fini();
+}
+
+bool IoUringStreamReceiver::init(
+        int wake_fd,
+        size_t buffer_size,
+        uint16_t buffer_count)
+{
+    /* Streams that fill every buffer at once each add a completion that ends their receive. */
+    bool rv = !ring_.is_init() && ring_.init(receiver_entries, 4u * buffer_count);
+    rv = rv && ring_.init_buffers(buffer_size, buffer_count);
+    if (rv)
+    {
+        wake_fd_ = wake_fd;
+        rv = arm_wake();
+        if (!rv)
+        {
+            fini();
+        }
+    }
+    return rv;
+}
+
+void IoUringStreamReceiver::fini()
+{
+    ring_.fini();
+    wake_fd_ = -1;
+    wake_armed_ = false;
+}
+
+bool IoUringStreamReceiver::add(
+        int fd,
+        uint64_t stream)
+{
+    struct io_uring_sqe* sqe = ring_.get_sqe(IORING_OP_RECV, fd, stream);
+    if (nullptr == sqe)
+    {
+        return false;
+    }
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = IoUring::buffer_group;
+    return true;
+}
+
+int IoUringStreamReceiver::receive(
+        int timeout,
+        Chunk& chunk)
+{
+    IoUring::Completion cqe;
+    if (!ring_.pop(cqe))
+    {
+        if ((!wake_armed_ && !arm_wake()) || !ring_.submit((0 == timeout) ? 0 : 1, timeout))
+        {
+            return -1;
+        }
+        if (!ring_.pop(cqe))
+        {
+            return 0;
+        }
+    }
+
+    if (wake_stream == cqe.user_data)
+    {
+        wake_armed_ = false;
+        return (0 > cqe.res) && (-EINTR != cqe.res) ? -1 : 0;
+    }
+
+    chunk.stream = cqe.user_data;
+    chunk.result = cqe.res;
+    chunk.armed = (0 != (cqe.flags & IORING_CQE_F_MORE));
+    chunk.has_buffer = (0 != (cqe.flags & IORING_CQE_F_BUFFER));
+    chunk.buffer_id = chunk.has_buffer ? uint16_t(cqe.flags >> IORING_CQE_BUFFER_SHIFT) : 0;
+    chunk.data = chunk.has_buffer ? ring_.get_buffer(chunk.buffer_id) : nullptr;
+    chunk.len = (chunk.has_buffer && (0 < cqe.res)) ? size_t(cqe.res) : 0;
+    return 1;
+}
+
+void IoUringStreamReceiver::release(
+        const Chunk& chunk)
+{
+    if (chunk.has_buffer)
+    {
+        ring_.add_buffer(chunk.buffer_id);
+    }
+}
+
+bool IoUringStreamReceiver::arm_wake()
+{
+    struct io_uring_sqe* sqe = ring_.get_sqe(IORING_OP_READ, wake_fd_, wake_stream);
+    if (nullptr != sqe)
+    {
+        sqe->addr = reinterpret_cast<uint64_t>(&wake_value_);
+        sqe->len = sizeof(wake_value_);
+        wake_armed_ = true;
+    }
+    return wake_armed_;
+}
+
+} // namespace util
+} // namespace uxr
+} // namespace eprosima
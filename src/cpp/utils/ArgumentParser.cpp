@@ -33,7 +33,7 @@ bool eprosima::uxr::agent::parser::utils::usage(
     std::stringstream ss;
     ss << "Usage: '" << executable_name_str << " <udp4|udp6|tcp4|tpc6";
 #ifndef _WIN32
-    ss << "|canfd|serial|multiserial|pseudoterminal";
+    ss << "|canfd|serial|multiserial|pseudoterminal|unixdgram|unixstream";
 #endif // _WIN32
     ss << "> <<args>>'" << std::endl;
     if (no_help)
@@ -57,6 +57,10 @@ eprosima::uxr::agent::TransportKind eprosima::uxr::agent::parser::utils::check_t
 #ifdef UAGENT_SOCKETCAN_PROFILE
     {"canfd", eprosima::uxr::agent::TransportKind::CAN},
 #endif // UAGENT_SOCKETCAN_PROFILE
+#ifdef UAGENT_UNIX_PROFILE
+    {"unixdgram", eprosima::uxr::agent::TransportKind::UNIX_DGRAM},
+    {"unixstream", eprosima::uxr::agent::TransportKind::UNIX_STREAM},
+#endif // UAGENT_UNIX_PROFILE
     {"serial", eprosima::uxr::agent::TransportKind::SERIAL},
     {"multiserial", eprosima::uxr::agent::TransportKind::MULTISERIAL},
     {"pseudoterminal", eprosima::uxr::agent::TransportKind::PSEUDOTERMINAL},
@@ -0,0 +1,262 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/utils/ThreadSettings.hpp>
+#include <uxr/agent/logger/Logger.hpp>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <mutex>
+#include <sstream>
+
+namespace eprosima {
+namespace uxr {
+namespace utils {
+
+namespace {
+
+const size_t thread_kind_count = size_t(ThreadKind::MIDDLEWARE) + 1;
+const uint16_t max_cpu = 1023;
+const int min_rt_priority = 1;
+const int max_rt_priority = 99;
+
+std::mutex& registry_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+std::array<ThreadPolicy, thread_kind_count>& registry()
+{
+    static std::array<ThreadPolicy, thread_kind_count> policies;
+    return policies;
+}
+
+std::vector<std::string> split(
+        const std::string& str,
+        char delimiter)
+{
+    std::vector<std::string> tokens;
+    std::stringstream ss(str);
+    std::string token;
+    while (std::getline(ss, token, delimiter))
+    {
+        tokens.push_back(token);
+    }
+    if (!str.empty() && (delimiter == str.back()))
+    {
+        tokens.emplace_back();
+    }
+    return tokens;
+}
+
+bool parse_number(
+        const std::string& str,
+        unsigned long max,
+        unsigned long& number)
+{
+    bool rv = !str.empty() && (10 > str.size()) && std::all_of(str.begin(), str.end(), ::isdigit);
+    if (rv)
+    {
+        number = std::stoul(str);
+        rv = (max >= number);
+    }
+    return rv;
+}
+
+bool parse_cpus(
+        const std::string& str,
+        std::vector<uint16_t>& cpus)
+{
+    cpus.clear();
+    if (str.empty() || ("*" == str))
+    {
+        return true;
+    }
+
+    for (const std::string& range : split(str, ','))
+    {
+        std::vector<std::string> bounds = split(range, '-');
+        unsigned long first;
+        unsigned long last;
+        if ((1 == bounds.size()) && parse_number(bounds[0], max_cpu, first))
+        {
+            last = first;
+        }
+        else if ((2 != bounds.size()) ||
+                 !parse_number(bounds[0], max_cpu, first) ||
+                 !parse_number(bounds[1], max_cpu, last) ||
+                 (first > last))
+        {
+            return false;
+        }
+
+        for (unsigned long cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(uint16_t(cpu));
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return true;
+}
+
+} // namespace
+
+void ThreadSettings::set_policy(
+        ThreadKind kind,
+        const ThreadPolicy& policy)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry()[size_t(kind)] = policy;
+}
+
+ThreadPolicy ThreadSettings::get_policy(
+        ThreadKind kind)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    return registry()[size_t(kind)];
+}
+
+bool ThreadSettings::apply(
+        ThreadKind kind,
+        const std::string& name)
+{
+    bool rv = true;
+#ifndef _WIN32
+#ifdef __linux__
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#endif
+    const ThreadPolicy policy = get_policy(kind);
+
+#ifdef __linux__
+    if (!policy.cpus.empty())
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (uint16_t cpu : policy.cpus)
+        {
+            CPU_SET(cpu, &cpu_set);
+        }
+        int errcode = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        if (0 != errcode)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("thread affinity error"),
+                "thread: {}, errno: {}",
+                name, errcode);
+            rv = false;
+        }
+    }
+#endif
+
+    if (SchedulingPolicy::DEFAULT != policy.scheduling)
+    {
+        struct sched_param param{};
+        param.sched_priority = policy.priority;
+        int errcode = pthread_setschedparam(
+            pthread_self(), (SchedulingPolicy::FIFO == policy.scheduling) ? SCHED_FIFO : SCHED_RR, &param);
+        if (0 != errcode)
+        {
+            UXR_AGENT_LOG_WARN(
+                UXR_DECORATE_YELLOW("thread scheduling error"),
+                "thread: {}, priority: {}, errno: {}",
+                name, policy.priority, errcode);
+            rv = false;
+        }
+    }
+#else
+    (void) name;
+    rv = get_policy(kind).is_default();
+#endif
+    return rv;
+}
+
+bool ThreadSettings::lock_memory()
+{
+    bool rv = false;
+#ifndef _WIN32
+    rv = (0 == mlockall(MCL_CURRENT | MCL_FUTURE));
+    if (!rv)
+    {
+        UXR_AGENT_LOG_WARN(
+            UXR_DECORATE_YELLOW("memory lock error"),
+            "errno: {}",
+            errno);
+    }
+#endif
+    return rv;
+}
+
+bool ThreadSettings::parse_policy(
+        const std::string& spec,
+        ThreadPolicy& policy)
+{
+    ThreadPolicy parsed;
+    std::vector<std::string> fields = split(spec, ':');
+    if (fields.empty() || (3 < fields.size()) || !parse_cpus(fields[0], parsed.cpus))
+    {
+        return false;
+    }
+
+    if (1 < fields.size())
+    {
+        if ("fifo" == fields[1])
+        {
+            parsed.scheduling = SchedulingPolicy::FIFO;
+        }
+        else if ("rr" == fields[1])
+        {
+            parsed.scheduling = SchedulingPolicy::RR;
+        }
+        else if ("other" != fields[1])
+        {
+            return false;
+        }
+    }
+
+    /* Real-time policies need a priority, the time-sharing one takes none. */
+    if (SchedulingPolicy::DEFAULT == parsed.scheduling)
+    {
+        if (3 == fields.size())
+        {
+            return false;
+        }
+    }
+    else
+    {
+        unsigned long priority;
+        if ((3 != fields.size()) ||
+            !parse_number(fields[2], max_rt_priority, priority) ||
+            (min_rt_priority > int(priority)))
+        {
+            return false;
+        }
+        parsed.priority = int(priority);
+    }
+
+    policy = parsed;
+    return true;
+}
+
+} // namespace utils
+} // namespace uxr
+} // namespace eprosima
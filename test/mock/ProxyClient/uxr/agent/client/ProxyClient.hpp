@@ -18,6 +18,10 @@
 #include <uxr/agent/middleware/Middleware.hpp>
 #include <uxr/agent/types/XRCETypes.hpp>
 #include <uxr/agent/client/session/Session.hpp>
+#include <uxr/agent/utils/OverloadControl.hpp>
+#ifdef UAGENT_SNAPSHOT_PROFILE
+#include <uxr/agent/client/ClientSnapshot.hpp>
+#endif
 
 #include <gmock/gmock.h>
 
@@ -45,6 +49,18 @@ public:
     MOCK_METHOD0(session, Session&());
 
     void release() {}
+
+    void set_overload_control(
+            std::shared_ptr<utils::OverloadControl> /*overload_control*/) {}
+
+#ifdef UAGENT_SNAPSHOT_PROFILE
+    void enable_snapshot(
+            std::shared_ptr<ClientSnapshot> /*snapshot*/) {}
+
+    bool restore(
+            std::shared_ptr<ClientSnapshot> /*snapshot*/,
+            const std::vector<std::pair<dds::xrce::ObjectId, dds::xrce::ObjectVariant>>& /*objects*/) { return true; }
+#endif
 };
 
 } // namespace uxr
@@ -14,6 +14,14 @@
 
 #include "Common.h"
 
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#endif
+
 namespace eprosima {
 namespace uxr {
 namespace testing {
@@ -185,6 +193,73 @@ dds::xrce::DATA_Payload_Data CommonData::generate_data_payload_data() const
     data_payload.data(sample);
     return data_payload;
 }
+
+std::vector<uint8_t> create_client_message(
+        uint8_t key)
+{
+    return std::vector<uint8_t>{
+        0x80, 0x00, 0x00, 0x00,                     // Message header.
+        0x00, 0x01, 0x18, 0x00,                     // CREATE_CLIENT submessage header.
+        'X', 'R', 'C', 'E', 0x01, 0x00, 0x0F, 0x0F, // Cookie, version and vendor.
+        0xAA, 0xBB, 0xCC, key,                      // Client key.
+        0x81, 0x00, 0x00, 0x02};                    // Session id, properties and MTU.
+}
+
+bool is_status_agent(
+        const uint8_t* message,
+        size_t len)
+{
+    return (12 <= len) && (status_agent_id == message[4]);
+}
+
+#ifndef _WIN32
+bool create_client(
+        int fd,
+        uint8_t key,
+        uint8_t* status)
+{
+    std::vector<uint8_t> message = create_client_message(key);
+    uint8_t reply[64];
+    if (ssize_t(message.size()) != send(fd, message.data(), message.size(), 0))
+    {
+        return false;
+    }
+
+    const ssize_t bytes = recv(fd, reply, sizeof(reply), 0);
+    if ((0 > bytes) || !is_status_agent(reply, size_t(bytes)))
+    {
+        return false;
+    }
+    if (nullptr != status)
+    {
+        *status = reply[8];
+    }
+    return true;
+}
+
+size_t count_rings()
+{
+    size_t count = 0;
+    DIR* dir = opendir("/proc/self/fd");
+    if (nullptr != dir)
+    {
+        struct dirent* entry;
+        while (nullptr != (entry = readdir(dir)))
+        {
+            char target[64] = {};
+            const std::string link = std::string("/proc/self/fd/") + entry->d_name;
+            if ((0 < readlink(link.c_str(), target, sizeof(target) - 1)) &&
+                (std::string("anon_inode:[io_uring]") == target))
+            {
+                ++count;
+            }
+        }
+        closedir(dir);
+    }
+    return count;
+}
+#endif
+
 } // namespace testing
 } // namespace uxr
 } // namespace eprosima
@@ -19,6 +19,10 @@
 #include <uxr/agent/types/MessageHeader.hpp>
 #include <uxr/agent/types/SubMessageHeader.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace eprosima {
 namespace uxr {
 namespace testing {
@@ -55,6 +59,39 @@ class CommonData
     dds::xrce::WRITE_DATA_Payload_Data generate_write_data_payload() const;
     dds::xrce::DATA_Payload_Data generate_data_payload_data() const;
 };
+
+/* STATUS_AGENT submessage id, the reply to a CREATE_CLIENT. */
+const uint8_t status_agent_id = 0x04;
+
+/**
+ * @brief Serialized CREATE_CLIENT of the client 0xAABBCC<key>, on the session 0x81.
+ */
+std::vector<uint8_t> create_client_message(
+        uint8_t key);
+
+/**
+ * @brief Whether a received message is a STATUS_AGENT, its status being at offset 8.
+ */
+bool is_status_agent(
+        const uint8_t* message,
+        size_t len);
+
+#ifndef _WIN32
+/**
+ * @brief Sends a CREATE_CLIENT through a connected message socket and tells whether a STATUS_AGENT
+ *        came back, storing its status if asked to.
+ */
+bool create_client(
+        int fd,
+        uint8_t key,
+        uint8_t* status = nullptr);
+
+/**
+ * @brief Number of io_uring instances open in the process.
+ */
+size_t count_rings();
+#endif
+
 } // namespace testing
 } // namespace uxr
 } // namespace eprosima
@@ -0,0 +1,121 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/message/InputMessage.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace eprosima;
+using namespace eprosima::uxr;
+
+namespace {
+
+/* Reliable message carrying a lone HEARTBEAT, the kind classified for the priority lane. */
+const std::vector<uint8_t> heartbeat_message = {
+    0x81, 0x80, 0x00, 0x00,
+    0x0B, 0x01, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80};
+
+/* Reliable message carrying a WRITE_DATA of 256 bytes. */
+std::vector<uint8_t> write_data_message()
+{
+    std::vector<uint8_t> buf = {0x81, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x01};
+    buf.resize(buf.size() + 256, 0xAA);
+    return buf;
+}
+
+/* Subheader scans made by the receiver before the single-pass classification. */
+size_t legacy_count_submessages(
+        fastcdr::FastBuffer& fastbuffer)
+{
+    fastcdr::Cdr deserializer(fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1);
+    dds::xrce::MessageHeader header;
+    dds::xrce::SubmessageHeader subheader;
+    header.deserialize(deserializer);
+
+    size_t count = 0;
+    deserializer.jump((4 - ((deserializer.get_current_position() - deserializer.get_buffer_pointer()) & 3)) & 3);
+    if (fastbuffer.getBufferSize() > deserializer.get_serialized_data_length())
+    {
+        try
+        {
+            subheader.deserialize(deserializer);
+            count++;
+        }
+        catch (fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+        }
+    }
+    return count;
+}
+
+dds::xrce::SubmessageId legacy_get_submessage_id(
+        fastcdr::FastBuffer& fastbuffer)
+{
+    fastcdr::Cdr deserializer(fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1);
+    dds::xrce::MessageHeader header;
+    dds::xrce::SubmessageHeader subheader;
+    header.deserialize(deserializer);
+
+    deserializer.jump((4 - ((deserializer.get_current_position() - deserializer.get_buffer_pointer()) & 3)) & 3);
+    if (fastbuffer.getBufferSize() > deserializer.get_serialized_data_length())
+    {
+        subheader.deserialize(deserializer);
+    }
+    return subheader.submessage_id();
+}
+
+} // namespace
+
+/* Per-packet cost of the former reception path: copy, header, and three scans of the subheaders. */
+static void BM_ClassifyLegacy(
+        benchmark::State& state)
+{
+    const std::vector<uint8_t> message = (0 == state.range(0)) ? heartbeat_message : write_data_message();
+    for (auto _ : state)
+    {
+        std::unique_ptr<uint8_t[]> buf(new uint8_t[message.size()]);
+        std::memcpy(buf.get(), message.data(), message.size());
+        fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(buf.get()), message.size());
+        fastcdr::Cdr deserializer(fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv1);
+        dds::xrce::MessageHeader header;
+        header.deserialize(deserializer);
+
+        bool valid = (0 < legacy_count_submessages(fastbuffer));
+        bool priority = valid &&
+            (1 == legacy_count_submessages(fastbuffer)) &&
+            (dds::xrce::HEARTBEAT == legacy_get_submessage_id(fastbuffer));
+        benchmark::DoNotOptimize(priority);
+    }
+}
+BENCHMARK(BM_ClassifyLegacy)->ArgNames({"write_data"})->Arg(0)->Arg(1);
+
+/* Per-packet cost of the single-pass classification done while building the InputMessage. */
+static void BM_ClassifySinglePass(
+        benchmark::State& state)
+{
+    std::vector<uint8_t> message = (0 == state.range(0)) ? heartbeat_message : write_data_message();
+    for (auto _ : state)
+    {
+        InputMessage input_message(message.data(), message.size());
+        const MessageSummary& summary = input_message.get_summary();
+        bool priority = summary.is_only(dds::xrce::HEARTBEAT) || summary.is_only(dds::xrce::ACKNACK);
+        benchmark::DoNotOptimize(priority);
+    }
+}
+BENCHMARK(BM_ClassifySinglePass)->ArgNames({"write_data"})->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
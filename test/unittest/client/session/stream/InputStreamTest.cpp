@@ -340,6 +340,76 @@ TEST_F(ReliableInputStreamTest, FillAcknack)
     }
 }
 
+TEST_F(ReliableInputStreamTest, FragmentReassembly)
+{
+    /* Inner message: a HEARTBEAT submessage, split into fragments of different sizes. */
+    const uint8_t header[4] = {0x81, 0x80, 0x00, 0x00};
+    std::vector<uint8_t> inner = {0x0B, 0x01, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80};
+    inner.resize(inner.size() + 3 * FRAGMENT_BUFFER_SIZE, 0xAA);
+    const size_t fragment_sizes[] = {3, FRAGMENT_BUFFER_SIZE, inner.size() - FRAGMENT_BUFFER_SIZE - 3};
+
+    for (int round = 0; round < 2; ++round)
+    {
+        InputMessagePtr input_message;
+        size_t offset = 0;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const size_t fragment_size = fragment_sizes[i];
+            const uint8_t flags = uint8_t(0x01 | ((2 == i) ? dds::xrce::FLAG_LAST_FRAGMENT : 0));
+            std::vector<uint8_t> buf(std::begin(header), std::end(header));
+            buf.insert(buf.end(), {dds::xrce::FRAGMENT, flags, uint8_t(fragment_size), uint8_t(fragment_size >> 8)});
+            buf.insert(buf.end(), inner.begin() + offset, inner.begin() + offset + fragment_size);
+            offset += fragment_size;
+
+            input_message.reset(new InputMessage(buf.data(), buf.size()));
+            ASSERT_TRUE(input_message->prepare_next_submessage());
+            reliable_stream_.push_fragment(input_message);
+            ASSERT_EQ(2 == i, reliable_stream_.pop_fragment_message(input_message));
+        }
+
+        ASSERT_EQ(sizeof(header) + inner.size(), input_message->get_len());
+        EXPECT_EQ(0, memcmp(header, input_message->get_buf(), sizeof(header)));
+        EXPECT_EQ(0, memcmp(inner.data(), input_message->get_buf() + sizeof(header), inner.size()));
+        EXPECT_TRUE(input_message->is_valid_xrce_message());
+        EXPECT_FALSE(reliable_stream_.pop_fragment_message(input_message));
+    }
+}
+
+/****************************************************************************************
+ * Input Message.
+ ****************************************************************************************/
+TEST(InputMessageTest, Summary)
+{
+    /* HEARTBEAT followed by an ACKNACK aligned to 4 bytes. */
+    const uint8_t buf[] = {
+        0x81, 0x80, 0x00, 0x00,
+        0x0B, 0x01, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00,
+        0x0A, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80};
+
+    InputMessage message(const_cast<uint8_t*>(buf), sizeof(buf));
+    const MessageSummary& summary = message.get_summary();
+    EXPECT_TRUE(summary.valid);
+    EXPECT_EQ(0x81, summary.session_id);
+    EXPECT_EQ(0x80, summary.stream_id);
+    EXPECT_EQ(2u, summary.submessage_count);
+    EXPECT_EQ(dds::xrce::HEARTBEAT, summary.first_submessage_id);
+    EXPECT_TRUE(summary.has(dds::xrce::HEARTBEAT));
+    EXPECT_TRUE(summary.has(dds::xrce::ACKNACK));
+    EXPECT_FALSE(summary.has(dds::xrce::WRITE_DATA));
+    EXPECT_FALSE(summary.is_only(dds::xrce::HEARTBEAT));
+
+    /* The summary does not move the deserializer. */
+    ASSERT_TRUE(message.prepare_next_submessage());
+    EXPECT_EQ(dds::xrce::HEARTBEAT, message.get_subheader().submessage_id());
+
+    InputMessage lone(const_cast<uint8_t*>(buf), 13);
+    EXPECT_TRUE(lone.get_summary().is_only(dds::xrce::HEARTBEAT));
+
+    InputMessage empty(const_cast<uint8_t*>(buf), 4);
+    EXPECT_FALSE(empty.is_valid_xrce_message());
+    EXPECT_FALSE(empty.get_summary().is_only(dds::xrce::HEARTBEAT));
+}
+
 } // namespace testing
 } // namespace uxr
 } // namespace eprosima
@@ -14,9 +14,12 @@
 
 
 #include <uxr/agent/client/session/stream/OutputStream.hpp>
+#include <atomic>
+#include <cstring>
 #include <map>
 #include <queue>
 #include <mutex>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -300,6 +303,69 @@ TEST_F(ReliableOutputStreamTest, Fragmentation)
     }
 }
 
+/**
+ * @brief   This test checks that the fragments are views of a single serialized submessage,
+ *          and that their contiguous form matches the header followed by the payload.
+ */
+TEST_F(ReliableOutputStreamTest, FragmentsShareSerializedBuffer)
+{
+    dds::xrce::MessageHeader header{};
+    header.session_id(session_id);
+    header.client_key(client_key);
+    dds::xrce::SubmessageHeader subheader{};
+    dds::xrce::WRITE_DATA_Payload_Data write_data{};
+    write_data.data().serialized_data().resize(4 * mtu);
+    for (size_t i = 0; i < write_data.data().serialized_data().size(); ++i)
+    {
+        write_data.data().serialized_data()[i] = uint8_t(i);
+    }
+
+    ASSERT_TRUE(reliable_stream_.push_submessage(
+        session_info_,
+        stream_id_,
+        dds::xrce::WRITE_DATA,
+        write_data,
+        std::chrono::milliseconds(500)));
+
+    const size_t head_size = header.getCdrSerializedSize() + subheader.getCdrSerializedSize();
+    const uint8_t* expected_payload = nullptr;
+    size_t total_payload = 0;
+    OutputMessagePtr output_message;
+    SeqNum seq_num = 0;
+    while (reliable_stream_.get_next_message(output_message))
+    {
+        ASSERT_EQ(head_size, output_message->get_head_len());
+        ASSERT_LT(0u, output_message->get_payload_len());
+        ASSERT_GE(mtu, output_message->get_len());
+        if (nullptr != expected_payload)
+        {
+            ASSERT_EQ(expected_payload, output_message->get_payload_buf());
+        }
+        else
+        {
+            ASSERT_EQ(dds::xrce::WRITE_DATA, output_message->get_payload_buf()[0]);
+        }
+        expected_payload = output_message->get_payload_buf() + output_message->get_payload_len();
+        total_payload += output_message->get_payload_len();
+
+        ASSERT_EQ(0, std::memcmp(
+            output_message->get_buf(),
+            output_message->get_head_buf(),
+            output_message->get_head_len()));
+        ASSERT_EQ(0, std::memcmp(
+            output_message->get_buf() + output_message->get_head_len(),
+            output_message->get_payload_buf(),
+            output_message->get_payload_len()));
+
+        /* Retransmissions hand out the same message. */
+        OutputMessagePtr retransmission;
+        ASSERT_TRUE(reliable_stream_.get_message(seq_num, retransmission));
+        ASSERT_EQ(output_message.get(), retransmission.get());
+        seq_num += 1;
+    }
+    ASSERT_EQ(subheader.getCdrSerializedSize() + write_data.getCdrSerializedSize(), total_payload);
+}
+
 /**
  * @brief   This test checks the initial conditions of the reliable stream.
  */
@@ -466,6 +532,114 @@ TEST_F(ReliableOutputStreamTest, UpdateFromAcknack)
     ASSERT_EQ(hearbeat.last_unacked_seq_nr(), expected_last_unacked);
 }
 
+/**
+ * @brief   This test checks the credits advertised by the reliable stream.
+ *          A free slot is needed per fragment, and acknowledged messages give their slots back.
+ */
+TEST_F(ReliableOutputStreamTest, Credits)
+{
+    dds::xrce::MessageHeader header{};
+    header.session_id(session_id);
+    header.client_key(client_key);
+    dds::xrce::SubmessageHeader subheader{};
+    dds::xrce::WRITE_DATA_Payload_Data write_data{};
+
+    const size_t max_fragment_size = mtu - header.getCdrSerializedSize() - subheader.getCdrSerializedSize();
+    const size_t small_size = write_data.getCdrSerializedSize();
+    const size_t three_fragments_size = 2 * max_fragment_size;
+
+    ASSERT_EQ(size_t(RELIABLE_STREAM_DEPTH), reliable_stream_.available_slots());
+    for (int i = 0; i < RELIABLE_STREAM_DEPTH; ++i)
+    {
+        ASSERT_TRUE(reliable_stream_.wait_for_credits(session_info_, small_size, std::chrono::milliseconds(0)));
+        ASSERT_TRUE(reliable_stream_.push_submessage(
+            session_info_,
+            stream_id_,
+            dds::xrce::WRITE_DATA,
+            write_data,
+            std::chrono::milliseconds(0)));
+    }
+    ASSERT_EQ(0u, reliable_stream_.available_slots());
+    ASSERT_FALSE(reliable_stream_.wait_for_credits(session_info_, small_size, std::chrono::milliseconds(10)));
+
+    OutputMessagePtr output_message;
+    while (reliable_stream_.get_next_message(output_message))
+    {}
+
+    reliable_stream_.update_from_acknack(2);
+    ASSERT_EQ(2u, reliable_stream_.available_slots());
+    ASSERT_TRUE(reliable_stream_.wait_for_credits(session_info_, small_size, std::chrono::milliseconds(0)));
+    ASSERT_FALSE(reliable_stream_.wait_for_credits(
+        session_info_, three_fragments_size, std::chrono::milliseconds(10)));
+
+    reliable_stream_.update_from_acknack(3);
+    ASSERT_TRUE(reliable_stream_.wait_for_credits(
+        session_info_, three_fragments_size, std::chrono::milliseconds(0)));
+}
+
+/**
+ * @brief   This test checks a producer paced by the credits of a slow consumer.
+ *          The producer shall be woken up by the acknacks and never find the window full.
+ */
+TEST_F(ReliableOutputStreamTest, SlowConsumer)
+{
+    const size_t sample_count = 4 * RELIABLE_STREAM_DEPTH;
+    dds::xrce::WRITE_DATA_Payload_Data write_data{};
+    write_data.data().serialized_data().resize(64);
+    const size_t submessage_size = write_data.getCdrSerializedSize();
+
+    std::atomic<size_t> failed_pushes{0};
+    std::atomic<bool> running{true};
+    std::thread producer([&]()
+    {
+        size_t produced = 0;
+        while (running && (produced < sample_count))
+        {
+            if (reliable_stream_.wait_for_credits(session_info_, submessage_size, std::chrono::milliseconds(100)))
+            {
+                if (!reliable_stream_.push_submessage(
+                        session_info_,
+                        stream_id_,
+                        dds::xrce::WRITE_DATA,
+                        write_data,
+                        std::chrono::milliseconds(0)))
+                {
+                    ++failed_pushes;
+                }
+                ++produced;
+            }
+        }
+    });
+
+    SeqNum first_unacked = 0x0000;
+    size_t received = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((received < sample_count) && (std::chrono::steady_clock::now() < deadline))
+    {
+        OutputMessagePtr output_message;
+        if (reliable_stream_.get_next_message(output_message))
+        {
+            OutputMessagePtr expected_message;
+            ASSERT_TRUE(reliable_stream_.get_message(first_unacked, expected_message));
+            ASSERT_EQ(expected_message.get(), output_message.get());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            first_unacked += 1;
+            reliable_stream_.update_from_acknack(first_unacked);
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    running = false;
+    producer.join();
+    ASSERT_EQ(sample_count, received);
+    ASSERT_EQ(0u, failed_pushes);
+    ASSERT_EQ(size_t(RELIABLE_STREAM_DEPTH), reliable_stream_.available_slots());
+}
+
 } // namespace testing
 } // namespace uxr
 } // namespace eprosima
@@ -0,0 +1,143 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/Root.hpp>
+#include <uxr/agent/utils/Conversion.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const std::string snapshot_path = "/tmp/uxr-snapshot-benchmark-" + std::to_string(getpid()) + ".bin";
+
+dds::xrce::CLIENT_Representation client_representation()
+{
+    dds::xrce::CLIENT_Representation client;
+    client.xrce_cookie(dds::xrce::XRCE_COOKIE);
+    client.xrce_version(dds::xrce::XRCE_VERSION);
+    client.client_key(conversion::raw_to_clientkey(0xAABBCCDD));
+    client.session_id(0x01);
+    client.mtu(512);
+    return client;
+}
+
+/* Requests of a client with a participant, a publisher and one topic and datawriter per index. */
+std::vector<std::pair<uint16_t, dds::xrce::ObjectVariant>> client_requests(
+        uint16_t datawriters)
+{
+    std::vector<std::pair<uint16_t, dds::xrce::ObjectVariant>> requests;
+    dds::xrce::ObjectVariant variant;
+
+    dds::xrce::OBJK_PARTICIPANT_Representation participant;
+    participant.domain_id(0);
+    participant.representation().object_reference("participant");
+    variant.participant(participant);
+    requests.emplace_back(0x0001, variant);
+
+    dds::xrce::OBJK_PUBLISHER_Representation publisher;
+    publisher.participant_id(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PARTICIPANT));
+    publisher.representation().string_representation("");
+    variant.publisher(publisher);
+    requests.emplace_back(0x0001, variant);
+
+    for (uint16_t i = 1; i <= datawriters; ++i)
+    {
+        const std::string topic_name = "rt/snapshot_" + std::to_string(i);
+
+        dds::xrce::OBJK_TOPIC_Representation topic;
+        topic.participant_id(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PARTICIPANT));
+        topic.representation().object_reference(topic_name);
+        variant.topic(topic);
+        requests.emplace_back(i, variant);
+
+        dds::xrce::DATAWRITER_Representation datawriter;
+        datawriter.publisher_id(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PUBLISHER));
+        datawriter.representation().object_reference(topic_name);
+        variant.data_writer(datawriter);
+        requests.emplace_back(i, variant);
+    }
+    return requests;
+}
+
+/* Replays the client session after the restart, up to its first sample. */
+void first_sample(
+        Root& root,
+        const std::vector<std::pair<uint16_t, dds::xrce::ObjectVariant>>& requests)
+{
+    dds::xrce::AGENT_Representation agent;
+    root.create_client(client_representation(), agent, Middleware::Kind::CED);
+    std::shared_ptr<ProxyClient> client = root.get_client(client_representation().client_key());
+
+    dds::xrce::CreationMode creation_mode;
+    creation_mode.reuse(false);
+    creation_mode.replace(true);
+    for (const auto& request : requests)
+    {
+        client->create_object(creation_mode, conversion::raw_to_objectprefix(request.first), request.second);
+    }
+
+    benchmark::DoNotOptimize(client->get_middleware().write_data(0x0001, std::vector<uint8_t>(16)));
+}
+
+} // namespace
+
+/* Time from the first CREATE_CLIENT to the first sample after a restart, as a function of the datawriters. */
+static void BM_FirstSampleAfterRestart(
+        benchmark::State& state)
+{
+    const bool warm = (0 != state.range(0));
+    const auto requests = client_requests(uint16_t(state.range(1)));
+
+    /* Previous run of the agent. */
+    std::remove(snapshot_path.c_str());
+    {
+        Root root;
+        root.enable_snapshot(snapshot_path);
+        first_sample(root, requests);
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::unique_ptr<Root> root(new Root());
+        if (warm)
+        {
+            root->enable_snapshot(snapshot_path);
+        }
+        state.ResumeTiming();
+
+        first_sample(*root, requests);
+
+        state.PauseTiming();
+        /* Keep the snapshot of the previous run for the next iteration. */
+        root.reset();
+        state.ResumeTiming();
+    }
+    std::remove(snapshot_path.c_str());
+}
+BENCHMARK(BM_FirstSampleAfterRestart)
+    ->ArgNames({"warm", "datawriters"})
+    ->ArgsProduct({{0, 1}, {1, 8, 32}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,212 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/Root.hpp>
+#include <uxr/agent/client/ClientSnapshot.hpp>
+#include <uxr/agent/utils/Conversion.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+class ClientSnapshotTests : public ::testing::Test
+{
+protected:
+    ClientSnapshotTests()
+        : path_("/tmp/uxr-snapshot-" + std::to_string(getpid()) + ".bin")
+    {
+        client_.xrce_cookie(dds::xrce::XRCE_COOKIE);
+        client_.xrce_version(dds::xrce::XRCE_VERSION);
+        client_.client_key(conversion::raw_to_clientkey(0xAABBCCDD));
+        client_.session_id(0x01);
+        client_.mtu(512);
+    }
+
+    ~ClientSnapshotTests()
+    {
+        std::remove(path_.c_str());
+    }
+
+    static dds::xrce::ObjectVariant participant()
+    {
+        dds::xrce::OBJK_PARTICIPANT_Representation participant;
+        participant.domain_id(0);
+        participant.representation().object_reference("participant");
+        dds::xrce::ObjectVariant variant;
+        variant.participant(participant);
+        return variant;
+    }
+
+    static dds::xrce::ObjectVariant topic()
+    {
+        dds::xrce::OBJK_TOPIC_Representation topic;
+        topic.participant_id(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PARTICIPANT));
+        topic.representation().object_reference("rt/snapshot");
+        dds::xrce::ObjectVariant variant;
+        variant.topic(topic);
+        return variant;
+    }
+
+    static dds::xrce::ObjectVariant publisher()
+    {
+        dds::xrce::OBJK_PUBLISHER_Representation publisher;
+        publisher.participant_id(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PARTICIPANT));
+        publisher.representation().string_representation("");
+        dds::xrce::ObjectVariant variant;
+        variant.publisher(publisher);
+        return variant;
+    }
+
+    static dds::xrce::ObjectVariant datawriter()
+    {
+        dds::xrce::DATAWRITER_Representation datawriter;
+        datawriter.publisher_id(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PUBLISHER));
+        datawriter.representation().object_reference("rt/snapshot");
+        dds::xrce::ObjectVariant variant;
+        variant.data_writer(datawriter);
+        return variant;
+    }
+
+    std::string path_;
+    dds::xrce::CLIENT_Representation client_;
+};
+
+TEST_F(ClientSnapshotTests, StoreAndLoad)
+{
+    ClientSnapshot::Entry entry;
+    entry.representation = client_;
+    entry.middleware_kind = Middleware::Kind::CED;
+    entry.objects.emplace_back(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PARTICIPANT), participant());
+    entry.objects.emplace_back(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_TOPIC), topic());
+
+    {
+        ClientSnapshot snapshot;
+        ASSERT_TRUE(snapshot.open(path_, 4, 1024));
+        ASSERT_TRUE(snapshot.store(entry));
+        ASSERT_TRUE(snapshot.close());
+    }
+
+    ClientSnapshot snapshot;
+    ASSERT_TRUE(snapshot.open(path_, 4, 1024));
+    std::vector<ClientSnapshot::Entry> entries = snapshot.load();
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(client_.client_key(), entries[0].representation.client_key());
+    EXPECT_EQ(client_.session_id(), entries[0].representation.session_id());
+    EXPECT_EQ(Middleware::Kind::CED, entries[0].middleware_kind);
+    ASSERT_EQ(2u, entries[0].objects.size());
+    EXPECT_EQ(entry.objects[1].first, entries[0].objects[1].first);
+    EXPECT_EQ("rt/snapshot", entries[0].objects[1].second.topic().representation().object_reference());
+
+    ASSERT_TRUE(snapshot.remove(client_.client_key()));
+    EXPECT_TRUE(snapshot.load().empty());
+
+    /* An entry larger than a slot is not stored. */
+    entry.objects.resize(64, entry.objects[1]);
+    EXPECT_FALSE(snapshot.store(entry));
+    EXPECT_TRUE(snapshot.load().empty());
+}
+
+TEST_F(ClientSnapshotTests, CorruptedEntry)
+{
+    ClientSnapshot::Entry entry;
+    entry.representation = client_;
+    entry.middleware_kind = Middleware::Kind::CED;
+    entry.objects.emplace_back(conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_PARTICIPANT), participant());
+    {
+        ClientSnapshot snapshot;
+        ASSERT_TRUE(snapshot.open(path_, 4, 1024));
+        ASSERT_TRUE(snapshot.store(entry));
+        ASSERT_TRUE(snapshot.close());
+    }
+
+    /* Flip a byte of the entry data, past the file and slot headers. */
+    {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(64 + 16);
+        char byte = char(file.get());
+        file.seekp(64 + 16);
+        file.put(char(~byte));
+    }
+
+    ClientSnapshot snapshot;
+    ASSERT_TRUE(snapshot.open(path_, 4, 1024));
+    EXPECT_TRUE(snapshot.load().empty());
+}
+
+TEST_F(ClientSnapshotTests, WarmRestart)
+{
+    const dds::xrce::ObjectId datawriter_id = conversion::raw_to_objectid(0x0001, dds::xrce::OBJK_DATAWRITER);
+    dds::xrce::CreationMode creation_mode;
+    creation_mode.reuse(false);
+    creation_mode.replace(true);
+
+    {
+        Root root;
+        ASSERT_TRUE(root.enable_snapshot(path_));
+
+        dds::xrce::AGENT_Representation agent;
+        ASSERT_EQ(dds::xrce::STATUS_OK, root.create_client(client_, agent, Middleware::Kind::CED).status());
+        std::shared_ptr<ProxyClient> client = root.get_client(client_.client_key());
+        ASSERT_TRUE(client);
+
+        const std::pair<uint16_t, dds::xrce::ObjectVariant> objects[] = {
+            {0x0001, participant()}, {0x0001, topic()}, {0x0001, publisher()}, {0x0001, datawriter()}};
+        for (const auto& object : objects)
+        {
+            dds::xrce::ObjectPrefix prefix = conversion::raw_to_objectprefix(object.first);
+            ASSERT_EQ(dds::xrce::STATUS_OK, client->create_object(creation_mode, prefix, object.second).status());
+        }
+    }
+
+    /* The tree is pre-instantiated before the client is heard from. */
+    Root root;
+    ASSERT_TRUE(root.enable_snapshot(path_));
+    std::shared_ptr<ProxyClient> client = root.get_client(client_.client_key());
+    ASSERT_TRUE(client);
+    std::shared_ptr<XRCEObject> datawriter_object = client->get_object(datawriter_id);
+    ASSERT_TRUE(datawriter_object);
+
+    /* The first matching request adopts the restored object, even in replace mode. */
+    dds::xrce::ObjectPrefix prefix = conversion::raw_to_objectprefix(0x0001);
+    EXPECT_EQ(dds::xrce::STATUS_OK, client->create_object(creation_mode, prefix, datawriter()).status());
+    EXPECT_EQ(datawriter_object, client->get_object(datawriter_id));
+
+    /* Later requests follow the creation mode. */
+    creation_mode.replace(false);
+    EXPECT_EQ(dds::xrce::STATUS_ERR_ALREADY_EXISTS,
+        client->create_object(creation_mode, prefix, datawriter()).status());
+
+    /* Deleted clients are removed from the snapshot. */
+    EXPECT_EQ(dds::xrce::STATUS_OK, root.delete_client(client_.client_key()).status());
+    ClientSnapshot snapshot;
+    ASSERT_TRUE(snapshot.open(path_));
+    EXPECT_TRUE(snapshot.load().empty());
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/logger/Logger.hpp>
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+using eprosima::uxr::AsyncLogger;
+
+class AsyncLoggerTests : public ::testing::Test
+{
+protected:
+    AsyncLoggerTests()
+    {
+        auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(output_);
+        auto logger = std::make_shared<spdlog::logger>("async-logger-test", sink);
+        logger->set_pattern("%v");
+        logger->set_level(spdlog::level::trace);
+        spdlog::set_default_logger(logger);
+    }
+
+    ~AsyncLoggerTests()
+    {
+        AsyncLogger::instance().stop();
+    }
+
+    size_t count(
+            const std::string& pattern) const
+    {
+        size_t rv = 0;
+        const std::string output = output_.str();
+        for (size_t pos = output.find(pattern); std::string::npos != pos; pos = output.find(pattern, pos + 1))
+        {
+            ++rv;
+        }
+        return rv;
+    }
+
+    std::ostringstream output_;
+};
+
+TEST_F(AsyncLoggerTests, MessagesAreFormattedInBackground)
+{
+    const uint8_t buf[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+
+    ASSERT_TRUE(AsyncLogger::instance().start());
+    EXPECT_TRUE(AsyncLogger::enabled());
+    UXR_AGENT_LOG_MESSAGE("[** <<TEST>> **]", 0xAABBCCDD, buf, sizeof(buf));
+    UXR_MULTIAGENT_LOG_MESSAGE("[** <<TEST>> **]", 0xAABBCCDD, 7, buf, sizeof(buf));
+    AsyncLogger::instance().stop();
+    EXPECT_FALSE(AsyncLogger::enabled());
+
+    EXPECT_EQ(2u, count("[** <<TEST>> **]"));
+    EXPECT_EQ(2u, count("client_key: 0xAABBCCDD"));
+    EXPECT_EQ(1u, count("fd: 7"));
+    EXPECT_EQ(2u, count("DE AD BE EF"));
+}
+
+TEST_F(AsyncLoggerTests, OverflowIsCounted)
+{
+    const uint8_t buf[1] = {0x00};
+    const spdlog::source_loc loc{__FILE__, __LINE__, SPDLOG_FUNCTION};
+
+    /* Nothing is consumed while the background thread is stopped. */
+    const uint64_t dropped = AsyncLogger::instance().dropped();
+    for (size_t i = 0; i < eprosima::uxr::ASYNC_LOG_QUEUE_SIZE; ++i)
+    {
+        ASSERT_TRUE(AsyncLogger::instance().log_message(loc, "fill", 0, -1, buf, sizeof(buf), false));
+    }
+    EXPECT_FALSE(AsyncLogger::instance().log_message(loc, "fill", 0, -1, buf, sizeof(buf), false));
+    EXPECT_EQ(dropped + 1, AsyncLogger::instance().dropped());
+
+    ASSERT_TRUE(AsyncLogger::instance().start());
+    AsyncLogger::instance().stop();
+    EXPECT_EQ(size_t(eprosima::uxr::ASYNC_LOG_QUEUE_SIZE), count("fill"));
+    EXPECT_EQ(1u, count("dropped: 1"));
+}
+
+TEST_F(AsyncLoggerTests, LongMessagesAreTruncated)
+{
+    std::vector<uint8_t> buf(AsyncLogger::data_size + 1, 0xAB);
+
+    ASSERT_TRUE(AsyncLogger::instance().start());
+    UXR_AGENT_LOG_MESSAGE("long", 0x01, buf.data(), buf.size());
+    AsyncLogger::instance().stop();
+
+    EXPECT_EQ(1u, count("len: 257"));
+    EXPECT_EQ(1u, count("(truncated)"));
+}
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/Agent.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const uint32_t client_key = 0xAABBCCDD;
+const uint16_t datawriter_id = 0x01;
+const size_t batch_size = 16;
+
+/* Agent with a single CED client owning a DataWriter. */
+class AgentFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(
+            const benchmark::State& state) override
+    {
+        Agent::OpResult result;
+        agent_.set_verbose_level(0);
+        agent_.create_client(client_key, 0x01, 512, Middleware::Kind::CED, result);
+        agent_.create_participant_by_ref(client_key, 0x01, 0, "participant", 0, result);
+        agent_.create_topic_by_ref(client_key, 0x01, 0x01, "benchmark_topic", 0, result);
+        agent_.create_publisher_by_xml(client_key, 0x01, 0x01, "", 0, result);
+        agent_.create_datawriter_by_ref(client_key, datawriter_id, 0x01, "benchmark_topic", 0, result);
+        data_.assign(size_t(state.range(0)), 0xAA);
+    }
+
+    void TearDown(
+            const benchmark::State& /*state*/) override
+    {
+        Agent::OpResult result;
+        agent_.delete_client(client_key, result);
+    }
+
+protected:
+    Agent agent_;
+    std::vector<uint8_t> data_;
+};
+
+} // namespace
+
+/* Current API: client and object lookups plus a copy into a vector on every call. */
+BENCHMARK_DEFINE_F(AgentFixture, WriteByKey)(
+        benchmark::State& state)
+{
+    Agent::OpResult result;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(agent_.write(client_key, datawriter_id, data_.data(), data_.size(), result));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK_REGISTER_F(AgentFixture, WriteByKey)->Arg(16)->Arg(1024);
+
+BENCHMARK_DEFINE_F(AgentFixture, WriteByHandle)(
+        benchmark::State& state)
+{
+    Agent::OpResult result;
+    Agent::DataWriterHandle handle;
+    agent_.get_datawriter_handle(client_key, datawriter_id, handle, result);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(agent_.write(handle, data_.data(), data_.size(), result));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK_REGISTER_F(AgentFixture, WriteByHandle)->Arg(16)->Arg(1024);
+
+BENCHMARK_DEFINE_F(AgentFixture, WriteBatch)(
+        benchmark::State& state)
+{
+    Agent::OpResult result;
+    Agent::DataWriterHandle handle;
+    agent_.get_datawriter_handle(client_key, datawriter_id, handle, result);
+    std::vector<Agent::Sample> samples(batch_size, Agent::Sample{data_.data(), data_.size()});
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(agent_.write(handle, samples.data(), samples.size(), result));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations() * batch_size));
+}
+BENCHMARK_REGISTER_F(AgentFixture, WriteBatch)->Arg(16)->Arg(1024);
+
+BENCHMARK_MAIN();
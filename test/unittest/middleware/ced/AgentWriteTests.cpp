@@ -0,0 +1,166 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/Agent.hpp>
+#include <uxr/agent/middleware/ced/CedMiddleware.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+/* An Agent with a CED DataWriter, and a CED DataReader on the same topic to read back the writes. */
+class AgentWriteTests : public ::testing::Test
+{
+protected:
+    AgentWriteTests()
+        : reader_{0xAABBCCEE}
+    {
+        Agent::OpResult result;
+        agent_.set_verbose_level(0);
+        agent_.create_client(client_key_, 0x01, 512, Middleware::Kind::CED, result);
+        agent_.create_participant_by_ref(client_key_, 0x01, 0, "participant", 0, result);
+        agent_.create_topic_by_ref(client_key_, 0x01, 0x01, "handle_topic", 0, result);
+        agent_.create_publisher_by_xml(client_key_, 0x01, 0x01, "", 0, result);
+        agent_.create_datawriter_by_ref(client_key_, datawriter_id_, 0x01, "handle_topic", 0, result);
+
+        reader_.create_participant_by_ref(0, 0, "participant");
+        reader_.create_topic_by_ref(0, 0, "handle_topic");
+        reader_.create_subscriber_by_xml(0, 0, "");
+        reader_.create_datareader_by_ref(0, 0, "handle_topic");
+    }
+
+    ~AgentWriteTests()
+    {
+        Agent::OpResult result;
+        agent_.delete_client(client_key_, result);
+    }
+
+    std::vector<uint8_t> read()
+    {
+        std::vector<uint8_t> data;
+        reader_.read_data(0, data, std::chrono::milliseconds(0));
+        return data;
+    }
+
+    Agent agent_;
+    CedMiddleware reader_;
+    const uint32_t client_key_ = 0xAABBCCDD;
+    const uint16_t datawriter_id_ = 0x01;
+};
+
+TEST_F(AgentWriteTests, GetDataWriterHandle)
+{
+    Agent::OpResult result;
+    Agent::DataWriterHandle handle;
+    EXPECT_FALSE(handle.valid());
+
+    EXPECT_FALSE(agent_.get_datawriter_handle(0x01020304, datawriter_id_, handle, result));
+    EXPECT_EQ(Agent::OpResult::UNKNOWN_REFERENCE_ERROR, result);
+    EXPECT_FALSE(agent_.get_datawriter_handle(client_key_, 0x02, handle, result));
+    EXPECT_EQ(Agent::OpResult::UNKNOWN_REFERENCE_ERROR, result);
+    EXPECT_FALSE(handle.valid());
+
+    EXPECT_TRUE(agent_.get_datawriter_handle(client_key_, datawriter_id_, handle, result));
+    EXPECT_EQ(Agent::OpResult::OK, result);
+    EXPECT_TRUE(handle.valid());
+}
+
+TEST_F(AgentWriteTests, WriteByHandle)
+{
+    Agent::OpResult result;
+    Agent::DataWriterHandle handle;
+    ASSERT_TRUE(agent_.get_datawriter_handle(client_key_, datawriter_id_, handle, result));
+
+    const std::vector<uint8_t> data{1, 2, 3};
+    EXPECT_TRUE(agent_.write(handle, data.data(), data.size(), result));
+    EXPECT_EQ(Agent::OpResult::OK, result);
+    EXPECT_EQ(data, read());
+
+    /* The key-based write goes to the same DataWriter. */
+    std::vector<uint8_t> other{4, 5};
+    EXPECT_TRUE(agent_.write(client_key_, datawriter_id_, other.data(), other.size(), result));
+    EXPECT_EQ(other, read());
+    EXPECT_TRUE(read().empty());
+}
+
+TEST_F(AgentWriteTests, WriteBatch)
+{
+    Agent::OpResult result;
+    Agent::DataWriterHandle handle;
+    ASSERT_TRUE(agent_.get_datawriter_handle(client_key_, datawriter_id_, handle, result));
+
+    const uint8_t data[] = {0, 1, 2, 3, 4, 5};
+    const Agent::Sample samples[] = {{data, 2}, {data + 2, 2}, {data + 4, 2}};
+    EXPECT_TRUE(agent_.write(handle, samples, 3, result));
+    EXPECT_EQ(Agent::OpResult::OK, result);
+    for (const auto& sample : samples)
+    {
+        EXPECT_EQ(std::vector<uint8_t>(sample.buf, sample.buf + sample.len), read());
+    }
+    EXPECT_TRUE(read().empty());
+
+    /* A batch over the history depth is written in full. */
+    std::vector<Agent::Sample> long_batch(20, Agent::Sample{data, 1});
+    EXPECT_TRUE(agent_.write(handle, long_batch.data(), long_batch.size(), result));
+    EXPECT_EQ(Agent::OpResult::OK, result);
+    for (size_t i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(std::vector<uint8_t>{0}, read());
+    }
+    EXPECT_TRUE(read().empty());
+}
+
+/**
+ * @brief   This test checks that a handle does not keep its DataWriter alive, and that the writes
+ *          through it are rejected once the DataWriter or its client are deleted.
+ */
+TEST_F(AgentWriteTests, DeletedDataWriter)
+{
+    Agent::OpResult result;
+    Agent::DataWriterHandle handle;
+    ASSERT_TRUE(agent_.get_datawriter_handle(client_key_, datawriter_id_, handle, result));
+
+    ASSERT_TRUE(agent_.delete_datawriter(client_key_, datawriter_id_, result));
+    EXPECT_FALSE(handle.valid());
+
+    const uint8_t data[] = {1, 2};
+    const Agent::Sample samples[] = {{data, 2}};
+    EXPECT_FALSE(agent_.write(handle, data, sizeof(data), result));
+    EXPECT_EQ(Agent::OpResult::UNKNOWN_REFERENCE_ERROR, result);
+    EXPECT_FALSE(agent_.write(handle, samples, 1, result));
+    EXPECT_EQ(Agent::OpResult::UNKNOWN_REFERENCE_ERROR, result);
+    EXPECT_TRUE(read().empty());
+
+    /* A handle taken again on a new DataWriter is dropped along with the client. */
+    ASSERT_TRUE(agent_.create_datawriter_by_ref(client_key_, datawriter_id_, 0x01, "handle_topic", 0, result));
+    ASSERT_TRUE(agent_.get_datawriter_handle(client_key_, datawriter_id_, handle, result));
+    ASSERT_TRUE(agent_.delete_client(client_key_, result));
+    EXPECT_FALSE(handle.valid());
+    EXPECT_FALSE(agent_.write(handle, data, sizeof(data), result));
+    EXPECT_EQ(Agent::OpResult::UNKNOWN_REFERENCE_ERROR, result);
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 namespace eprosima {
 namespace uxr {
 namespace testing {
@@ -897,6 +899,337 @@ TEST_F(CedMiddlewareUnitTests, WriteReadData)
     EXPECT_FALSE(middleware_.read_data(1, input_data, std::chrono::milliseconds(100)));
 }
 
+TEST_F(CedMiddlewareUnitTests, WriteBufferAndBatch)
+{
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    std::string topic_ref{"BatchTopic"};
+    middleware_.create_topic_by_ref(0, 0, topic_ref);
+
+    std::string subscriber_xml{"Subscriber"};
+    middleware_.create_subscriber_by_xml(0, 0, subscriber_xml);
+
+    std::string publisher_xml{"Publisher"};
+    middleware_.create_publisher_by_xml(0, 0, publisher_xml);
+
+    middleware_.create_datareader_by_ref(0, 0, topic_ref);
+    middleware_.create_datawriter_by_ref(0, 0, topic_ref);
+
+    const uint8_t output_data[] = {0, 1, 2, 3, 4, 5};
+    std::vector<uint8_t> input_data{};
+
+    /* Write from a caller-owned buffer. */
+    EXPECT_TRUE(middleware_.write_data(0, output_data, 3));
+    EXPECT_FALSE(middleware_.write_data(1, output_data, 3));
+    EXPECT_TRUE(middleware_.read_data(0, input_data, std::chrono::milliseconds(0)));
+    EXPECT_EQ(std::vector<uint8_t>(output_data, output_data + 3), input_data);
+
+    /* Write a batch, read back in order. */
+    const Middleware::Sample samples[] = {{output_data, 2}, {output_data + 2, 2}, {output_data + 4, 2}};
+    EXPECT_EQ(3u, middleware_.write_batch(0, samples, 3));
+    EXPECT_EQ(0u, middleware_.write_batch(1, samples, 3));
+    for (const auto& sample : samples)
+    {
+        EXPECT_TRUE(middleware_.read_data(0, input_data, std::chrono::milliseconds(0)));
+        EXPECT_EQ(std::vector<uint8_t>(sample.buf, sample.buf + sample.len), input_data);
+    }
+    EXPECT_FALSE(middleware_.read_data(0, input_data, std::chrono::milliseconds(0)));
+
+    /* A batch longer than the history is written in full, and the history keeps its last samples. */
+    std::vector<uint8_t> sequence(20);
+    std::vector<Middleware::Sample> long_batch;
+    for (size_t i = 0; i < sequence.size(); ++i)
+    {
+        sequence[i] = uint8_t(i);
+        long_batch.push_back(Middleware::Sample{&sequence[i], 1});
+    }
+    EXPECT_EQ(20u, middleware_.write_batch(0, long_batch.data(), long_batch.size()));
+    for (size_t i = 4; i < 20; ++i)
+    {
+        EXPECT_TRUE(middleware_.read_data(0, input_data, std::chrono::milliseconds(0)));
+        EXPECT_EQ(std::vector<uint8_t>{uint8_t(i)}, input_data);
+    }
+    EXPECT_FALSE(middleware_.read_data(0, input_data, std::chrono::milliseconds(0)));
+}
+
+TEST_F(CedMiddlewareUnitTests, TopicInterest)
+{
+    std::vector<std::pair<std::string, bool>> notifications;
+    CedTopicManager::register_on_topic_interest_cb(
+        0xEA000001,
+        [&](int16_t, const std::string& topic_name, bool interest)
+        {
+            notifications.emplace_back(topic_name, interest);
+        });
+
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    std::string topic_ref{"InterestTopic"};
+    middleware_.create_topic_by_ref(0, 0, topic_ref);
+
+    std::string subscriber_xml{"Subscriber"};
+    middleware_.create_subscriber_by_xml(0, 0, subscriber_xml);
+
+    /* Readers of other Agents do not count as local interest. */
+    CedMiddleware bridge_middleware{0xEA000002};
+    bridge_middleware.create_participant_by_ref(0, 0, participant_ref);
+    bridge_middleware.create_topic_by_ref(0, 0, topic_ref);
+    bridge_middleware.create_subscriber_by_xml(0, 0, subscriber_xml);
+    EXPECT_TRUE(bridge_middleware.create_datareader_by_ref(0, 0, topic_ref));
+    EXPECT_TRUE(notifications.empty());
+
+    /* Only the first local DataReader and the removal of the last one are notified. */
+    EXPECT_TRUE(middleware_.create_datareader_by_ref(0, 0, topic_ref));
+    EXPECT_TRUE(middleware_.create_datareader_by_ref(1, 0, topic_ref));
+    ASSERT_EQ(1u, notifications.size());
+    EXPECT_EQ(topic_ref, notifications[0].first);
+    EXPECT_TRUE(notifications[0].second);
+
+    EXPECT_TRUE(middleware_.delete_datareader(0));
+    EXPECT_EQ(1u, notifications.size());
+    EXPECT_TRUE(middleware_.delete_datareader(1));
+    ASSERT_EQ(2u, notifications.size());
+    EXPECT_FALSE(notifications[1].second);
+
+    CedTopicManager::unregister_on_topic_interest_cb(0xEA000001);
+}
+
+TEST_F(CedMiddlewareUnitTests, CreateRequesterByBin)
+{
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    dds::xrce::OBJK_Requester_Binary requester_xrce;
+    requester_xrce.service_name("Service");
+    requester_xrce.request_type("Request");
+    requester_xrce.reply_type("Reply");
+
+    dds::xrce::OBJK_Replier_Binary replier_xrce;
+    replier_xrce.service_name("Service");
+    replier_xrce.request_type("Request");
+    replier_xrce.reply_type("OtherReply");
+
+    /* Create Requester by BIN. */
+    EXPECT_TRUE(middleware_.create_requester_by_bin(0, 0, requester_xrce));
+
+    /* Create
+     *      Id:             same
+     *      Participant:    same
+     *      Service:        same
+     *      Expected:       FALSE
+     */
+    EXPECT_FALSE(middleware_.create_requester_by_bin(0, 0, requester_xrce));
+
+    /* Create
+     *      Id:             different
+     *      Participant:    non-existent
+     *      Service:        same
+     *      Expected:       FALSE
+     */
+    EXPECT_FALSE(middleware_.create_requester_by_bin(1, 1, requester_xrce));
+
+    /* Create
+     *      Replier:        types different
+     *      Expected:       FALSE
+     */
+    EXPECT_FALSE(middleware_.create_replier_by_bin(0, 0, replier_xrce));
+
+    /* Create
+     *      Replier:        types same
+     *      Expected:       TRUE
+     */
+    replier_xrce.reply_type("Reply");
+    EXPECT_TRUE(middleware_.create_replier_by_bin(0, 0, replier_xrce));
+
+    /* Create
+     *      Replier:        by REF, types unset
+     *      Expected:       TRUE
+     */
+    EXPECT_TRUE(middleware_.create_replier_by_ref(1, 0, "Service"));
+
+    /* Match by service name and types. */
+    EXPECT_TRUE(middleware_.matched_requester_from_bin(0, requester_xrce));
+    EXPECT_TRUE(middleware_.matched_requester_from_ref(0, "Service"));
+    EXPECT_FALSE(middleware_.matched_requester_from_ref(0, "OtherService"));
+    EXPECT_TRUE(middleware_.matched_replier_from_bin(1, replier_xrce));
+    replier_xrce.request_type("OtherRequest");
+    EXPECT_FALSE(middleware_.matched_replier_from_bin(0, replier_xrce));
+}
+
+TEST_F(CedMiddlewareUnitTests, DeleteRequester)
+{
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    std::string requester_xml{"Service"};
+    middleware_.create_requester_by_xml(0, 0, requester_xml);
+    middleware_.create_replier_by_xml(0, 0, requester_xml);
+
+    /* Delete
+     *      Requester:  existent
+     *      Expected:   TRUE
+     */
+    EXPECT_TRUE(middleware_.delete_requester(0));
+    EXPECT_TRUE(middleware_.delete_replier(0));
+
+    /* Delete
+     *      Requester:  non-existent
+     *      Expected:   FALSE
+     */
+    EXPECT_FALSE(middleware_.delete_requester(0));
+    EXPECT_FALSE(middleware_.delete_replier(0));
+
+    /* Create
+     *      Requester:  same
+     *      Expected:   TRUE
+     */
+    EXPECT_TRUE(middleware_.create_requester_by_xml(0, 0, requester_xml));
+}
+
+/**
+ * @brief   This test checks that each reply goes back to the requester of its request, with the
+ *          sequence number given along with the request.
+ */
+TEST_F(CedMiddlewareUnitTests, WriteReadRequestReply)
+{
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    std::string service_ref{"ReplyService"};
+    ASSERT_TRUE(middleware_.create_requester_by_ref(0, 0, service_ref));
+    ASSERT_TRUE(middleware_.create_requester_by_ref(1, 0, service_ref));
+    ASSERT_TRUE(middleware_.create_replier_by_ref(0, 0, service_ref));
+
+    std::vector<uint8_t> request_one{0, 1, 2};
+    std::vector<uint8_t> request_two{3, 4, 5};
+    EXPECT_TRUE(middleware_.write_request(0, 10, request_one));
+    EXPECT_TRUE(middleware_.write_request(1, 20, request_two));
+    EXPECT_FALSE(middleware_.write_request(2, 30, request_two));
+
+    /* The replier gets each request after its sample identity, and echoes it back in the reply. */
+    std::vector<std::vector<uint8_t>> requests(2);
+    for (auto& request : requests)
+    {
+        ASSERT_TRUE(middleware_.read_request(0, request, std::chrono::milliseconds(0)));
+    }
+    EXPECT_FALSE(middleware_.read_request(0, requests[0], std::chrono::milliseconds(10)));
+    ASSERT_LT(request_one.size(), requests[0].size());
+    size_t identity_size = requests[0].size() - request_one.size();
+    EXPECT_TRUE(std::equal(request_one.begin(), request_one.end(), requests[0].begin() + identity_size));
+    EXPECT_TRUE(std::equal(request_two.begin(), request_two.end(), requests[1].begin() + identity_size));
+
+    for (auto& request : requests)
+    {
+        request.resize(identity_size);
+        request.push_back(0xAA);
+        ASSERT_TRUE(middleware_.write_reply(0, request));
+    }
+
+    uint32_t sequence_number = 0;
+    std::vector<uint8_t> reply;
+    EXPECT_TRUE(middleware_.read_reply(1, sequence_number, reply, std::chrono::milliseconds(0)));
+    EXPECT_EQ(20u, sequence_number);
+    EXPECT_EQ(std::vector<uint8_t>{0xAA}, reply);
+    EXPECT_FALSE(middleware_.read_reply(1, sequence_number, reply, std::chrono::milliseconds(10)));
+
+    EXPECT_TRUE(middleware_.read_reply(0, sequence_number, reply, std::chrono::milliseconds(0)));
+    EXPECT_EQ(10u, sequence_number);
+
+    /* A reply is taken only once, and a malformed one is not written. */
+    EXPECT_TRUE(middleware_.write_reply(0, requests[0]));
+    EXPECT_FALSE(middleware_.read_reply(0, sequence_number, reply, std::chrono::milliseconds(10)));
+    EXPECT_FALSE(middleware_.write_reply(0, std::vector<uint8_t>{0, 1}));
+}
+
+/**
+ * @brief   This test checks that requesters and repliers blocked in a read wake up as soon as the
+ *          request or the reply is written, as the DataReaders do.
+ */
+TEST_F(CedMiddlewareUnitTests, RequestReplyWakeUp)
+{
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    CedMiddleware server_middleware{0xAABBCCEE};
+    server_middleware.create_participant_by_ref(0, 0, participant_ref);
+
+    std::string service_ref{"WakeUpService"};
+    ASSERT_TRUE(middleware_.create_requester_by_ref(0, 0, service_ref));
+    ASSERT_TRUE(server_middleware.create_replier_by_ref(0, 0, service_ref));
+
+    std::thread server([&]()
+    {
+        std::vector<uint8_t> request;
+        if (server_middleware.read_request(0, request, std::chrono::milliseconds(5000)))
+        {
+            server_middleware.write_reply(0, request);
+        }
+    });
+
+    auto begin = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(middleware_.write_request(0, 7, std::vector<uint8_t>{1, 2, 3}));
+
+    uint32_t sequence_number = 0;
+    std::vector<uint8_t> reply;
+    EXPECT_TRUE(middleware_.read_reply(0, sequence_number, reply, std::chrono::milliseconds(5000)));
+    EXPECT_EQ(7u, sequence_number);
+    EXPECT_EQ((std::vector<uint8_t>{1, 2, 3}), reply);
+    EXPECT_GT(std::chrono::milliseconds(2000), std::chrono::steady_clock::now() - begin);
+    server.join();
+}
+
+/**
+ * @brief   This test checks that a requester blocked in a read gets its reply when it is written
+ *          right after the reply to another requester, with a single wake-up for both.
+ */
+TEST_F(CedMiddlewareUnitTests, RequestReplyInterleavedWakeUp)
+{
+    std::string participant_ref{"Participant"};
+    middleware_.create_participant_by_ref(0, 0, participant_ref);
+
+    CedMiddleware server_middleware{0xAABBCCEE};
+    server_middleware.create_participant_by_ref(0, 0, participant_ref);
+
+    std::string service_ref{"InterleavedService"};
+    ASSERT_TRUE(middleware_.create_requester_by_ref(0, 0, service_ref));
+    ASSERT_TRUE(middleware_.create_requester_by_ref(1, 0, service_ref));
+    ASSERT_TRUE(server_middleware.create_replier_by_ref(0, 0, service_ref));
+
+    EXPECT_TRUE(middleware_.write_request(1, 1, std::vector<uint8_t>{1}));
+    EXPECT_TRUE(middleware_.write_request(0, 2, std::vector<uint8_t>{2}));
+
+    bool replied = false;
+    uint32_t sequence_number = 0;
+    std::vector<uint8_t> reply;
+    std::thread client([&]()
+    {
+        replied = middleware_.read_reply(0, sequence_number, reply, std::chrono::milliseconds(2000));
+    });
+
+    /* Answer once the requester is blocked, the other requester first. */
+    auto begin = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::vector<uint8_t> first_request;
+    std::vector<uint8_t> second_request;
+    ASSERT_TRUE(server_middleware.read_request(0, first_request, std::chrono::milliseconds(0)));
+    ASSERT_TRUE(server_middleware.read_request(0, second_request, std::chrono::milliseconds(0)));
+    EXPECT_TRUE(server_middleware.write_reply(0, first_request));
+    EXPECT_TRUE(server_middleware.write_reply(0, second_request));
+    client.join();
+
+    EXPECT_TRUE(replied);
+    EXPECT_EQ(2u, sequence_number);
+    EXPECT_EQ((std::vector<uint8_t>{2}), reply);
+    EXPECT_GT(std::chrono::milliseconds(1000), std::chrono::steady_clock::now() - begin);
+
+    EXPECT_TRUE(middleware_.read_reply(1, sequence_number, reply, std::chrono::milliseconds(0)));
+    EXPECT_EQ(1u, sequence_number);
+    EXPECT_EQ((std::vector<uint8_t>{1}), reply);
+}
+
 } // namespace testing
 } // namespace uxr
 } // namespace testing
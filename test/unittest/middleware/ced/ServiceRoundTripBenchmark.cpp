@@ -0,0 +1,114 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/middleware/ced/CedMiddleware.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const std::chrono::milliseconds timeout(1000);
+
+/* A client Agent with a requester and a server Agent with a replier of the same service. */
+class ServiceFixture : public benchmark::Fixture
+{
+public:
+    ServiceFixture()
+        : client_(0xAABBCCDD)
+        , server_(0xAABBCCEE)
+    {}
+
+    void SetUp(
+            const benchmark::State& state) override
+    {
+        client_.create_participant_by_ref(0, 0, "participant");
+        client_.create_requester_by_ref(0, 0, "benchmark_service");
+        server_.create_participant_by_ref(0, 0, "participant");
+        server_.create_replier_by_ref(0, 0, "benchmark_service");
+        request_.assign(size_t(state.range(0)), 0xAA);
+    }
+
+    void TearDown(
+            const benchmark::State& /*state*/) override
+    {
+        client_.delete_requester(0);
+        client_.delete_participant(0);
+        server_.delete_replier(0);
+        server_.delete_participant(0);
+    }
+
+protected:
+    CedMiddleware client_;
+    CedMiddleware server_;
+    std::vector<uint8_t> request_;
+};
+
+} // namespace
+
+/* Request, take, reply and take on a single thread: the cost of the routing alone. */
+BENCHMARK_DEFINE_F(ServiceFixture, RoundTrip)(
+        benchmark::State& state)
+{
+    std::vector<uint8_t> request;
+    std::vector<uint8_t> reply;
+    uint32_t sequence_number = 0;
+    for (auto _ : state)
+    {
+        client_.write_request(0, ++sequence_number, request_);
+        server_.read_request(0, request, timeout);
+        server_.write_reply(0, request);
+        benchmark::DoNotOptimize(client_.read_reply(0, sequence_number, reply, timeout));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK_REGISTER_F(ServiceFixture, RoundTrip)->Arg(16)->Arg(1024);
+
+/* A replier thread blocked in read_request, as in the Agent: adds both wake-ups to the routing. */
+BENCHMARK_DEFINE_F(ServiceFixture, RoundTripThreaded)(
+        benchmark::State& state)
+{
+    std::atomic<bool> running{true};
+    std::thread replier([&]()
+    {
+        std::vector<uint8_t> request;
+        while (running)
+        {
+            if (server_.read_request(0, request, std::chrono::milliseconds(10)))
+            {
+                server_.write_reply(0, request);
+            }
+        }
+    });
+
+    std::vector<uint8_t> reply;
+    uint32_t sequence_number = 0;
+    for (auto _ : state)
+    {
+        client_.write_request(0, ++sequence_number, request_);
+        benchmark::DoNotOptimize(client_.read_reply(0, sequence_number, reply, timeout));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+
+    running = false;
+    replier.join();
+}
+BENCHMARK_REGISTER_F(ServiceFixture, RoundTripThreaded)->Arg(16)->Arg(1024)->UseRealTime();
+
+BENCHMARK_MAIN();
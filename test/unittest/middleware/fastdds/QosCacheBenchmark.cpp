@@ -0,0 +1,132 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/middleware/fastdds/FastDDSMiddleware.hpp>
+#include <uxr/agent/middleware/fastdds/FastDDSQosCache.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const std::string participant_xml =
+    "<dds>"
+        "<participant>"
+            "<rtps>"
+                "<name>default_xrce_participant</name>"
+            "</rtps>"
+        "</participant>"
+    "</dds>";
+
+const std::string topic_xml =
+    "<dds>"
+        "<topic>"
+            "<name>HelloWorldTopic</name>"
+            "<dataType>HelloWorld</dataType>"
+        "</topic>"
+    "</dds>";
+
+const std::string datawriter_xml =
+    "<dds>"
+        "<data_writer>"
+            "<topic>"
+                "<kind>NO_KEY</kind>"
+                "<name>HelloWorldTopic</name>"
+                "<dataType>HelloWorld</dataType>"
+            "</topic>"
+            "<qos>"
+                "<reliability>"
+                    "<kind>RELIABLE</kind>"
+                "</reliability>"
+            "</qos>"
+        "</data_writer>"
+    "</dds>";
+
+} // namespace
+
+/* Cost of a single datawriter QoS lookup, parsing every time or going through the cache. */
+static void BM_DataWriterQosFromXml(
+        benchmark::State& state)
+{
+    const bool cached = (0 != state.range(0));
+    auto factory = eprosima::fastdds::dds::DomainParticipantFactory::get_instance();
+    auto participant = factory->create_participant(0, factory->get_default_participant_qos());
+    auto publisher = participant->create_publisher(participant->get_default_publisher_qos());
+
+    for (auto _ : state)
+    {
+        eprosima::fastdds::dds::DataWriterQos qos = publisher->get_default_datawriter_qos();
+        std::string topic_name;
+        benchmark::DoNotOptimize(cached
+            ? FastDDSQosCache::get_datawriter_qos_from_xml(publisher, datawriter_xml, qos, topic_name)
+            : publisher->get_datawriter_qos_from_xml(datawriter_xml, qos, topic_name));
+    }
+
+    participant->delete_publisher(publisher);
+    factory->delete_participant(participant);
+}
+BENCHMARK(BM_DataWriterQosFromXml)
+    ->ArgNames({"cached"})
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
+
+/*
+ * Entity creation latency of a fleet of identical clients, each one creating a topic, a publisher and
+ * a datawriter from the same XML and checking them as a REUSE request would. The cold variant clears
+ * the cache before every client, which matches the behaviour without it.
+ */
+static void BM_CreateIdenticalClients(
+        benchmark::State& state)
+{
+    const bool cold = (0 == state.range(0));
+    const uint16_t clients = uint16_t(state.range(1));
+
+    FastDDSMiddleware middleware;
+    middleware.create_participant_by_xml(0, 0, participant_xml);
+
+    for (auto _ : state)
+    {
+        for (uint16_t i = 1; i <= clients; ++i)
+        {
+            if (cold)
+            {
+                FastDDSQosCache::clear();
+            }
+            benchmark::DoNotOptimize(middleware.create_topic_by_xml(i, 0, topic_xml));
+            benchmark::DoNotOptimize(middleware.create_publisher_by_xml(i, 0, ""));
+            benchmark::DoNotOptimize(middleware.create_datawriter_by_xml(i, i, datawriter_xml));
+            benchmark::DoNotOptimize(middleware.matched_datawriter_from_xml(i, datawriter_xml));
+        }
+
+        state.PauseTiming();
+        for (uint16_t i = 1; i <= clients; ++i)
+        {
+            middleware.delete_datawriter(i);
+            middleware.delete_publisher(i);
+            middleware.delete_topic(i);
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * clients);
+}
+BENCHMARK(BM_CreateIdenticalClients)
+    ->ArgNames({"warm", "clients"})
+    ->ArgsProduct({{0, 1}, {1, 16, 128}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+#include <uxr/agent/p2p/InternalClientManager.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <time.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using eprosima::uxr::UDPv4Agent;
+using eprosima::uxr::InternalClientManager;
+using eprosima::uxr::Middleware;
+
+namespace {
+
+const uint16_t base_port = 27000;
+const std::chrono::milliseconds idle_window{2000};
+
+double process_cpu_time()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return double(ts.tv_sec) + double(ts.tv_nsec) * 1e-9;
+}
+
+/* CPU used by the whole process, in percent of one core, while idling for the window. */
+double idle_cpu_percent()
+{
+    double begin = process_cpu_time();
+    std::this_thread::sleep_for(idle_window);
+    double end = process_cpu_time();
+    return 100.0 * (end - begin) / std::chrono::duration<double>(idle_window).count();
+}
+
+} // namespace
+
+/* Idle CPU spent by the internal clients of a P2P mesh, as a function of the number of peers. */
+static void BM_InternalClientsIdleCpu(
+        benchmark::State& state)
+{
+    const size_t peers = size_t(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<std::unique_ptr<UDPv4Agent>> agents;
+        for (size_t i = 0; i < peers; ++i)
+        {
+            agents.emplace_back(new UDPv4Agent(uint16_t(base_port + i), Middleware::Kind::CED));
+            agents.back()->start();
+        }
+
+        double servers_cpu = idle_cpu_percent();
+
+        InternalClientManager& manager = InternalClientManager::instance();
+        manager.set_local_address(base_port - 1);
+        for (size_t i = 0; i < peers; ++i)
+        {
+            manager.create_client(*agents.front(), {127, 0, 0, 1}, uint16_t(base_port + i));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        double total_cpu = idle_cpu_percent();
+        state.counters["cpu_percent"] = total_cpu - servers_cpu;
+
+        manager.delete_clients();
+        for (auto& agent : agents)
+        {
+            agent->stop();
+        }
+    }
+}
+BENCHMARK(BM_InternalClientsIdleCpu)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Iterations(1)->Unit(benchmark::kSecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/processor/InfoReplyCache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+namespace {
+
+dds::xrce::ObjectInfo make_object_info(
+        const std::vector<std::array<uint8_t, 4>>& addresses)
+{
+    dds::xrce::AGENT_ActivityInfo agent_info;
+    for (const auto& address : addresses)
+    {
+        dds::xrce::TransportAddressMedium medium_locator;
+        medium_locator.address(address);
+        medium_locator.port(8888);
+        agent_info.address_seq().emplace_back();
+        agent_info.address_seq().back().medium_locator(medium_locator);
+    }
+    agent_info.availability(1);
+
+    dds::xrce::ActivityInfoVariant info_variant;
+    info_variant.agent(agent_info);
+
+    dds::xrce::ObjectInfo object_info;
+    object_info.activity(info_variant);
+    return object_info;
+}
+
+dds::xrce::GET_INFO_Payload make_request(
+        uint8_t id)
+{
+    dds::xrce::GET_INFO_Payload request;
+    request.request_id({0x00, id});
+    request.object_id({0x00, uint8_t(0x0F & id)});
+    return request;
+}
+
+/* The INFO message as the processor serialized it before the cache. */
+std::vector<uint8_t> serialize_reply(
+        const dds::xrce::MessageHeader& header,
+        const dds::xrce::BaseObjectRequest& request,
+        uint8_t implementation_status,
+        const dds::xrce::ObjectInfo& object_info)
+{
+    dds::xrce::INFO_Payload info_payload;
+    info_payload.related_request(request);
+    info_payload.result().status(dds::xrce::STATUS_OK);
+    info_payload.result().implementation_status(implementation_status);
+    info_payload.object_info(object_info);
+
+    dds::xrce::SubmessageHeader subheader;
+    OutputMessage message(
+        header,
+        header.getCdrSerializedSize() + subheader.getCdrSerializedSize() + info_payload.getCdrSerializedSize());
+    message.append_submessage(dds::xrce::INFO, info_payload);
+    return std::vector<uint8_t>(message.get_buf(), message.get_buf() + message.get_len());
+}
+
+std::vector<uint8_t> to_bytes(
+        const OutputMessagePtr& message)
+{
+    return std::vector<uint8_t>(message->get_buf(), message->get_buf() + message->get_len());
+}
+
+} // namespace
+
+TEST(InfoReplyCacheTests, NotBuilt)
+{
+    InfoReplyCache cache;
+    EXPECT_FALSE(cache.ready());
+
+    dds::xrce::MessageHeader header;
+    header.session_id(dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY);
+    OutputMessagePtr message;
+    EXPECT_FALSE(cache.make_reply(header, make_request(1), 0, message));
+}
+
+/**
+ * @brief   This test checks that the replies patched from the cache match, byte for byte, the ones
+ *          serialized from scratch, with and without client key.
+ */
+TEST(InfoReplyCacheTests, Hit)
+{
+    const dds::xrce::ObjectInfo object_info = make_object_info({{127, 0, 0, 1}, {192, 168, 1, 2}});
+    InfoReplyCache cache;
+    cache.build(object_info);
+    ASSERT_TRUE(cache.ready());
+
+    dds::xrce::MessageHeader without_key;
+    without_key.session_id(dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY);
+    dds::xrce::MessageHeader with_key;
+    with_key.session_id(dds::xrce::SESSIONID_NONE_WITH_CLIENT_KEY);
+    with_key.client_key({0xAA, 0xBB, 0xCC, 0xDD});
+
+    for (const auto& header : {without_key, with_key})
+    {
+        for (uint8_t id = 1; id < 4; ++id)
+        {
+            const dds::xrce::GET_INFO_Payload request = make_request(id);
+            OutputMessagePtr message;
+            ASSERT_TRUE(cache.make_reply(header, request, id % 2, message));
+            EXPECT_EQ(serialize_reply(header, request, id % 2, object_info), to_bytes(message));
+        }
+    }
+}
+
+/**
+ * @brief   This test checks that building the cache again replaces the previous payload.
+ */
+TEST(InfoReplyCacheTests, Invalidation)
+{
+    const dds::xrce::ObjectInfo first_info = make_object_info({{127, 0, 0, 1}});
+    const dds::xrce::ObjectInfo second_info = make_object_info({{10, 0, 0, 1}, {10, 0, 0, 2}});
+    InfoReplyCache cache;
+    cache.build(first_info);
+
+    dds::xrce::MessageHeader header;
+    header.session_id(dds::xrce::SESSIONID_NONE_WITHOUT_CLIENT_KEY);
+    const dds::xrce::GET_INFO_Payload request = make_request(7);
+
+    OutputMessagePtr message;
+    ASSERT_TRUE(cache.make_reply(header, request, 0, message));
+    EXPECT_EQ(serialize_reply(header, request, 0, first_info), to_bytes(message));
+
+    cache.build(second_info);
+    ASSERT_TRUE(cache.make_reply(header, request, 0, message));
+    EXPECT_EQ(serialize_reply(header, request, 0, second_info), to_bytes(message));
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,224 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/can/CanSegmentation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+class CanSegmentationUnitTests : public ::testing::TestWithParam<size_t>
+{
+protected:
+    static std::vector<uint8_t> make_message(
+            size_t len,
+            uint8_t seed = 0)
+    {
+        std::vector<uint8_t> message(len);
+        for (size_t i = 0; i < len; ++i)
+        {
+            message[i] = static_cast<uint8_t>(i * 7 + seed);
+        }
+        return message;
+    }
+
+    CanSegmentation segmentation_;
+};
+
+TEST_P(CanSegmentationUnitTests, RoundTrip)
+{
+    const std::vector<uint8_t> message = make_message(GetParam());
+    std::vector<CanSegmentation::Frame> frames;
+    ASSERT_TRUE(CanSegmentation::segment(message.data(), message.size(), frames));
+
+    const uint8_t* output = nullptr;
+    size_t output_len = 0;
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        ASSERT_LE(frames[i].len, CanSegmentation::frame_data_size);
+        bool complete = segmentation_.reassemble(0x10, frames[i].data.data(), frames[i].len, output, output_len);
+        ASSERT_EQ(i + 1 == frames.size(), complete);
+    }
+
+    ASSERT_EQ(message.size(), output_len);
+    ASSERT_EQ(0, std::memcmp(message.data(), output, output_len));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MessageSizes,
+    CanSegmentationUnitTests,
+    ::testing::Values(0, 1, 63, 64, 124, 125, 512, 4096, CanSegmentation::max_message_size));
+
+TEST_F(CanSegmentationUnitTests, SingleFrameIsBackwardsCompatible)
+{
+    const std::vector<uint8_t> message = make_message(20);
+    std::vector<CanSegmentation::Frame> frames;
+    ASSERT_TRUE(CanSegmentation::segment(message.data(), message.size(), frames));
+    ASSERT_EQ(1u, frames.size());
+    ASSERT_EQ(20, frames[0].data[0]);
+    ASSERT_EQ(21, frames[0].len);
+}
+
+TEST_F(CanSegmentationUnitTests, OversizedMessage)
+{
+    const std::vector<uint8_t> message = make_message(CanSegmentation::max_message_size + 1);
+    std::vector<CanSegmentation::Frame> frames;
+    ASSERT_FALSE(CanSegmentation::segment(message.data(), message.size(), frames));
+}
+
+TEST_F(CanSegmentationUnitTests, InterleavedCanIds)
+{
+    const std::vector<uint8_t> message_a = make_message(300, 1);
+    const std::vector<uint8_t> message_b = make_message(200, 2);
+    std::vector<CanSegmentation::Frame> frames_a;
+    std::vector<CanSegmentation::Frame> frames_b;
+    ASSERT_TRUE(CanSegmentation::segment(message_a.data(), message_a.size(), frames_a));
+    ASSERT_TRUE(CanSegmentation::segment(message_b.data(), message_b.size(), frames_b));
+
+    const uint8_t* output = nullptr;
+    size_t output_len = 0;
+    size_t completed = 0;
+    for (size_t i = 0; i < std::max(frames_a.size(), frames_b.size()); ++i)
+    {
+        if (i < frames_a.size()
+                && segmentation_.reassemble(0xA, frames_a[i].data.data(), frames_a[i].len, output, output_len))
+        {
+            ASSERT_EQ(message_a.size(), output_len);
+            ASSERT_EQ(0, std::memcmp(message_a.data(), output, output_len));
+            ++completed;
+        }
+        if (i < frames_b.size()
+                && segmentation_.reassemble(0xB, frames_b[i].data.data(), frames_b[i].len, output, output_len))
+        {
+            ASSERT_EQ(message_b.size(), output_len);
+            ASSERT_EQ(0, std::memcmp(message_b.data(), output, output_len));
+            ++completed;
+        }
+    }
+    ASSERT_EQ(2u, completed);
+}
+
+TEST_F(CanSegmentationUnitTests, LostFrameDiscardsMessage)
+{
+    const std::vector<uint8_t> message = make_message(300);
+    std::vector<CanSegmentation::Frame> frames;
+    ASSERT_TRUE(CanSegmentation::segment(message.data(), message.size(), frames));
+
+    const uint8_t* output = nullptr;
+    size_t output_len = 0;
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        if (2 != i)
+        {
+            ASSERT_FALSE(segmentation_.reassemble(0x10, frames[i].data.data(), frames[i].len, output, output_len));
+        }
+    }
+
+    /* The next message is received correctly after the discarded one. */
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        bool complete = segmentation_.reassemble(0x10, frames[i].data.data(), frames[i].len, output, output_len);
+        ASSERT_EQ(i + 1 == frames.size(), complete);
+    }
+    ASSERT_EQ(message.size(), output_len);
+}
+
+TEST_F(CanSegmentationUnitTests, ConsecutiveFrameWithoutFirstFrame)
+{
+    const std::vector<uint8_t> message = make_message(100);
+    std::vector<CanSegmentation::Frame> frames;
+    ASSERT_TRUE(CanSegmentation::segment(message.data(), message.size(), frames));
+    ASSERT_EQ(2u, frames.size());
+
+    const uint8_t* output = nullptr;
+    size_t output_len = 0;
+    ASSERT_FALSE(segmentation_.reassemble(0x10, frames[1].data.data(), frames[1].len, output, output_len));
+}
+
+/*
+ * Loopback through a virtual CAN interface. Set it up with:
+ *   ip link add dev vcan0 type vcan && ip link set vcan0 mtu 72 && ip link set up vcan0
+ */
+TEST_F(CanSegmentationUnitTests, VirtualCanLoopback)
+{
+    int fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (-1 == fd)
+    {
+        GTEST_SKIP() << "SocketCAN not available";
+    }
+
+    struct ifreq ifr {};
+    strcpy(ifr.ifr_name, "vcan0");
+    int enable_canfd = 1;
+    int recv_own_msgs = 1;
+    struct sockaddr_can address {};
+    address.can_family = AF_CAN;
+    if (-1 == ioctl(fd, SIOCGIFINDEX, &ifr)
+            || (address.can_ifindex = ifr.ifr_ifindex,
+            -1 == bind(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
+            || -1 == setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable_canfd, sizeof(enable_canfd))
+            || -1 == setsockopt(fd, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &recv_own_msgs, sizeof(recv_own_msgs)))
+    {
+        close(fd);
+        GTEST_SKIP() << "vcan0 not available";
+    }
+
+    const std::vector<uint8_t> message = make_message(1000);
+    std::vector<CanSegmentation::Frame> frames;
+    ASSERT_TRUE(CanSegmentation::segment(message.data(), message.size(), frames));
+
+    for (const CanSegmentation::Frame& segment : frames)
+    {
+        struct canfd_frame frame {};
+        frame.can_id = 0x123 | CAN_EFF_FLAG;
+        frame.len = segment.len;
+        std::memcpy(frame.data, segment.data.data(), segment.len);
+        ASSERT_EQ(static_cast<ssize_t>(CANFD_MTU), write(fd, &frame, sizeof(frame)));
+    }
+
+    const uint8_t* output = nullptr;
+    size_t output_len = 0;
+    bool complete = false;
+    for (size_t i = 0; i < frames.size() && !complete; ++i)
+    {
+        struct canfd_frame frame {};
+        ASSERT_LT(0, read(fd, &frame, sizeof(frame)));
+        complete = segmentation_.reassemble(frame.can_id & CAN_ERR_MASK, frame.data, frame.len, output, output_len);
+    }
+    close(fd);
+
+    ASSERT_TRUE(complete);
+    ASSERT_EQ(message.size(), output_len);
+    ASSERT_EQ(0, std::memcmp(message.data(), output, output_len));
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/capture/PacketCapture.hpp>
+#include <uxr/agent/transport/endpoint/IPv4EndPoint.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using eprosima::uxr::PacketCapture;
+using eprosima::uxr::IPv4EndPoint;
+
+class PacketCaptureTests : public ::testing::Test
+{
+protected:
+    PacketCaptureTests()
+        : path_("/tmp/uxr-capture-" + std::to_string(getpid()) + ".pcapng")
+    {}
+
+    ~PacketCaptureTests()
+    {
+        for (size_t i = 0; i < 32; ++i)
+        {
+            std::remove(file_path(i).c_str());
+        }
+    }
+
+    std::string file_path(
+            size_t index) const
+    {
+        std::string path = path_;
+        path.insert(path.rfind('.'), "-" + std::to_string(index));
+        return path;
+    }
+
+    std::vector<uint8_t> read_file(
+            size_t index) const
+    {
+        std::ifstream file(file_path(index), std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    template<typename T>
+    static T get(
+            const std::vector<uint8_t>& data,
+            size_t offset)
+    {
+        T value;
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    std::string path_;
+};
+
+TEST_F(PacketCaptureTests, EnhancedPacketBlocks)
+{
+    PacketCapture capture;
+    ASSERT_TRUE(capture.open(path_, "IPv4"));
+    ASSERT_TRUE(capture.enabled());
+
+    IPv4EndPoint endpoint{0x0100007F, 2019};
+    const uint8_t inbound[] = {0x81, 0x00, 0x00, 0x00, 0x0B};
+    const uint8_t outbound[] = {0x81, 0x01, 0x00, 0x00};
+    capture.capture(PacketCapture::Direction::INBOUND, endpoint, inbound, sizeof(inbound));
+    capture.capture(PacketCapture::Direction::OUTBOUND, endpoint, outbound, sizeof(outbound));
+    ASSERT_TRUE(capture.close());
+    ASSERT_FALSE(capture.enabled());
+
+    std::vector<uint8_t> data = read_file(0);
+    ASSERT_GE(data.size(), 12u);
+
+    /* Section Header Block. */
+    size_t offset = 0;
+    ASSERT_EQ(0x0A0D0D0Au, get<uint32_t>(data, offset));
+    ASSERT_EQ(0x1A2B3C4Du, get<uint32_t>(data, offset + 8));
+    offset += get<uint32_t>(data, offset + 4);
+
+    /* Interface Description Block. */
+    ASSERT_EQ(1u, get<uint32_t>(data, offset));
+    ASSERT_EQ(PacketCapture::link_type, get<uint16_t>(data, offset + 8));
+    offset += get<uint32_t>(data, offset + 4);
+
+    /* Enhanced Packet Blocks. */
+    const std::pair<const uint8_t*, size_t> packets[] = {
+        {inbound, sizeof(inbound)}, {outbound, sizeof(outbound)}};
+    uint32_t direction = uint32_t(PacketCapture::Direction::INBOUND);
+    for (const auto& packet : packets)
+    {
+        ASSERT_LT(offset, data.size());
+        uint32_t block_len = get<uint32_t>(data, offset + 4);
+        ASSERT_EQ(6u, get<uint32_t>(data, offset));
+        ASSERT_EQ(block_len, get<uint32_t>(data, offset + block_len - 4));
+        ASSERT_EQ(packet.second, get<uint32_t>(data, offset + 20));
+        ASSERT_EQ(packet.second, get<uint32_t>(data, offset + 24));
+        ASSERT_EQ(0, std::memcmp(packet.first, data.data() + offset + 28, packet.second));
+
+        /* epb_flags followed by the endpoint comment. */
+        size_t option = offset + 28 + ((packet.second + 3) & ~size_t(3));
+        ASSERT_EQ(2u, get<uint16_t>(data, option));
+        ASSERT_EQ(direction, get<uint32_t>(data, option + 4));
+        option += 8;
+        ASSERT_EQ(1u, get<uint16_t>(data, option));
+        std::string comment(
+            reinterpret_cast<const char*>(data.data() + option + 4), get<uint16_t>(data, option + 2));
+        ASSERT_EQ("127.0.0.1:2019", comment);
+
+        offset += block_len;
+        direction = uint32_t(PacketCapture::Direction::OUTBOUND);
+    }
+    ASSERT_EQ(data.size(), offset);
+    ASSERT_EQ(0u, capture.dropped());
+}
+
+TEST_F(PacketCaptureTests, Rotation)
+{
+    PacketCapture capture;
+    ASSERT_TRUE(capture.open(path_, "IPv4", 256, 2));
+
+    IPv4EndPoint endpoint{0x0100007F, 2019};
+    const uint8_t message[64] = {};
+    for (size_t i = 0; i < 16; ++i)
+    {
+        capture.capture(PacketCapture::Direction::INBOUND, endpoint, message, sizeof(message));
+    }
+    ASSERT_TRUE(capture.close());
+
+    /* Only the last two files are kept, and none overflows its size. */
+    size_t files = 0;
+    for (size_t i = 0; i < 32; ++i)
+    {
+        std::vector<uint8_t> data = read_file(i);
+        if (!data.empty())
+        {
+            ++files;
+            ASSERT_LE(data.size(), 256u);
+            ASSERT_EQ(0x0A0D0D0Au, get<uint32_t>(data, 0));
+        }
+    }
+    ASSERT_EQ(2u, files);
+}
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
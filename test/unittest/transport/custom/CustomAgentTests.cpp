@@ -0,0 +1,219 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/custom/CustomAgent.hpp>
+
+#include "../../Common.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+class CustomAgentBatchUnitTests : public ::testing::Test
+{
+protected:
+    CustomAgentBatchUnitTests()
+        : init_function_([]() { return true; })
+        , fini_function_([]() { return true; })
+        , send_msg_function_([this](
+                    const CustomEndPoint*,
+                    uint8_t*,
+                    size_t,
+                    TransportRc&) -> ssize_t
+                {
+                    ++single_calls_;
+                    return 0;
+                })
+        , recv_msg_function_([this](
+                    CustomEndPoint*,
+                    uint8_t*,
+                    size_t,
+                    int timeout,
+                    TransportRc& transport_rc) -> ssize_t
+                {
+                    ++single_calls_;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+                    transport_rc = TransportRc::timeout_error;
+                    return 0;
+                })
+        , single_calls_{0}
+        , unset_key_{0}
+    {
+        endpoint_.add_member<uint8_t>("id");
+    }
+
+    size_t recv_messages(
+            std::vector<CustomAgent::IncomingMessage>& messages,
+            int timeout,
+            TransportRc& transport_rc)
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (pending_.empty())
+        {
+            lock.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+            transport_rc = TransportRc::timeout_error;
+            return 0;
+        }
+
+        size_t received = 0;
+        for (; received < pending_.size() && received < messages.size(); ++received)
+        {
+            CustomAgent::IncomingMessage& message = messages[received];
+            if (unset_key_ != pending_[received][19])
+            {
+                message.source_endpoint->set_member_value<uint8_t>("id", pending_[received][19]);
+            }
+            std::memcpy(message.buffer, pending_[received].data(), pending_[received].size());
+            message.message_length = pending_[received].size();
+        }
+        pending_.erase(pending_.begin(), pending_.begin() + received);
+        batch_sizes_.push_back(received);
+        return received;
+    }
+
+    size_t send_messages(
+            const std::vector<CustomAgent::OutgoingMessage>& messages,
+            TransportRc& /*transport_rc*/)
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        for (const auto& message : messages)
+        {
+            sent_ids_.push_back(message.destination_endpoint->get_member<uint8_t>("id"));
+        }
+        cv_.notify_all();
+        return messages.size();
+    }
+
+    CustomEndPoint endpoint_;
+    CustomAgent::InitFunction init_function_;
+    CustomAgent::FiniFunction fini_function_;
+    CustomAgent::SendMsgFunction send_msg_function_;
+    CustomAgent::RecvMsgFunction recv_msg_function_;
+    std::atomic<size_t> single_calls_;
+    uint8_t unset_key_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::vector<std::vector<uint8_t>> pending_;
+    std::vector<size_t> batch_sizes_;
+    std::vector<uint8_t> sent_ids_;
+};
+
+TEST_F(CustomAgentBatchUnitTests, BatchRoundTrip)
+{
+    const size_t clients = 5;
+    for (uint8_t i = 1; i <= clients; ++i)
+    {
+        pending_.push_back(create_client_message(i));
+    }
+
+    CustomAgent agent(
+        "BATCH",
+        &endpoint_,
+        Middleware::Kind::CED,
+        false,
+        init_function_,
+        fini_function_,
+        send_msg_function_,
+        recv_msg_function_,
+        [this](const std::vector<CustomAgent::OutgoingMessage>& messages, TransportRc& transport_rc)
+        {
+            return send_messages(messages, transport_rc);
+        },
+        [this](std::vector<CustomAgent::IncomingMessage>& messages, int timeout, TransportRc& transport_rc)
+        {
+            return recv_messages(messages, timeout, transport_rc);
+        });
+    ASSERT_TRUE(agent.start());
+
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        ASSERT_TRUE(cv_.wait_for(lock, std::chrono::seconds(5), [&]() { return clients <= sent_ids_.size(); }));
+
+        ASSERT_EQ(1u, batch_sizes_.size());
+        ASSERT_EQ(clients, batch_sizes_[0]);
+
+        std::sort(sent_ids_.begin(), sent_ids_.end());
+        for (uint8_t i = 1; i <= clients; ++i)
+        {
+            EXPECT_EQ(i, sent_ids_[i - 1]);
+        }
+    }
+
+    ASSERT_TRUE(agent.stop());
+    EXPECT_EQ(0u, single_calls_);
+}
+
+TEST_F(CustomAgentBatchUnitTests, BatchEmptyEndPoint)
+{
+    const size_t clients = 5;
+    for (uint8_t i = 1; i <= clients; ++i)
+    {
+        pending_.push_back(create_client_message(i));
+    }
+
+    /* The source of the third message is left without its id, only that message shall be lost. */
+    unset_key_ = 3;
+
+    CustomAgent agent(
+        "BATCH",
+        &endpoint_,
+        Middleware::Kind::CED,
+        false,
+        init_function_,
+        fini_function_,
+        send_msg_function_,
+        recv_msg_function_,
+        [this](const std::vector<CustomAgent::OutgoingMessage>& messages, TransportRc& transport_rc)
+        {
+            return send_messages(messages, transport_rc);
+        },
+        [this](std::vector<CustomAgent::IncomingMessage>& messages, int timeout, TransportRc& transport_rc)
+        {
+            return recv_messages(messages, timeout, transport_rc);
+        });
+    ASSERT_TRUE(agent.start());
+
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        ASSERT_TRUE(cv_.wait_for(lock, std::chrono::seconds(5), [&]() { return clients - 1 <= sent_ids_.size(); }));
+
+        std::sort(sent_ids_.begin(), sent_ids_.end());
+        EXPECT_EQ((std::vector<uint8_t>{1, 2, 4, 5}), sent_ids_);
+    }
+
+    ASSERT_TRUE(agent.stop());
+    EXPECT_EQ(0u, single_calls_);
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/endpoint/CustomEndPoint.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+
+using eprosima::uxr::CustomEndPoint;
+
+namespace {
+
+CustomEndPoint make_endpoint(
+        uint32_t address,
+        uint16_t port)
+{
+    CustomEndPoint endpoint;
+    endpoint.add_member<uint32_t>("address");
+    endpoint.add_member<uint16_t>("port");
+    endpoint.set_member_value<uint32_t>("address", address);
+    endpoint.set_member_value<uint16_t>("port", port);
+    return endpoint;
+}
+
+} // namespace
+
+/* Per packet work of CustomAgent::recv_message: fill the receive endpoint and copy it. */
+static void BM_EndPointFillAndCopy(
+        benchmark::State& state)
+{
+    CustomEndPoint recv_endpoint = make_endpoint(0, 0);
+    uint32_t address = 0;
+    for (auto _ : state)
+    {
+        recv_endpoint.reset();
+        recv_endpoint.set_member_value<uint32_t>("address", ++address);
+        recv_endpoint.set_member_value<uint16_t>("port", 8888);
+        CustomEndPoint source = recv_endpoint;
+        benchmark::DoNotOptimize(source);
+    }
+}
+BENCHMARK(BM_EndPointFillAndCopy);
+
+/* Lookup as done by SessionManager for every received and sent packet. */
+static void BM_EndPointMapLookup(
+        benchmark::State& state)
+{
+    std::map<CustomEndPoint, uint32_t> endpoint_to_client;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        endpoint_to_client.emplace(make_endpoint(static_cast<uint32_t>(i), 8888), static_cast<uint32_t>(i));
+    }
+
+    CustomEndPoint key = make_endpoint(static_cast<uint32_t>(state.range(0) / 2), 8888);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(endpoint_to_client.find(key));
+    }
+}
+BENCHMARK(BM_EndPointMapLookup)->Arg(8)->Arg(64)->Arg(512);
+
+BENCHMARK_MAIN();
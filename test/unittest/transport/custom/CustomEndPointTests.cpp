@@ -0,0 +1,168 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/endpoint/CustomEndPoint.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <unordered_map>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+class CustomEndPointUnitTests : public ::testing::Test
+{
+protected:
+    CustomEndPointUnitTests()
+    {
+        endpoint_.add_member<uint32_t>("address");
+        endpoint_.add_member<uint16_t>("port");
+    }
+
+    CustomEndPoint make_endpoint(
+            uint32_t address,
+            uint16_t port)
+    {
+        CustomEndPoint endpoint = endpoint_;
+        endpoint.set_member_value<uint32_t>("address", address);
+        endpoint.set_member_value<uint16_t>("port", port);
+        return endpoint;
+    }
+
+    CustomEndPoint endpoint_;
+};
+
+TEST_F(CustomEndPointUnitTests, SetGetMembers)
+{
+    endpoint_.set_member_value<uint32_t>("address", 0xC0A80001);
+    endpoint_.set_member_value<uint16_t>("port", 8888);
+
+    EXPECT_EQ(0xC0A80001, endpoint_.get_member<uint32_t>("address"));
+    EXPECT_EQ(8888, endpoint_.get_member<uint16_t>(std::string("port")));
+    EXPECT_NO_THROW(endpoint_.check_non_empty_members());
+}
+
+TEST_F(CustomEndPointUnitTests, Exceptions)
+{
+    EXPECT_THROW(endpoint_.add_member<uint8_t>("port"), std::exception);
+    EXPECT_THROW(endpoint_.set_member_value<uint8_t>("unknown", 1), std::exception);
+    EXPECT_THROW(endpoint_.get_member<uint8_t>("unknown"), std::exception);
+
+    endpoint_.set_member_value<uint32_t>("address", 1);
+    EXPECT_THROW(endpoint_.check_non_empty_members(), std::exception);
+
+    endpoint_.set_member_value<uint16_t>("port", 1);
+    endpoint_.reset();
+    EXPECT_THROW(endpoint_.check_non_empty_members(), std::exception);
+}
+
+TEST_F(CustomEndPointUnitTests, WrongType)
+{
+    CustomEndPoint endpoint;
+    endpoint.add_member<uint32_t>("address");
+    endpoint.add_member<std::string>("name");
+    endpoint.add_member<uint16_t>("port");
+    endpoint.set_member_value<uint32_t>("address", 0xC0A80001);
+    endpoint.set_member_value<uint16_t>("port", 8888);
+
+    /* A deduced int is wider than the last member, and strings and integers do not mix. */
+    EXPECT_THROW(endpoint.set_member_value("port", 7777), std::exception);
+    EXPECT_THROW(endpoint.set_member_value<uint8_t>("address", 1), std::exception);
+    EXPECT_THROW(endpoint.set_member_value<std::string>("port", std::string("port")), std::exception);
+    EXPECT_THROW(endpoint.set_member_value<uint64_t>("name", 1), std::exception);
+    EXPECT_THROW(endpoint.get_member<uint64_t>("port"), std::exception);
+    EXPECT_THROW(endpoint.get_member<std::string>("address"), std::exception);
+
+    EXPECT_EQ(0xC0A80001, endpoint.get_member<uint32_t>("address"));
+    EXPECT_EQ(8888, endpoint.get_member<uint16_t>("port"));
+    EXPECT_TRUE(endpoint.get_member<std::string>("name").empty());
+}
+
+TEST_F(CustomEndPointUnitTests, StringMembers)
+{
+    CustomEndPoint endpoint;
+    endpoint.add_member<std::string>("name");
+    endpoint.add_member<uint8_t>("id");
+
+    CustomEndPoint first = endpoint;
+    first.set_member_value<std::string>("name", std::string("first"));
+    first.set_member_value<uint8_t>("id", 1);
+
+    CustomEndPoint second = endpoint;
+    const std::string name = "second";
+    second.set_member_value<std::string>("name", name);
+    second.set_member_value<uint8_t>("id", 1);
+
+    EXPECT_EQ("first", first.get_member<std::string>("name"));
+    EXPECT_EQ("second", second.get_member<std::string>("name"));
+    EXPECT_FALSE(first == second);
+    EXPECT_TRUE((first < second) != (second < first));
+}
+
+TEST_F(CustomEndPointUnitTests, CopiesKeepLayout)
+{
+    CustomEndPoint copy = make_endpoint(1, 2);
+    endpoint_.add_member<uint64_t>("extra");
+
+    EXPECT_EQ(1u, copy.get_member<uint32_t>("address"));
+    EXPECT_THROW(copy.get_member<uint64_t>("extra"), std::exception);
+}
+
+TEST_F(CustomEndPointUnitTests, Ordering)
+{
+    CustomEndPoint a = make_endpoint(1, 2);
+    CustomEndPoint b = make_endpoint(1, 2);
+    CustomEndPoint c = make_endpoint(2, 1);
+
+    EXPECT_TRUE(a == b);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_EQ(std::hash<CustomEndPoint>{}(a), a.hash());
+    EXPECT_FALSE(a < b);
+    EXPECT_FALSE(b < a);
+    EXPECT_FALSE(a == c);
+    EXPECT_TRUE((a < c) != (c < a));
+}
+
+TEST_F(CustomEndPointUnitTests, AssociativeLookup)
+{
+    std::map<CustomEndPoint, uint32_t> ordered;
+    std::unordered_map<CustomEndPoint, uint32_t> unordered;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        ordered.emplace(make_endpoint(i, static_cast<uint16_t>(i * 3)), i);
+        unordered.emplace(make_endpoint(i, static_cast<uint16_t>(i * 3)), i);
+    }
+
+    ASSERT_EQ(256u, ordered.size());
+    ASSERT_EQ(256u, unordered.size());
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        CustomEndPoint key = make_endpoint(i, static_cast<uint16_t>(i * 3));
+        EXPECT_EQ(i, ordered.at(key));
+        EXPECT_EQ(i, unordered.at(key));
+    }
+    EXPECT_EQ(ordered.end(), ordered.find(make_endpoint(1, 1)));
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
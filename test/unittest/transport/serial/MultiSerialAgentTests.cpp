@@ -0,0 +1,197 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/serial/MultiSerialAgentLinux.hpp>
+
+#include "../../Common.h"
+
+#include <gtest/gtest.h>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+namespace {
+
+const uint8_t agent_addr = 0x00;
+const uint8_t client_addr = 0x01;
+
+/* A multi serial agent whose ports are inserted by hand, one end of a socket pair each. */
+class PairMultiSerialAgent : public MultiSerialAgent
+{
+public:
+    explicit PairMultiSerialAgent(
+            bool io_uring = false)
+        : MultiSerialAgent(agent_addr, Middleware::Kind::CED, io_uring)
+    {}
+
+    ~PairMultiSerialAgent()
+    {
+        stop();
+    }
+
+private:
+    bool init() final
+    {
+        return true;
+    }
+
+    bool fini() final
+    {
+        return true;
+    }
+
+    bool handle_error(
+            TransportRc /*transport_rc*/) final
+    {
+        return true;
+    }
+};
+
+#ifdef UAGENT_IO_URING_PROFILE
+/* Whether the kernel sets up the rings the agent uses. */
+bool io_uring_available()
+{
+    util::IoUring ring;
+    const bool rv = ring.init(4, 8);
+    ring.fini();
+    return rv;
+}
+#endif
+
+/*
+ * Writes a burst of CREATE_CLIENT frames in a single write and counts the STATUS_AGENT replies,
+ * and the rings the agent holds once it has served them.
+ */
+size_t serve_burst(
+        bool io_uring,
+        uint8_t clients,
+        size_t& rings)
+{
+    rings = 0;
+    int fds[2];
+    if (0 != socketpair(AF_UNIX, SOCK_STREAM, 0, fds))
+    {
+        return 0;
+    }
+
+    PairMultiSerialAgent agent(io_uring);
+    agent.set_verbose_level(0);
+    if (!agent.start())
+    {
+        ::close(fds[0]);
+        ::close(fds[1]);
+        return 0;
+    }
+    agent.insert_serial(fds[0]);
+
+    /* The client side frames every request into a single write. */
+    std::vector<uint8_t> burst;
+    FramingIO client(client_addr,
+        [&](uint8_t* buf, size_t len, TransportRc&) -> ssize_t
+        {
+            burst.insert(burst.end(), buf, buf + len);
+            return ssize_t(len);
+        },
+        [&](uint8_t* buf, size_t len, int timeout, TransportRc& transport_rc) -> ssize_t
+        {
+            struct pollfd poll_fd{fds[1], POLLIN, 0};
+            if (0 < poll(&poll_fd, 1, timeout))
+            {
+                return ::read(fds[1], buf, len);
+            }
+            transport_rc = TransportRc::timeout_error;
+            return 0;
+        });
+
+    for (uint8_t key = 1; key <= clients; ++key)
+    {
+        std::vector<uint8_t> message = create_client_message(key);
+        TransportRc transport_rc = TransportRc::ok;
+        client.write_framed_msg(message.data(), message.size(), agent_addr, transport_rc);
+    }
+
+    size_t replies = 0;
+    if (ssize_t(burst.size()) == ::write(fds[1], burst.data(), burst.size()))
+    {
+        uint8_t reply[64];
+        for (uint8_t i = 0; i < clients; ++i)
+        {
+            uint8_t remote_addr = 0;
+            int timeout = 2000;
+            TransportRc transport_rc = TransportRc::ok;
+            const size_t bytes = client.read_framed_msg(reply, sizeof(reply), remote_addr, timeout, transport_rc);
+            if (0 == bytes)
+            {
+                break;
+            }
+            if (is_status_agent(reply, bytes))
+            {
+                ++replies;
+            }
+        }
+    }
+
+    rings = count_rings();
+    agent.stop();
+    ::close(fds[1]);
+    return replies;
+}
+
+} // namespace
+
+/**
+ * @brief   This test checks that a burst spanning several times the per event frame cap is fully
+ *          served, the capped port being read again before waiting for more readiness events.
+ */
+TEST(MultiSerialAgentTests, FrameBurst)
+{
+    size_t rings = 0;
+    EXPECT_EQ(40u, serve_burst(false, 40, rings));
+    EXPECT_EQ(0u, rings);
+}
+
+/**
+ * @brief   This test checks that the same burst is fully served when the ports are read and written
+ *          in batches through io_uring, or through the plain calls in builds without it.
+ */
+TEST(MultiSerialAgentTests, FrameBurstIoUring)
+{
+    size_t rings = 0;
+    EXPECT_EQ(40u, serve_burst(true, 40, rings));
+#ifdef UAGENT_IO_URING_PROFILE
+    /* One ring batches the reads and another the writes, unless the kernel refuses them. */
+    EXPECT_EQ(io_uring_available() ? 2u : 0u, rings);
+    EXPECT_EQ(0u, count_rings());
+#else
+    EXPECT_EQ(0u, rings);
+#endif
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
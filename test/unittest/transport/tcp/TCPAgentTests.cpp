@@ -0,0 +1,211 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/tcp/TCPv4AgentLinux.hpp>
+#include <uxr/agent/utils/ArgumentParser.hpp>
+
+#include "../../Common.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+namespace {
+
+const uint16_t agent_port = 38896;
+
+/* CREATE_CLIENT behind its TCP length prefix. */
+std::vector<uint8_t> create_client_frame(
+        uint8_t key)
+{
+    std::vector<uint8_t> frame = create_client_message(key);
+    const size_t size = frame.size();
+    frame.insert(frame.begin(), {uint8_t(size), uint8_t(size >> 8)});
+    return frame;
+}
+
+/* Connects to the agent, retrying while its listener is not yet accepting. */
+int client_socket()
+{
+    int fd = socket(PF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(agent_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    for (int attempt = 0; attempt < 20; ++attempt)
+    {
+        if (0 == connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    struct timeval timeout{2, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+bool recv_all(
+        int fd,
+        uint8_t* buf,
+        size_t len)
+{
+    size_t received = 0;
+    while (received < len)
+    {
+        ssize_t rv = recv(fd, buf + received, len - received, 0);
+        if (0 >= rv)
+        {
+            return false;
+        }
+        received += size_t(rv);
+    }
+    return true;
+}
+
+/* Reads the next length prefixed message and tells whether it is a STATUS_AGENT. */
+bool recv_status_agent(
+        int fd)
+{
+    uint8_t size_buf[2];
+    uint8_t reply[64];
+    if (!recv_all(fd, size_buf, sizeof(size_buf)))
+    {
+        return false;
+    }
+    const size_t size = size_t(size_buf[0]) | (size_t(size_buf[1]) << 8);
+    return (sizeof(reply) >= size) && recv_all(fd, reply, size) && is_status_agent(reply, size);
+}
+
+/* Sends a framed CREATE_CLIENT and tells whether a STATUS_AGENT came back. */
+bool create_stream_client(
+        int fd,
+        uint8_t key)
+{
+    std::vector<uint8_t> frame = create_client_frame(key);
+    return (ssize_t(frame.size()) == send(fd, frame.data(), frame.size(), 0)) && recv_status_agent(fd);
+}
+
+#ifdef UAGENT_IO_URING_PROFILE
+/* Whether the kernel sets up the multishot stream receive the agent uses. */
+bool io_uring_available()
+{
+    int fd = eventfd(0, EFD_CLOEXEC);
+    util::IoUringStreamReceiver ring;
+    const bool rv = ring.init(fd, 1024, 4);
+    ring.fini();
+    ::close(fd);
+    return rv;
+}
+#endif
+
+} // namespace
+
+/**
+ * @brief   This test checks that a TCP agent launched with -U serves clients, and that it only
+ *          holds a ring in io_uring builds.
+ */
+TEST(TCPAgentTests, IoUringArgument)
+{
+    std::vector<std::string> args = {"MicroXRCEAgent", "tcp4", "-p", std::to_string(agent_port), "-m", "ced",
+                                     "-v", "0", "-U"};
+    std::vector<char*> argv;
+    for (auto& arg : args)
+    {
+        argv.push_back(&arg[0]);
+    }
+
+    {
+        agent::parser::ArgumentParser<TCPv4Agent> parser(int(argv.size()), argv.data(), agent::TransportKind::TCP4);
+        ASSERT_EQ(agent::parser::ParseResult::VALID, parser.parse_arguments());
+        ASSERT_TRUE(parser.launch_agent());
+
+        int fd = client_socket();
+        EXPECT_TRUE(create_stream_client(fd, 0x01));
+#ifdef UAGENT_IO_URING_PROFILE
+        EXPECT_EQ(io_uring_available() ? 1u : 0u, count_rings());
+#else
+        EXPECT_EQ(0u, count_rings());
+#endif
+        ::close(fd);
+    }
+    EXPECT_EQ(0u, count_rings());
+}
+
+/**
+ * @brief   This test checks that the io_uring receive frames several messages of a single segment,
+ *          a message split across segments, and the messages of a connection opened on the slot
+ *          of a closed one.
+ */
+TEST(TCPAgentTests, IoUringStream)
+{
+    TCPv4Agent agent(agent_port, Middleware::Kind::CED, true);
+    agent.set_verbose_level(0);
+    ASSERT_TRUE(agent.start());
+
+    int fd = client_socket();
+    std::vector<uint8_t> burst;
+    for (uint8_t key = 0x10; key < 0x18; ++key)
+    {
+        std::vector<uint8_t> frame = create_client_frame(key);
+        burst.insert(burst.end(), frame.begin(), frame.end());
+    }
+    ASSERT_EQ(ssize_t(burst.size()), send(fd, burst.data(), burst.size(), 0));
+    for (uint8_t key = 0x10; key < 0x18; ++key)
+    {
+        EXPECT_TRUE(recv_status_agent(fd));
+    }
+
+    std::vector<uint8_t> frame = create_client_frame(0x20);
+    ASSERT_EQ(3, send(fd, frame.data(), 3, 0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(ssize_t(frame.size() - 3), send(fd, frame.data() + 3, frame.size() - 3, 0));
+    EXPECT_TRUE(recv_status_agent(fd));
+    ::close(fd);
+#ifdef UAGENT_IO_URING_PROFILE
+    EXPECT_EQ(io_uring_available() ? 1u : 0u, count_rings());
+#endif
+
+    for (uint8_t key = 0x30; key < 0x34; ++key)
+    {
+        fd = client_socket();
+        EXPECT_TRUE(create_stream_client(fd, key));
+        ::close(fd);
+    }
+
+    EXPECT_TRUE(agent.stop());
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
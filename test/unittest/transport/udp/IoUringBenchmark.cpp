@@ -0,0 +1,155 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const uint16_t agent_port = 38890;
+
+/* TIMESTAMP on the stream none, answered with a TIMESTAMP_REPLY by the processing thread. */
+const std::vector<uint8_t> timestamp_message = {
+    0x81, 0x00, 0x00, 0x00,                             // Message header.
+    0x0E, 0x01, 0x08, 0x00,                             // TIMESTAMP submessage header.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};    // Transmit timestamp.
+
+struct Usage
+{
+    double cpu_us;
+    double context_switches;
+};
+
+/* Agent and client share the process, so only the difference between backends is meaningful. */
+Usage get_usage()
+{
+    struct rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return Usage{
+        1e6 * double(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+            double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec),
+        double(usage.ru_nvcsw + usage.ru_nivcsw)};
+}
+
+double percentile(
+        const std::vector<double>& sorted,
+        double ratio)
+{
+    return sorted.empty() ? 0.0 : sorted[std::min(sorted.size() - 1, size_t(ratio * double(sorted.size())))];
+}
+
+} // namespace
+
+/*
+ * Bursts of TIMESTAMPs sent back to back and answered before the next burst, received by the agent
+ * through poll and recvfrom or through the io_uring multishot receive. A burst of one gives the
+ * round-trip latency, longer ones show the system calls saved when several datagrams are queued:
+ * syscalls_per_msg counts the poll and recvfrom calls, or the io_uring_enter calls, of the agent.
+ */
+static void BM_ReceiveBackend(
+        benchmark::State& state)
+{
+    const bool io_uring = (0 != state.range(0));
+    const size_t burst = size_t(state.range(1));
+
+    UDPv4Agent agent(agent_port, Middleware::Kind::CED, 1, io_uring);
+    agent.set_verbose_level(0);
+    if (!agent.start())
+    {
+        state.SkipWithError("agent start failed");
+        return;
+    }
+
+    int fd = socket(PF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(agent_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    struct timeval timeout{0, 200000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    uint8_t buf[64];
+    if (!testing::create_client(fd, 0xDD))
+    {
+        state.SkipWithError("session creation failed");
+    }
+    else
+    {
+        std::vector<double> samples;
+        size_t received = 0;
+        size_t lost = 0;
+        const Usage begin_usage = get_usage();
+        const uint64_t begin_syscalls = agent.get_receive_syscalls();
+        for (auto _ : state)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < burst; ++i)
+            {
+                send(fd, timestamp_message.data(), timestamp_message.size(), 0);
+            }
+            for (size_t i = 0; i < burst; ++i)
+            {
+                if (0 < recv(fd, buf, sizeof(buf), 0))
+                {
+                    ++received;
+                }
+                else
+                {
+                    ++lost;
+                }
+            }
+            samples.push_back(
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count());
+        }
+        const Usage end_usage = get_usage();
+        const uint64_t end_syscalls = agent.get_receive_syscalls();
+
+        std::sort(samples.begin(), samples.end());
+        const double messages = double(std::max(received, size_t(1)));
+        state.counters["p50_us"] = percentile(samples, 0.50);
+        state.counters["p99_us"] = percentile(samples, 0.99);
+        state.counters["msgs"] = benchmark::Counter(double(received), benchmark::Counter::kIsRate);
+        state.counters["cpu_us_per_msg"] = (end_usage.cpu_us - begin_usage.cpu_us) / messages;
+        state.counters["csw_per_msg"] = (end_usage.context_switches - begin_usage.context_switches) / messages;
+        state.counters["syscalls_per_msg"] = double(end_syscalls - begin_syscalls) / messages;
+        state.counters["lost"] = double(lost);
+    }
+
+    ::close(fd);
+    agent.stop();
+}
+BENCHMARK(BM_ReceiveBackend)
+    ->ArgNames({"io_uring", "burst"})
+    ->ArgsProduct({{0, 1}, {1, 32}})
+    ->Iterations(2000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,256 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+#include <uxr/agent/scheduler/FairScheduler.hpp>
+#include <uxr/agent/client/session/Session.hpp>
+
+#include "../../Common.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+namespace {
+
+const uint16_t agent_port = 38893;
+
+/* Submessage id and status of the replies. */
+const uint8_t timestamp_reply_id = 0x0F;
+const uint8_t status_ok = 0x00;
+const uint8_t status_err_resources = 0x87;
+
+const uint32_t client_key_base = 0xAABBCC00;
+
+/* TIMESTAMP on the stream none, answered with a TIMESTAMP_REPLY. */
+const std::vector<uint8_t> timestamp_message = {
+    0x81, 0x00, 0x00, 0x00,                             // Message header.
+    0x0E, 0x01, 0x08, 0x00,                             // TIMESTAMP submessage header.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};    // Transmit timestamp.
+
+int client_socket()
+{
+    int fd = socket(PF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(agent_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+
+    struct timeval timeout{0, 500000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+/* Sends a CREATE_CLIENT and returns the status of the STATUS_AGENT, or -1 if none came back. */
+int create_client_status(
+        int fd,
+        uint8_t key)
+{
+    uint8_t status = 0;
+    return create_client(fd, key, &status) ? int(status) : -1;
+}
+
+/* The flood may still overflow the socket buffer of the agent, so a lost ping is retried. */
+bool ping(
+        int fd)
+{
+    uint8_t reply[64];
+    for (int attempt = 0; attempt < 3; ++attempt)
+    {
+        if ((ssize_t(timestamp_message.size()) == send(fd, timestamp_message.data(), timestamp_message.size(), 0)) &&
+            (8 <= recv(fd, reply, sizeof(reply), 0)) &&
+            (timestamp_reply_id == reply[4]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+class OverloadTests : public ::testing::Test
+{
+protected:
+    OverloadTests()
+        : agent_(agent_port, Middleware::Kind::CED)
+    {
+        agent_.set_verbose_level(0);
+    }
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(agent_.start());
+    }
+
+    void TearDown() override
+    {
+        agent_.stop();
+    }
+
+    UDPv4Agent agent_;
+};
+
+/**
+ * @brief   This test checks that clients and objects over the limits are refused with
+ *          STATUS_ERR_RESOURCES, while the ones already admitted keep working.
+ */
+TEST_F(OverloadTests, Admission)
+{
+    utils::OverloadLimits limits{};
+    limits.max_clients = 2;
+    limits.max_entities_per_client = 1;
+    agent_.set_overload_limits(limits);
+
+    int first = client_socket();
+    int second = client_socket();
+    int third = client_socket();
+    EXPECT_EQ(status_ok, create_client_status(first, 0x01));
+    EXPECT_EQ(status_ok, create_client_status(second, 0x02));
+    EXPECT_EQ(status_err_resources, create_client_status(third, 0x03));
+
+    /* A session restart of an admitted client does not take a new slot. */
+    EXPECT_EQ(status_ok, create_client_status(first, 0x01));
+    EXPECT_TRUE(ping(first));
+    EXPECT_TRUE(ping(second));
+
+    Agent::OpResult result;
+    EXPECT_TRUE(agent_.create_participant_by_ref(client_key_base + 1, 0x01, 0, "participant", 0x00, result));
+    EXPECT_FALSE(agent_.create_participant_by_ref(client_key_base + 1, 0x02, 0, "participant", 0x00, result));
+    EXPECT_EQ(Agent::RESOURCES_ERROR, result);
+
+    /* Replacing an existing object is not a new one. */
+    EXPECT_TRUE(agent_.create_participant_by_ref(client_key_base + 1, 0x01, 0, "participant", 0x02, result));
+
+    /* Raising the limits admits them. */
+    limits.max_clients = 3;
+    agent_.set_overload_limits(limits);
+    EXPECT_EQ(status_ok, create_client_status(third, 0x03));
+
+    utils::OverloadStats stats = agent_.get_overload_stats();
+    EXPECT_EQ(1u, stats.refused_clients);
+    EXPECT_EQ(1u, stats.refused_entities);
+
+    ::close(first);
+    ::close(second);
+    ::close(third);
+}
+
+/**
+ * @brief   This test checks that a client flooding the agent over the ingress rate is shed, while a
+ *          client within the rate gets every reply.
+ */
+TEST_F(OverloadTests, IngressFlood)
+{
+    const size_t flood_size = 20000;
+    const size_t pings = 20;
+
+    utils::OverloadLimits limits{};
+    limits.max_ingress_rate = 100;
+    agent_.set_overload_limits(limits);
+
+    int flooder = client_socket();
+    int client = client_socket();
+    ASSERT_EQ(status_ok, create_client_status(flooder, 0x01));
+    ASSERT_EQ(status_ok, create_client_status(client, 0x02));
+
+    std::thread flood([&]()
+    {
+        /* Far over the rate, in bursts the agent can still receive. */
+        for (size_t i = 0; i < flood_size; ++i)
+        {
+            send(flooder, timestamp_message.data(), timestamp_message.size(), 0);
+            if (0 == (i % 50))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    });
+
+    size_t replies = 0;
+    for (size_t i = 0; i < pings; ++i)
+    {
+        replies += ping(client) ? 1 : 0;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    flood.join();
+    EXPECT_EQ(pings, replies);
+
+    utils::OverloadStats stats = agent_.get_overload_stats();
+    EXPECT_LT(0u, stats.shed_ingress);
+    EXPECT_LE(stats.shed_ingress, flood_size);
+
+    ::close(flooder);
+    ::close(client);
+}
+
+/**
+ * @brief   This test checks that the control messages of the stream none, as a HEARTBEAT, survive the
+ *          byte budget shedding of the output queue as the reliable data does, while best-effort data
+ *          is shed.
+ */
+TEST(OverloadSheddingTests, ControlSurvivesShedding)
+{
+    /* Packets carry their stream only. */
+    FairScheduler<dds::xrce::StreamId, int> scheduler(100, 512);
+    scheduler.init();
+    scheduler.set_max_bytes(3 * 64);
+
+    auto push = [&](dds::xrce::StreamId stream_id)
+    {
+        return scheduler.push(0, dds::xrce::StreamId(stream_id), 64, is_sheddable_stream(stream_id));
+    };
+
+    push(dds::xrce::STREAMID_NONE);
+    push(dds::xrce::STREAMID_BUILTIN_RELIABLE);
+    push(dds::xrce::STREAMID_BUILTIN_BEST_EFFORTS);
+
+    auto drops = push(dds::xrce::STREAMID_BUILTIN_RELIABLE);
+    EXPECT_EQ(1u, drops.sheddable);
+    EXPECT_EQ(0u, drops.others);
+    drops = push(dds::xrce::STREAMID_BUILTIN_BEST_EFFORTS);
+    EXPECT_EQ(1u, drops.sheddable);
+    EXPECT_EQ(0u, drops.others);
+
+    std::vector<dds::xrce::StreamId> packets;
+    ASSERT_TRUE(scheduler.pop(packets, 20));
+    ASSERT_EQ(3u, packets.size());
+    EXPECT_EQ(dds::xrce::STREAMID_NONE, packets[0]);
+    EXPECT_EQ(dds::xrce::STREAMID_BUILTIN_RELIABLE, packets[1]);
+    EXPECT_EQ(dds::xrce::STREAMID_BUILTIN_RELIABLE, packets[2]);
+
+    scheduler.deinit();
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,200 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+#include <uxr/agent/utils/ThreadSettings.hpp>
+
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const uint16_t agent_port = 38889;
+const int rt_priority = 80;
+
+/* TIMESTAMP on the stream none, answered with a TIMESTAMP_REPLY by the processing thread. */
+const std::vector<uint8_t> timestamp_message = {
+    0x81, 0x00, 0x00, 0x00,                             // Message header.
+    0x0E, 0x01, 0x08, 0x00,                             // TIMESTAMP submessage header.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};    // Transmit timestamp.
+
+/* Time-sharing threads that keep every core busy until they are stopped. */
+class CpuHog
+{
+public:
+    explicit CpuHog(
+            bool enabled)
+        : running_(enabled)
+    {
+        const unsigned int cores = enabled ? std::max(std::thread::hardware_concurrency(), 1u) : 0u;
+        for (unsigned int i = 0; i < cores; ++i)
+        {
+            threads_.emplace_back([this]()
+            {
+                /* Created from the client thread, so the real-time policy it may have is dropped. */
+                struct sched_param param{};
+                pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+                volatile uint64_t counter = 0;
+                while (running_)
+                {
+                    counter = counter + 1;
+                }
+            });
+        }
+    }
+
+    ~CpuHog()
+    {
+        running_ = false;
+        for (auto& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+private:
+    std::atomic<bool> running_;
+    std::vector<std::thread> threads_;
+};
+
+bool set_realtime(
+        int policy,
+        int priority)
+{
+    struct sched_param param{};
+    param.sched_priority = priority;
+    return 0 == pthread_setschedparam(pthread_self(), policy, &param);
+}
+
+double percentile(
+        const std::vector<double>& sorted,
+        double ratio)
+{
+    return sorted.empty() ? 0.0 : sorted[std::min(sorted.size() - 1, size_t(ratio * double(sorted.size())))];
+}
+
+} // namespace
+
+/*
+ * Round-trip latency of a TIMESTAMP through the receiver, processing and sender threads, with and
+ * without a CPU hog on every core and with and without SCHED_FIFO on the agent threads. The client
+ * thread takes the same policy as the agent so that only the agent side is compared.
+ */
+static void BM_PingLatency(
+        benchmark::State& state)
+{
+    const bool hog = (0 != state.range(0));
+    const bool realtime = (0 != state.range(1));
+
+    utils::ThreadPolicy policy;
+    if (realtime)
+    {
+        if (!set_realtime(SCHED_FIFO, rt_priority))
+        {
+            state.SkipWithError("real-time scheduling not permitted");
+            return;
+        }
+        policy.scheduling = utils::SchedulingPolicy::FIFO;
+        policy.priority = rt_priority;
+    }
+    for (utils::ThreadKind kind : {utils::ThreadKind::RECEIVER, utils::ThreadKind::SENDER,
+                                   utils::ThreadKind::PROCESSING})
+    {
+        utils::ThreadSettings::set_policy(kind, policy);
+    }
+
+    UDPv4Agent agent(agent_port, Middleware::Kind::CED);
+    agent.set_verbose_level(0);
+    if (!agent.start())
+    {
+        state.SkipWithError("agent start failed");
+        return;
+    }
+
+    int fd = socket(PF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(agent_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    struct timeval timeout{0, 200000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    uint8_t buf[64];
+    if (!testing::create_client(fd, 0xDD))
+    {
+        state.SkipWithError("session creation failed");
+    }
+    else
+    {
+        std::vector<double> samples;
+        size_t lost = 0;
+        CpuHog cpu_hog(hog);
+        for (auto _ : state)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            send(fd, timestamp_message.data(), timestamp_message.size(), 0);
+            if (0 < recv(fd, buf, sizeof(buf), 0))
+            {
+                samples.push_back(
+                    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count());
+            }
+            else
+            {
+                ++lost;
+            }
+        }
+
+        std::sort(samples.begin(), samples.end());
+        state.counters["p50_us"] = percentile(samples, 0.50);
+        state.counters["p99_us"] = percentile(samples, 0.99);
+        state.counters["p999_us"] = percentile(samples, 0.999);
+        state.counters["max_us"] = samples.empty() ? 0.0 : samples.back();
+        state.counters["lost"] = double(lost);
+    }
+
+    ::close(fd);
+    agent.stop();
+    for (utils::ThreadKind kind : {utils::ThreadKind::RECEIVER, utils::ThreadKind::SENDER,
+                                   utils::ThreadKind::PROCESSING})
+    {
+        utils::ThreadSettings::set_policy(kind, utils::ThreadPolicy{});
+    }
+    set_realtime(SCHED_OTHER, 0);
+}
+BENCHMARK(BM_PingLatency)
+    ->ArgNames({"hog", "rt"})
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->Iterations(2000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
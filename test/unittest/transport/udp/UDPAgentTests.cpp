@@ -0,0 +1,297 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+#include <uxr/agent/utils/ArgumentParser.hpp>
+
+#include "../../Common.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <linux/filter.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+namespace {
+
+const uint16_t agent_port = 38894;
+
+int client_socket()
+{
+    int fd = socket(PF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(agent_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+
+    struct timeval timeout{2, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+/* Sends a CREATE_CLIENT and returns the TTL of the STATUS_AGENT, or -1 if none came back. */
+int create_client_ttl(
+        int fd,
+        uint8_t key)
+{
+    const int recv_ttl = 1;
+    setsockopt(fd, IPPROTO_IP, IP_RECVTTL, &recv_ttl, sizeof(recv_ttl));
+
+    std::vector<uint8_t> message = create_client_message(key);
+    if (ssize_t(message.size()) != send(fd, message.data(), message.size(), 0))
+    {
+        return -1;
+    }
+
+    uint8_t reply[64];
+    struct iovec iov{reply, sizeof(reply)};
+    uint8_t control[CMSG_SPACE(sizeof(int))];
+    struct msghdr header{};
+    header.msg_iov = &iov;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+    const ssize_t bytes = recvmsg(fd, &header, 0);
+    if ((0 > bytes) || !is_status_agent(reply, size_t(bytes)))
+    {
+        return -1;
+    }
+
+    int ttl = -1;
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); nullptr != cmsg; cmsg = CMSG_NXTHDR(&header, cmsg))
+    {
+        if ((IPPROTO_IP == cmsg->cmsg_level) && (IP_TTL == cmsg->cmsg_type))
+        {
+            memcpy(&ttl, CMSG_DATA(cmsg), sizeof(ttl));
+        }
+    }
+    return ttl;
+}
+
+/* Descriptors of the agent sockets bound to the port, in creation order. */
+std::vector<int> agent_sockets()
+{
+    std::vector<int> fds;
+    DIR* dir = opendir("/proc/self/fd");
+    if (nullptr != dir)
+    {
+        struct dirent* entry;
+        while (nullptr != (entry = readdir(dir)))
+        {
+            const int fd = atoi(entry->d_name);
+            struct sockaddr_in address{};
+            socklen_t address_len = sizeof(address);
+            if ((0 < fd) && (fd != dirfd(dir)) &&
+                (0 == getsockname(fd, reinterpret_cast<struct sockaddr*>(&address), &address_len)) &&
+                (AF_INET == address.sin_family) && (htons(agent_port) == address.sin_port))
+            {
+                fds.push_back(fd);
+            }
+        }
+        closedir(dir);
+    }
+    std::sort(fds.begin(), fds.end());
+    return fds;
+}
+
+#ifdef UAGENT_IO_URING_PROFILE
+/* Whether the kernel grants rings to this process, some sandboxes forbid io_uring. */
+bool io_uring_available()
+{
+    int fd = socket(PF_INET, SOCK_DGRAM, 0);
+    util::IoUringReceiver ring;
+    const bool rv = ring.init(fd, 1024, 4);
+    ring.fini();
+    ::close(fd);
+    return rv;
+}
+#endif
+
+/* Launches a UDPv4 agent from a command line, as the executable does. */
+class AgentLauncher
+{
+public:
+    AgentLauncher(
+            std::vector<std::string> args)
+        : args_(std::move(args))
+    {
+        for (auto& arg : args_)
+        {
+            argv_.push_back(&arg[0]);
+        }
+        parser_.reset(new agent::parser::ArgumentParser<UDPv4Agent>(
+                int(argv_.size()), argv_.data(), agent::TransportKind::UDP4));
+    }
+
+    bool launch()
+    {
+        return (agent::parser::ParseResult::VALID == parser_->parse_arguments()) && parser_->launch_agent();
+    }
+
+private:
+    std::vector<std::string> args_;
+    std::vector<char*> argv_;
+    std::unique_ptr<agent::parser::ArgumentParser<UDPv4Agent>> parser_;
+};
+
+} // namespace
+
+/**
+ * @brief   This test checks that an agent launched with -U serves clients from an io_uring.
+ */
+TEST(UDPAgentTests, IoUringArgument)
+{
+    int fd = client_socket();
+    {
+        AgentLauncher launcher({"MicroXRCEAgent", "udp4", "-p", std::to_string(agent_port), "-m", "ced", "-v", "0",
+                                "-U"});
+        ASSERT_TRUE(launcher.launch());
+        EXPECT_TRUE(create_client(fd, 0x01));
+#ifdef UAGENT_IO_URING_PROFILE
+        EXPECT_EQ(io_uring_available() ? 1u : 0u, count_rings());
+#endif
+    }
+    EXPECT_EQ(0u, count_rings());
+    ::close(fd);
+}
+
+/**
+ * @brief   This test checks that the agent falls back to poll when the kernel refuses the ring,
+ *          here because the process cannot open more descriptors than the socket of the agent.
+ */
+TEST(UDPAgentTests, IoUringFallback)
+{
+    int fd = client_socket();
+
+    /* The lowest free descriptor is the one the agent socket gets, the ring would need another. */
+    const int next_fd = dup(fd);
+    ::close(next_fd);
+    struct rlimit previous_limit{};
+    ASSERT_EQ(0, getrlimit(RLIMIT_NOFILE, &previous_limit));
+    struct rlimit limit = previous_limit;
+    limit.rlim_cur = rlim_t(next_fd + 1);
+    ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &limit));
+
+    UDPv4Agent agent(agent_port, Middleware::Kind::CED, 1, true);
+    agent.set_verbose_level(0);
+    const bool started = agent.start();
+    const bool created = started && create_client(fd, 0x02);
+    ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &previous_limit));
+
+    ASSERT_TRUE(started);
+    EXPECT_TRUE(created);
+
+    /* The receiver stays on poll once the descriptors are available again. */
+    EXPECT_TRUE(create_client(fd, 0x02));
+    EXPECT_EQ(0u, count_rings());
+    EXPECT_TRUE(agent.stop());
+    ::close(fd);
+}
+
+/**
+ * @brief   This test checks that, with several SO_REUSEPORT sockets, the reply to each client leaves
+ *          from the socket its request arrived on. The test steers the requests to a socket by the
+ *          parity of the client key, and each socket stamps its replies with its own TTL.
+ */
+TEST(UDPAgentTests, ReusePortReplies)
+{
+    AgentLauncher launcher({"MicroXRCEAgent", "udp4", "-p", std::to_string(agent_port), "-m", "ced", "-v", "0",
+                            "-S", "2"});
+    ASSERT_TRUE(launcher.launch());
+
+    std::vector<int> sockets = agent_sockets();
+    ASSERT_EQ(2u, sockets.size());
+
+    /* The last byte of the client key is at offset 19 of the UDP payload of a CREATE_CLIENT. */
+    struct sock_filter code[] = {
+        BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 19),
+        BPF_STMT(BPF_ALU | BPF_AND | BPF_K, 1),
+        BPF_STMT(BPF_RET | BPF_A, 0)};
+    struct sock_fprog program{3, code};
+    ASSERT_EQ(0, setsockopt(sockets[0], SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)));
+    for (size_t i = 0; i < sockets.size(); ++i)
+    {
+        const int ttl = 32 + int(i);
+        ASSERT_EQ(0, setsockopt(sockets[i], IPPROTO_IP, IP_TTL, &ttl, sizeof(ttl)));
+    }
+
+    for (uint8_t key = 0x10; key < 0x18; ++key)
+    {
+        int fd = client_socket();
+        EXPECT_EQ(32 + (key % 2), create_client_ttl(fd, key));
+        EXPECT_EQ(32 + (key % 2), create_client_ttl(fd, key));
+        ::close(fd);
+    }
+}
+
+/**
+ * @brief   This test checks that several sockets are only accepted for the UDP transports, and that
+ *          the TCP transports are still accepted without the option.
+ */
+TEST(UDPAgentTests, SocketsArgument)
+{
+    std::vector<std::string> args = {"MicroXRCEAgent", "tcp4", "-p", std::to_string(agent_port), "-S", "2"};
+    std::vector<char*> argv;
+    for (auto& arg : args)
+    {
+        argv.push_back(&arg[0]);
+    }
+    agent::parser::ArgumentParser<TCPv4Agent> tcp_parser(int(argv.size()), argv.data(), agent::TransportKind::TCP4);
+    EXPECT_EQ(agent::parser::ParseResult::INVALID, tcp_parser.parse_arguments());
+
+    args.resize(4);
+    argv.clear();
+    for (auto& arg : args)
+    {
+        argv.push_back(&arg[0]);
+    }
+    agent::parser::ArgumentParser<TCPv4Agent> default_parser(int(argv.size()), argv.data(), agent::TransportKind::TCP4);
+    EXPECT_EQ(agent::parser::ParseResult::VALID, default_parser.parse_arguments());
+
+    args.push_back("-S");
+    args.push_back("2");
+
+    args[1] = "udp4";
+    argv.clear();
+    for (auto& arg : args)
+    {
+        argv.push_back(&arg[0]);
+    }
+    agent::parser::ArgumentParser<UDPv4Agent> udp_parser(int(argv.size()), argv.data(), agent::TransportKind::UDP4);
+    EXPECT_EQ(agent::parser::ParseResult::VALID, udp_parser.parse_arguments());
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+const uint16_t agent_port = 38888;
+const size_t client_count = 16;
+const size_t burst_size = 64;
+
+/*
+ * TIMESTAMP on the stream none, answered with a TIMESTAMP_REPLY. Lone heartbeats would not do,
+ * since they share a single-slot priority lane and a burst of them collapses into the last one.
+ */
+std::vector<uint8_t> timestamp_message()
+{
+    return std::vector<uint8_t>{
+        0x81, 0x00, 0x00, 0x00,                             // Message header, the session carries no client key.
+        0x0E, 0x01, 0x08, 0x00,                             // TIMESTAMP submessage header.
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};    // Transmit timestamp.
+}
+
+/* Client socket connected to the agent, each one from its own port so that its flow is hashed apart. */
+class Client
+{
+public:
+    explicit Client(
+            uint8_t key)
+        : key_(key)
+        , fd_(socket(PF_INET, SOCK_DGRAM, 0))
+    {
+        struct sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(agent_port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        connect(fd_, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+
+        struct timeval timeout{0, 200000};
+        setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    ~Client()
+    {
+        ::close(fd_);
+    }
+
+    bool create_session()
+    {
+        return testing::create_client(fd_, key_);
+    }
+
+    /* Sends a burst of timestamps and returns the number of replies. */
+    size_t burst()
+    {
+        std::vector<uint8_t> message = timestamp_message();
+        for (size_t i = 0; i < burst_size; ++i)
+        {
+            send(fd_, message.data(), message.size(), 0);
+        }
+
+        size_t replies = 0;
+        uint8_t buf[64];
+        while ((replies < burst_size) && (0 < recv(fd_, buf, sizeof(buf), 0)))
+        {
+            ++replies;
+        }
+        return replies;
+    }
+
+private:
+    uint8_t key_;
+    int fd_;
+};
+
+} // namespace
+
+/*
+ * Timestamps answered per second over loopback, with the clients sending from their own threads and
+ * the agent receiving on 1 to 8 SO_REUSEPORT sockets.
+ */
+static void BM_ReusePortThroughput(
+        benchmark::State& state)
+{
+    UDPv4Agent agent(agent_port, Middleware::Kind::CED, size_t(state.range(0)));
+    agent.set_verbose_level(0);
+    if (!agent.start())
+    {
+        state.SkipWithError("agent start failed");
+        return;
+    }
+
+    std::vector<std::unique_ptr<Client>> clients;
+    for (size_t i = 0; i < client_count; ++i)
+    {
+        clients.emplace_back(new Client(uint8_t(i + 1)));
+        if (!clients.back()->create_session())
+        {
+            state.SkipWithError("session creation failed");
+            agent.stop();
+            return;
+        }
+    }
+
+    size_t replies = 0;
+    for (auto _ : state)
+    {
+        std::atomic<size_t> burst_replies{0};
+        std::vector<std::thread> threads;
+        for (auto& client : clients)
+        {
+            threads.emplace_back([&]()
+            {
+                burst_replies += client->burst();
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        replies += burst_replies;
+    }
+    state.SetItemsProcessed(int64_t(replies));
+    state.counters["lost"] = double(state.iterations() * client_count * burst_size - replies);
+
+    clients.clear();
+    agent.stop();
+}
+BENCHMARK(BM_ReusePortThroughput)
+    ->ArgNames({"sockets"})
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
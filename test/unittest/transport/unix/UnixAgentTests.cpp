@@ -0,0 +1,154 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/unix/UnixDatagramAgentLinux.hpp>
+#include <uxr/agent/transport/unix/UnixStreamAgentLinux.hpp>
+#include <uxr/agent/transport/util/UnixSocketLinux.hpp>
+
+#include "../../Common.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+namespace {
+
+std::string unique_name(
+        const std::string& prefix)
+{
+    return prefix + "-" + std::to_string(getpid());
+}
+
+int client_socket(
+        int type)
+{
+    int fd = socket(AF_UNIX, type, 0);
+    struct timeval timeout{2, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+bool connect_to(
+        int fd,
+        const std::string& name)
+{
+    struct sockaddr_un address{};
+    socklen_t address_len = 0;
+    return util::to_unix_address(util::to_unix_path(name), address, address_len) &&
+           (0 == connect(fd, reinterpret_cast<struct sockaddr*>(&address), address_len));
+}
+
+} // namespace
+
+TEST(UnixAgentTests, DatagramAutoboundClient)
+{
+    const std::string name = unique_name("@uxr-dgram");
+    UnixDatagramAgent agent(name, Middleware::Kind::CED);
+    agent.set_verbose_level(0);
+    ASSERT_TRUE(agent.start());
+
+    /* Without a name there is nowhere to reply to. */
+    int unbound = client_socket(SOCK_DGRAM);
+    ASSERT_TRUE(connect_to(unbound, name));
+    EXPECT_FALSE(create_client(unbound, 0x01));
+
+    /* Binding only the family makes the kernel pick an abstract name. */
+    int fd = client_socket(SOCK_DGRAM);
+    sa_family_t family = AF_UNIX;
+    ASSERT_EQ(0, bind(fd, reinterpret_cast<struct sockaddr*>(&family), sizeof(family)));
+    ASSERT_TRUE(connect_to(fd, name));
+    EXPECT_TRUE(create_client(fd, 0x01));
+
+    ::close(unbound);
+    ::close(fd);
+    ASSERT_TRUE(agent.stop());
+}
+
+TEST(UnixAgentTests, DatagramPathKeepsRegularFile)
+{
+    const std::string path = "/tmp/" + unique_name("uxr-dgram");
+    {
+        std::ofstream file(path);
+        file << "not a socket";
+    }
+
+    UnixDatagramAgent agent(path, Middleware::Kind::CED);
+    agent.set_verbose_level(0);
+    EXPECT_FALSE(agent.start());
+    EXPECT_EQ(0, access(path.c_str(), F_OK));
+    ::unlink(path.c_str());
+
+    /* A socket left behind by a previous run is replaced, and removed on stop. */
+    int stale = socket(AF_UNIX, SOCK_DGRAM, 0);
+    struct sockaddr_un address{};
+    socklen_t address_len = 0;
+    ASSERT_TRUE(util::to_unix_address(path, address, address_len));
+    ASSERT_EQ(0, bind(stale, reinterpret_cast<struct sockaddr*>(&address), address_len));
+    ::close(stale);
+    ASSERT_TRUE(agent.start());
+
+    int fd = client_socket(SOCK_DGRAM);
+    sa_family_t family = AF_UNIX;
+    ASSERT_EQ(0, bind(fd, reinterpret_cast<struct sockaddr*>(&family), sizeof(family)));
+    ASSERT_TRUE(connect_to(fd, path));
+    EXPECT_TRUE(create_client(fd, 0x02));
+
+    ::close(fd);
+    ASSERT_TRUE(agent.stop());
+    EXPECT_NE(0, access(path.c_str(), F_OK));
+}
+
+TEST(UnixAgentTests, StreamConnections)
+{
+    const std::string name = unique_name("@uxr-stream");
+    UnixStreamAgent agent(name, Middleware::Kind::CED);
+    agent.set_verbose_level(0);
+    ASSERT_TRUE(agent.start());
+
+    int first = client_socket(SOCK_SEQPACKET);
+    ASSERT_TRUE(connect_to(first, name));
+    EXPECT_TRUE(create_client(first, 0x03));
+
+    /* Same credentials, but each connection gets its own session and both stay open. */
+    int second = client_socket(SOCK_SEQPACKET);
+    ASSERT_TRUE(connect_to(second, name));
+    EXPECT_TRUE(create_client(second, 0x04));
+
+    EXPECT_TRUE(create_client(first, 0x03));
+    EXPECT_TRUE(create_client(second, 0x04));
+
+    ::close(first);
+    ::close(second);
+    ASSERT_TRUE(agent.stop());
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/transport/udp/UDPv4AgentLinux.hpp>
+#include <uxr/agent/transport/unix/UnixDatagramAgentLinux.hpp>
+#include <uxr/agent/transport/unix/UnixStreamAgentLinux.hpp>
+#include <uxr/agent/transport/util/UnixSocketLinux.hpp>
+
+#include "../../Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace eprosima::uxr;
+
+namespace {
+
+enum Transport
+{
+    UDP4,
+    UNIX_DGRAM,
+    UNIX_STREAM,
+};
+
+const uint16_t agent_port = 38891;
+const char* const agent_name = "@uxr-benchmark";
+
+/* TIMESTAMP on the stream none, answered with a TIMESTAMP_REPLY by the processing thread. */
+const std::vector<uint8_t> timestamp_message = {
+    0x81, 0x00, 0x00, 0x00,                             // Message header.
+    0x0E, 0x01, 0x08, 0x00,                             // TIMESTAMP submessage header.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};    // Transmit timestamp.
+
+int connect_client(
+        Transport transport)
+{
+    int fd = -1;
+    if (UDP4 == transport)
+    {
+        fd = socket(PF_INET, SOCK_DGRAM, 0);
+        struct sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(agent_port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    }
+    else
+    {
+        fd = socket(AF_UNIX, (UNIX_DGRAM == transport) ? SOCK_DGRAM : SOCK_SEQPACKET, 0);
+        if (UNIX_DGRAM == transport)
+        {
+            /* Autobind, the agent replies to the client address. */
+            sa_family_t family = AF_UNIX;
+            bind(fd, reinterpret_cast<struct sockaddr*>(&family), sizeof(family));
+        }
+        struct sockaddr_un address{};
+        socklen_t address_len = 0;
+        util::to_unix_address(util::to_unix_path(agent_name), address, address_len);
+        connect(fd, reinterpret_cast<struct sockaddr*>(&address), address_len);
+    }
+
+    struct timeval timeout{0, 200000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+double cpu_time_us()
+{
+    struct rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return 1e6 * double(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+double percentile(
+        const std::vector<double>& sorted,
+        double ratio)
+{
+    return sorted.empty() ? 0.0 : sorted[std::min(sorted.size() - 1, size_t(ratio * double(sorted.size())))];
+}
+
+/*
+ * Bursts of TIMESTAMPs from a co-located client, answered before the next burst, over UDPv4 on
+ * loopback and over the Unix datagram and sequenced-packet agents. Agent and client share the
+ * process, so the CPU time per message covers both ends of the exchange.
+ */
+template<typename AgentType>
+void run_bursts(
+        benchmark::State& state,
+        AgentType& agent,
+        Transport transport)
+{
+    const size_t burst = size_t(state.range(1));
+
+    agent.set_verbose_level(0);
+    if (!agent.start())
+    {
+        state.SkipWithError("agent start failed");
+        return;
+    }
+
+    int fd = connect_client(transport);
+    uint8_t buf[64];
+    if (!testing::create_client(fd, 0xDD))
+    {
+        state.SkipWithError("session creation failed");
+    }
+    else
+    {
+        std::vector<double> samples;
+        size_t received = 0;
+        size_t lost = 0;
+        const double begin_cpu = cpu_time_us();
+        for (auto _ : state)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < burst; ++i)
+            {
+                send(fd, timestamp_message.data(), timestamp_message.size(), 0);
+            }
+            for (size_t i = 0; i < burst; ++i)
+            {
+                if (0 < recv(fd, buf, sizeof(buf), 0))
+                {
+                    ++received;
+                }
+                else
+                {
+                    ++lost;
+                }
+            }
+            samples.push_back(
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count());
+        }
+        const double end_cpu = cpu_time_us();
+
+        std::sort(samples.begin(), samples.end());
+        state.counters["p50_us"] = percentile(samples, 0.50);
+        state.counters["p99_us"] = percentile(samples, 0.99);
+        state.counters["msgs"] = benchmark::Counter(double(received), benchmark::Counter::kIsRate);
+        state.counters["cpu_us_per_msg"] = (end_cpu - begin_cpu) / double(std::max(received, size_t(1)));
+        state.counters["lost"] = double(lost);
+    }
+
+    ::close(fd);
+    agent.stop();
+}
+
+} // namespace
+
+static void BM_LocalTransport(
+        benchmark::State& state)
+{
+    const Transport transport = Transport(state.range(0));
+    switch (transport)
+    {
+        case UDP4:
+        {
+            UDPv4Agent agent(agent_port, Middleware::Kind::CED);
+            run_bursts(state, agent, transport);
+            break;
+        }
+        case UNIX_DGRAM:
+        {
+            UnixDatagramAgent agent(agent_name, Middleware::Kind::CED);
+            run_bursts(state, agent, transport);
+            break;
+        }
+        case UNIX_STREAM:
+        {
+            UnixStreamAgent agent(agent_name, Middleware::Kind::CED);
+            run_bursts(state, agent, transport);
+            break;
+        }
+    }
+}
+BENCHMARK(BM_LocalTransport)
+    ->ArgNames({"transport", "burst"})
+    ->ArgsProduct({{UDP4, UNIX_DGRAM, UNIX_STREAM}, {1, 32}})
+    ->Iterations(2000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/utils/CorrelationTable.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <map>
+
+using eprosima::uxr::utils::CorrelationTable;
+
+namespace {
+
+/* Replies come back this many requests later, and one request in lost_ratio never gets one. */
+const uint64_t reply_lag = 64;
+const uint64_t lost_ratio = 10;
+
+double resident_kb()
+{
+    long pages = 0;
+    long resident = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> pages >> resident;
+    return double(resident) * double(sysconf(_SC_PAGESIZE)) / 1024.0;
+}
+
+/* The unbounded correlation previously used by the requester. */
+class MapTable
+{
+public:
+    void insert(
+            uint64_t sequence,
+            uint32_t value)
+    {
+        map_.emplace(sequence, value);
+    }
+
+    bool take(
+            uint64_t sequence,
+            uint32_t& value)
+    {
+        auto it = map_.find(sequence);
+        if (map_.end() == it)
+        {
+            return false;
+        }
+        value = it->second;
+        map_.erase(it);
+        return true;
+    }
+
+    size_t size() const { return map_.size(); }
+
+private:
+    std::map<uint64_t, uint32_t> map_;
+};
+
+template<typename Table>
+void soak(
+        benchmark::State& state,
+        Table& table)
+{
+    const double begin_kb = resident_kb();
+    uint64_t sequence = 0;
+    uint64_t replies = 0;
+    for (auto _ : state)
+    {
+        ++sequence;
+        table.insert(sequence, uint32_t(sequence));
+        if ((reply_lag < sequence) && (0 != ((sequence - reply_lag) % lost_ratio)))
+        {
+            uint32_t value = 0;
+            replies += table.take(sequence - reply_lag, value) ? 1 : 0;
+        }
+    }
+
+    state.counters["pending"] = double(table.size());
+    state.counters["replies"] = double(replies);
+    state.counters["rss_growth_kb"] = resident_kb() - begin_kb;
+}
+
+} // namespace
+
+/*
+ * Millions of requests against a service that loses one reply in ten. The bounded table keeps
+ * a flat footprint while the map keeps every lost request.
+ */
+static void BM_CorrelationTable(
+        benchmark::State& state)
+{
+    CorrelationTable<uint32_t> table(1024, std::chrono::milliseconds(30000));
+    soak(state, table);
+    state.counters["overflowed"] = double(table.overflowed());
+}
+BENCHMARK(BM_CorrelationTable)->Iterations(5000000)->Unit(benchmark::kNanosecond);
+
+static void BM_CorrelationMap(
+        benchmark::State& state)
+{
+    MapTable table;
+    soak(state, table);
+}
+BENCHMARK(BM_CorrelationMap)->Iterations(5000000)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
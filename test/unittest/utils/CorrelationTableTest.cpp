@@ -0,0 +1,99 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/utils/CorrelationTable.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+using eprosima::uxr::utils::CorrelationTable;
+
+TEST(CorrelationTableTest, TakeOnce)
+{
+    CorrelationTable<uint32_t> table(8, std::chrono::milliseconds(0));
+    for (uint64_t sequence = 1; sequence <= 4; ++sequence)
+    {
+        table.insert(sequence, uint32_t(100 + sequence));
+    }
+    ASSERT_EQ(4u, table.size());
+
+    /* Replies may come in any order, and only once. */
+    uint32_t value = 0;
+    ASSERT_TRUE(table.take(3, value));
+    ASSERT_EQ(103u, value);
+    ASSERT_FALSE(table.take(3, value));
+    ASSERT_TRUE(table.take(1, value));
+    ASSERT_EQ(101u, value);
+    ASSERT_FALSE(table.take(9, value));
+    ASSERT_EQ(2u, table.size());
+}
+
+/**
+ * @brief   This test checks that lost requests do not grow the table: the oldest pending one is
+ *          evicted by the request issued capacity requests after it.
+ */
+TEST(CorrelationTableTest, Overflow)
+{
+    const size_t capacity = 16;
+    CorrelationTable<uint32_t> table(capacity, std::chrono::milliseconds(0));
+
+    for (uint64_t sequence = 1; sequence <= 100000; ++sequence)
+    {
+        table.insert(sequence, uint32_t(sequence));
+        ASSERT_GE(capacity, table.size());
+    }
+    ASSERT_EQ(capacity, table.size());
+    ASSERT_EQ(100000u - capacity, table.overflowed());
+    ASSERT_EQ(0u, table.expired());
+
+    uint32_t value = 0;
+    ASSERT_FALSE(table.take(100000 - capacity, value));
+    ASSERT_TRUE(table.take(100000 - capacity + 1, value));
+    ASSERT_EQ(uint32_t(100000 - capacity + 1), value);
+}
+
+TEST(CorrelationTableTest, Expiry)
+{
+    CorrelationTable<uint32_t> table(4, std::chrono::milliseconds(20));
+    table.insert(1, 1);
+    table.insert(2, 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    table.insert(3, 3);
+
+    /* A late reply is not correlated, and an expired entry makes room without counting as overflow. */
+    uint32_t value = 0;
+    ASSERT_FALSE(table.take(1, value));
+    table.insert(6, 6);
+    ASSERT_TRUE(table.take(3, value));
+    ASSERT_EQ(3u, value);
+
+    ASSERT_EQ(2u, table.expired());
+    ASSERT_EQ(0u, table.overflowed());
+    ASSERT_EQ(1u, table.size());
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
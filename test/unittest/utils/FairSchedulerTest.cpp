@@ -0,0 +1,240 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/scheduler/FairScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+/* Packets carry their flow and the pop count at which they were pushed. */
+struct Packet
+{
+    int flow;
+    size_t pushed_at;
+};
+
+class FairSchedulerTest : public ::testing::Test
+{
+protected:
+    FairSchedulerTest()
+        : scheduler_(max_size, quantum)
+    {
+        scheduler_.init();
+    }
+
+    ~FairSchedulerTest() override
+    {
+        scheduler_.deinit();
+    }
+
+    void push(
+            int flow,
+            size_t bytes,
+            size_t pushed_at = 0)
+    {
+        scheduler_.push(flow, Packet{flow, pushed_at}, bytes);
+    }
+
+    static constexpr size_t max_size = 32000;
+    static constexpr size_t quantum = 512;
+
+    FairScheduler<Packet, int> scheduler_;
+};
+
+constexpr size_t FairSchedulerTest::max_size;
+constexpr size_t FairSchedulerTest::quantum;
+
+/**
+ * @brief   This test checks that a flooding flow does not delay the low-rate ones.
+ *          The flood keeps a deep backlog while the others send now and then, and each of their
+ *          packets shall leave within one round, that is, one pop per busy flow.
+ */
+TEST_F(FairSchedulerTest, FloodingFlow)
+{
+    const int flood = 0;
+    const int low_rate_flows = 20;
+    const size_t steps = 5000;
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        push(flood, quantum);
+    }
+
+    size_t pops = 0;
+    size_t low_rate_packets = 0;
+    size_t max_delay = 0;
+    for (size_t step = 0; step < steps; ++step)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            push(flood, quantum);
+        }
+        if (0 == (step % 50))
+        {
+            for (int flow = 1; flow <= low_rate_flows; ++flow)
+            {
+                push(flow, 64, pops);
+            }
+        }
+
+        for (int i = 0; i < 2; ++i)
+        {
+            Packet packet;
+            ASSERT_TRUE(scheduler_.pop(packet));
+            ++pops;
+            if (flood != packet.flow)
+            {
+                max_delay = std::max(max_delay, pops - packet.pushed_at);
+                ++low_rate_packets;
+            }
+        }
+    }
+
+    ASSERT_EQ(low_rate_flows * (steps / 50), low_rate_packets);
+    ASSERT_GE(size_t(low_rate_flows + 1), max_delay);
+}
+
+/**
+ * @brief   This test checks that backlogged flows share the output in proportion to their weights.
+ */
+TEST_F(FairSchedulerTest, Weights)
+{
+    scheduler_.set_weight_function([](const int& flow)
+    {
+        return uint16_t((1 == flow) ? 3 : 1);
+    });
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        push(1, quantum);
+        push(2, quantum);
+    }
+
+    std::map<int, size_t> popped;
+    for (size_t i = 0; i < 400; ++i)
+    {
+        Packet packet;
+        ASSERT_TRUE(scheduler_.pop(packet));
+        ++popped[packet.flow];
+    }
+    ASSERT_EQ(300u, popped[1]);
+    ASSERT_EQ(100u, popped[2]);
+}
+
+/**
+ * @brief   This test checks that the budget is counted in bytes, not packets.
+ *          A flow of small packets sends as many bytes per round as a flow of large ones.
+ */
+TEST_F(FairSchedulerTest, ByteBudget)
+{
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        push(1, quantum);
+        for (int j = 0; j < 4; ++j)
+        {
+            push(2, quantum / 4);
+        }
+    }
+
+    std::vector<Packet> packets;
+    ASSERT_TRUE(scheduler_.pop(packets, 500));
+    ASSERT_EQ(500u, packets.size());
+
+    std::map<int, size_t> bytes;
+    for (const auto& packet : packets)
+    {
+        bytes[packet.flow] += (1 == packet.flow) ? quantum : quantum / 4;
+    }
+    ASSERT_EQ(bytes[1], bytes[2]);
+}
+
+/**
+ * @brief   This test checks that a full scheduler drops from the longest flow.
+ */
+TEST(FairSchedulerCapacityTest, DropFromLongest)
+{
+    FairScheduler<Packet, int> scheduler(10, 512);
+    scheduler.init();
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        scheduler.push(0, Packet{0, i}, 512);
+    }
+    scheduler.push(1, Packet{1, 0}, 512);
+
+    std::vector<Packet> packets;
+    ASSERT_TRUE(scheduler.pop(packets, 20));
+    ASSERT_EQ(10u, packets.size());
+    ASSERT_EQ(1u, packets.front().pushed_at);
+    ASSERT_EQ(1, packets[1].flow);
+
+    scheduler.deinit();
+}
+
+/**
+ * @brief   This test checks that over the byte budget the sheddable elements go first, then new
+ *          sheddable ones are refused, and only then the others are dropped.
+ */
+TEST(FairSchedulerCapacityTest, ShedByBytes)
+{
+    FairScheduler<Packet, int> scheduler(100, 512);
+    scheduler.init();
+    scheduler.set_max_bytes(4 * 512);
+
+    scheduler.push(0, Packet{0, 0}, 512);
+    scheduler.push(1, Packet{1, 1}, 512, true);
+    scheduler.push(1, Packet{1, 2}, 512, true);
+    scheduler.push(0, Packet{0, 3}, 512);
+
+    auto drops = scheduler.push(0, Packet{0, 4}, 512);
+    ASSERT_EQ(1u, drops.sheddable);
+    ASSERT_EQ(0u, drops.others);
+    drops = scheduler.push(0, Packet{0, 5}, 512);
+    ASSERT_EQ(1u, drops.sheddable);
+    ASSERT_EQ(0u, drops.others);
+
+    drops = scheduler.push(1, Packet{1, 6}, 512, true);
+    ASSERT_EQ(1u, drops.sheddable);
+    ASSERT_EQ(0u, drops.others);
+
+    drops = scheduler.push(1, Packet{1, 7}, 1024);
+    ASSERT_EQ(0u, drops.sheddable);
+    ASSERT_EQ(2u, drops.others);
+
+    std::vector<Packet> packets;
+    ASSERT_TRUE(scheduler.pop(packets, 20));
+    ASSERT_EQ(3u, packets.size());
+    ASSERT_EQ(4u, packets[0].pushed_at);
+    ASSERT_EQ(5u, packets[1].pushed_at);
+    ASSERT_EQ(7u, packets[2].pushed_at);
+
+    scheduler.deinit();
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
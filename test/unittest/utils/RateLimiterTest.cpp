@@ -0,0 +1,107 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/utils/RateLimiter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+using eprosima::uxr::utils::RateLimiter;
+
+TEST(RateLimiterTest, Disabled)
+{
+    RateLimiter<uint32_t> limiter{0, 1};
+    for (uint32_t source = 0; source < 100; ++source)
+    {
+        EXPECT_TRUE(limiter.allow(source));
+    }
+}
+
+TEST(RateLimiterTest, Refill)
+{
+    const size_t rate = 10;
+    RateLimiter<uint32_t> limiter{rate, 4};
+
+    /* A new source starts with a full bucket. */
+    for (size_t i = 0; i < rate; ++i)
+    {
+        EXPECT_TRUE(limiter.allow(1));
+    }
+    EXPECT_FALSE(limiter.allow(1));
+
+    /* Buckets are independent. */
+    EXPECT_TRUE(limiter.allow(2));
+
+    /* A token every 100 ms. */
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_TRUE(limiter.allow(1));
+    EXPECT_FALSE(limiter.allow(1));
+
+    /* The bucket does not refill beyond its capacity. */
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    for (size_t i = 0; i < rate; ++i)
+    {
+        EXPECT_TRUE(limiter.allow(1));
+    }
+    EXPECT_FALSE(limiter.allow(1));
+}
+
+TEST(RateLimiterTest, MaxSources)
+{
+    const size_t rate = 10;
+    RateLimiter<uint32_t> limiter{rate, 2};
+
+    /* Sources with spent tokens are not idle, so a third one is rejected. */
+    EXPECT_TRUE(limiter.allow(1));
+    EXPECT_TRUE(limiter.allow(2));
+    EXPECT_FALSE(limiter.allow(3));
+    EXPECT_TRUE(limiter.allow(1));
+
+    /* Once their buckets are full again they are forgotten to make room. */
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_TRUE(limiter.allow(3));
+    EXPECT_TRUE(limiter.allow(4));
+    EXPECT_FALSE(limiter.allow(5));
+}
+
+TEST(RateLimiterTest, SetRate)
+{
+    RateLimiter<uint32_t> limiter{1, 4};
+    EXPECT_TRUE(limiter.allow(1));
+    EXPECT_FALSE(limiter.allow(1));
+
+    /* The buckets are discarded, so the source starts again with the new capacity. */
+    limiter.set_rate(2);
+    EXPECT_TRUE(limiter.allow(1));
+    EXPECT_TRUE(limiter.allow(1));
+    EXPECT_FALSE(limiter.allow(1));
+
+    limiter.set_rate(0);
+    EXPECT_TRUE(limiter.allow(1));
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima
+
+int main(int args, char** argv)
+{
+    ::testing::InitGoogleTest(&args, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <uxr/agent/utils/ThreadSettings.hpp>
+
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <thread>
+
+namespace eprosima {
+namespace uxr {
+namespace testing {
+
+using namespace eprosima::uxr::utils;
+
+TEST(ThreadSettingsTest, ParsePolicy)
+{
+    ThreadPolicy policy;
+    ASSERT_TRUE(ThreadSettings::parse_policy("*", policy));
+    EXPECT_TRUE(policy.is_default());
+
+    ASSERT_TRUE(ThreadSettings::parse_policy("3,0-1,1", policy));
+    EXPECT_EQ(policy.cpus, (std::vector<uint16_t>{0, 1, 3}));
+    EXPECT_EQ(policy.scheduling, SchedulingPolicy::DEFAULT);
+
+    ASSERT_TRUE(ThreadSettings::parse_policy("2:fifo:80", policy));
+    EXPECT_EQ(policy.cpus, (std::vector<uint16_t>{2}));
+    EXPECT_EQ(policy.scheduling, SchedulingPolicy::FIFO);
+    EXPECT_EQ(policy.priority, 80);
+
+    ASSERT_TRUE(ThreadSettings::parse_policy(":rr:10", policy));
+    EXPECT_TRUE(policy.cpus.empty());
+    EXPECT_EQ(policy.scheduling, SchedulingPolicy::RR);
+
+    ASSERT_TRUE(ThreadSettings::parse_policy("0:other", policy));
+    EXPECT_EQ(policy.scheduling, SchedulingPolicy::DEFAULT);
+}
+
+TEST(ThreadSettingsTest, RejectInvalidPolicy)
+{
+    ThreadPolicy policy;
+    EXPECT_FALSE(ThreadSettings::parse_policy("", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("3-1", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0-", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("a", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0:fifo", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0:fifo:0", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0:rr:100", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0:other:10", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0:idle:10", policy));
+    EXPECT_FALSE(ThreadSettings::parse_policy("0:fifo:10:1", policy));
+}
+
+TEST(ThreadSettingsTest, ApplyNameAndAffinity)
+{
+    ThreadPolicy policy;
+    policy.cpus = {0};
+    ThreadSettings::set_policy(ThreadKind::SENDER, policy);
+
+    std::thread thread([]()
+    {
+        EXPECT_TRUE(ThreadSettings::apply(ThreadKind::SENDER, "uxr-sender-with-a-long-name"));
+
+        char name[16] = {};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        EXPECT_STREQ("uxr-sender-with", name);
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        EXPECT_EQ(1, CPU_COUNT(&cpu_set));
+        EXPECT_TRUE(CPU_ISSET(0, &cpu_set));
+    });
+    thread.join();
+
+    ThreadSettings::set_policy(ThreadKind::SENDER, ThreadPolicy{});
+}
+
+} // namespace testing
+} // namespace uxr
+} // namespace eprosima